@@ -0,0 +1,72 @@
+#include "ocilib.h"
+
+/*
+ * Fetch memory benchmark : compares the number of round trips needed to fetch NB_ROWS rows
+ * of various widths with the default fetch size and with a fetch memory budget set with
+ * OCI_SetFetchMemory().
+ *
+ * Round trips are counted with the statement statistics (OCI_ENV_STATEMENT_STATS)
+ */
+
+#define NB_ROWS     1000000
+#define FETCH_MEM   (4 * 1024 * 1024)
+
+static const int widths[] = { 10, 100, 1000, 4000 };
+
+void err_handler(OCI_Error *err)
+{
+    printf("%s\n", OCI_ErrorGetString(err));
+}
+
+static void run_query(OCI_Connection *cn, int width, unsigned int fetch_mem)
+{
+    OCI_Statement *st = OCI_StatementCreate(cn);
+    OCI_Resultset *rs = NULL;
+
+    clock_t start   = clock();
+    int     nb_rows = NB_ROWS;
+
+    OCI_SetFetchMemory(st, fetch_mem);
+    OCI_Prepare(st, "select level, rpad('x', :w, 'x') from dual connect by level <= :n");
+    OCI_BindInt(st, ":w", &width);
+    OCI_BindInt(st, ":n", &nb_rows);
+    OCI_Execute(st);
+
+    rs = OCI_GetResultset(st);
+
+    while (OCI_FetchNext(rs))
+    {
+        OCI_GetString(rs, 2);
+    }
+
+    printf("%5d bytes, %-14s : %8lu round trips, %.3f s\n",
+           width, fetch_mem ? "memory budget" : "fetch size",
+           (unsigned long) OCI_GetStatementStats(st, OCI_SSV_ROUND_TRIPS),
+           (double) (clock() - start) / CLOCKS_PER_SEC);
+
+    OCI_StatementFree(st);
+}
+
+int main(void)
+{
+    OCI_Connection *cn = NULL;
+    size_t          i;
+
+    if (!OCI_Initialize(err_handler, NULL, OCI_ENV_DEFAULT | OCI_ENV_STATEMENT_STATS))
+    {
+        return EXIT_FAILURE;
+    }
+
+    cn = OCI_ConnectionCreate("db", "usr", "pwd", OCI_SESSION_DEFAULT);
+
+    for (i = 0; i < sizeof(widths) / sizeof(widths[0]); i++)
+    {
+        run_query(cn, widths[i], 0);
+        run_query(cn, widths[i], FETCH_MEM);
+    }
+
+    OCI_ConnectionFree(cn);
+    OCI_Cleanup();
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,217 @@
+#include "ocilib.h"
+
+/*
+ * Name lookup benchmark : compares the hash tables used by OCILIB for bind and column names
+ * lookups (OCI_HashXXX() API) with the chained hash table used by previous OCILIB versions.
+ *
+ * It then measures OCI_GetBind2() and OCI_GetColumnIndex() with NB_NAMES binds and columns
+ */
+
+#define NB_NAMES    256
+#define NB_LOOKUPS  2000000
+#define NB_SLOTS    256
+
+/* ------------------------------------------------------------------------------------------ *
+ * chained hash table of previous versions (one allocation per entry and per value)
+ * ------------------------------------------------------------------------------------------ */
+
+typedef struct ChainedEntry
+{
+    char                *key;
+    int                  value;
+    struct ChainedEntry *next;
+} ChainedEntry;
+
+static ChainedEntry *chained_slots[NB_SLOTS];
+
+static unsigned int chained_hash(const char *str)
+{
+    unsigned int h = 0;
+
+    for (; *str; str++)
+    {
+        h = 31 * h + toupper((unsigned char) *str);
+    }
+
+    return h % NB_SLOTS;
+}
+
+static int chained_compare(const char *s1, const char *s2)
+{
+    while (*s1 && toupper((unsigned char) *s1) == toupper((unsigned char) *s2))
+    {
+        s1++;
+        s2++;
+    }
+
+    return toupper((unsigned char) *s1) - toupper((unsigned char) *s2);
+}
+
+static void chained_add(const char *key, int value)
+{
+    ChainedEntry **slot = &chained_slots[chained_hash(key)];
+    ChainedEntry  *e    = (ChainedEntry *) calloc(1, sizeof(*e));
+
+    e->key   = (char *) malloc(strlen(key) + 1);
+    e->value = value;
+
+    strcpy(e->key, key);
+
+    while (*slot)
+    {
+        slot = &(*slot)->next;
+    }
+
+    *slot = e;
+}
+
+static int chained_get(const char *key)
+{
+    ChainedEntry *e = chained_slots[chained_hash(key)];
+
+    for (; e; e = e->next)
+    {
+        if (chained_compare(e->key, key) == 0)
+        {
+            return e->value;
+        }
+    }
+
+    return -1;
+}
+
+static void chained_free(void)
+{
+    int i;
+
+    for (i = 0; i < NB_SLOTS; i++)
+    {
+        while (chained_slots[i])
+        {
+            ChainedEntry *e = chained_slots[i];
+            chained_slots[i] = e->next;
+            free(e->key);
+            free(e);
+        }
+    }
+}
+
+/* ------------------------------------------------------------------------------------------ */
+
+static char names[NB_NAMES][32];
+
+static double elapsed(clock_t start)
+{
+    return (double) (clock() - start) / CLOCKS_PER_SEC;
+}
+
+void err_handler(OCI_Error *err)
+{
+    printf("%s\n", OCI_ErrorGetString(err));
+}
+
+int main(void)
+{
+    OCI_HashTable  *ht;
+    OCI_Connection *cn;
+    OCI_Statement  *st;
+    OCI_Resultset  *rs;
+    clock_t         start;
+    char           *sql;
+    int             values[NB_NAMES];
+    int             i, sum;
+
+    if (!OCI_Initialize(err_handler, NULL, OCI_ENV_DEFAULT))
+    {
+        return EXIT_FAILURE;
+    }
+
+    for (i = 0; i < NB_NAMES; i++)
+    {
+        sprintf(names[i], "COLUMN_NAME_%03d", i + 1);
+    }
+
+    /* hash tables */
+
+    ht = OCI_HashCreate(NB_SLOTS, OCI_HASH_INTEGER);
+
+    for (i = 0; i < NB_NAMES; i++)
+    {
+        OCI_HashAddInt(ht, names[i], i + 1);
+        chained_add(names[i], i + 1);
+    }
+
+    start = clock();
+    for (i = 0, sum = 0; i < NB_LOOKUPS; i++)
+    {
+        sum += chained_get(names[i % NB_NAMES]);
+    }
+    printf("chained hash table       : %.3f s (%d)\n", elapsed(start), sum);
+
+    start = clock();
+    for (i = 0, sum = 0; i < NB_LOOKUPS; i++)
+    {
+        sum += OCI_HashGetInt(ht, names[i % NB_NAMES]);
+    }
+    printf("open addressing table    : %.3f s (%d)\n", elapsed(start), sum);
+
+    chained_free();
+    OCI_HashFree(ht);
+
+    /* bind and column names lookups */
+
+    cn  = OCI_ConnectionCreate("db", "usr", "pwd", OCI_SESSION_DEFAULT);
+    st  = OCI_StatementCreate(cn);
+    sql = (char *) calloc(NB_NAMES, 64);
+
+    strcpy(sql, "select ");
+
+    for (i = 0; i < NB_NAMES; i++)
+    {
+        sprintf(sql + strlen(sql), "%s:%s %s", i ? ", " : "", names[i], names[i]);
+    }
+
+    strcat(sql, " from dual");
+
+    OCI_Prepare(st, sql);
+
+    for (i = 0; i < NB_NAMES; i++)
+    {
+        char bind_name[40];
+
+        sprintf(bind_name, ":%s", names[i]);
+
+        values[i] = i + 1;
+        OCI_BindInt(st, bind_name, &values[i]);
+    }
+
+    start = clock();
+    for (i = 0; i < NB_LOOKUPS; i++)
+    {
+        char bind_name[40];
+
+        sprintf(bind_name, ":%s", names[i % NB_NAMES]);
+        OCI_GetBind2(st, bind_name);
+    }
+    printf("OCI_GetBind2()           : %.3f s\n", elapsed(start));
+
+    OCI_Execute(st);
+
+    rs = OCI_GetResultset(st);
+    OCI_FetchNext(rs);
+
+    start = clock();
+    for (i = 0, sum = 0; i < NB_LOOKUPS; i++)
+    {
+        sum += OCI_GetColumnIndex(rs, names[i % NB_NAMES]);
+    }
+    printf("OCI_GetColumnIndex()     : %.3f s (%d)\n", elapsed(start), sum);
+
+    free(sql);
+
+    OCI_StatementFree(st);
+    OCI_ConnectionFree(cn);
+    OCI_Cleanup();
+
+    return EXIT_SUCCESS;
+}
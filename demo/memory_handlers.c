@@ -0,0 +1,214 @@
+#include "ocilib.h"
+
+/*
+ * Allocation benchmark : compares the C runtime allocator with a custom allocator
+ * installed with OCI_SetMemoryHandlers() on a fetch heavy workload.
+ *
+ * The custom allocator is a minimal single threaded size class cache.
+ * Any other allocator (jemalloc, mimalloc, ...) can be plugged the same way.
+ */
+
+#define NB_ROWS     100000
+#define NB_RUNS     5
+#define NB_CLASSES  8
+#define MIN_CLASS   32
+
+typedef struct CacheBlock
+{
+    size_t             size;
+    struct CacheBlock *next;
+} CacheBlock;
+
+static CacheBlock *cache[NB_CLASSES];
+
+static size_t nb_allocs = 0;
+static size_t nb_hits   = 0;
+
+static int get_class(size_t size)
+{
+    size_t class_size = MIN_CLASS;
+    int    index      = 0;
+
+    while (index < NB_CLASSES && class_size < size)
+    {
+        class_size <<= 1;
+        index++;
+    }
+
+    return index;
+}
+
+static void * cache_alloc(size_t size)
+{
+    const int   index = get_class(size + sizeof(CacheBlock));
+    CacheBlock *block = NULL;
+
+    nb_allocs++;
+
+    if (index < NB_CLASSES && cache[index])
+    {
+        block        = cache[index];
+        cache[index] = block->next;
+        nb_hits++;
+    }
+    else
+    {
+        const size_t total = index < NB_CLASSES ? ((size_t) MIN_CLASS << index) : size + sizeof(CacheBlock);
+
+        block = (CacheBlock *) malloc(total);
+
+        if (NULL == block)
+        {
+            return NULL;
+        }
+
+        block->size = total;
+    }
+
+    return block + 1;
+}
+
+static void cache_free(void *ptr)
+{
+    if (ptr)
+    {
+        CacheBlock *block = ((CacheBlock *) ptr) - 1;
+        const int   index = get_class(block->size);
+
+        if (index < NB_CLASSES && ((size_t) MIN_CLASS << index) == block->size)
+        {
+            block->next  = cache[index];
+            cache[index] = block;
+        }
+        else
+        {
+            free(block);
+        }
+    }
+}
+
+static void * cache_realloc(void *ptr, size_t size)
+{
+    void *ptr_new = NULL;
+
+    if (NULL == ptr)
+    {
+        return cache_alloc(size);
+    }
+    else
+    {
+        CacheBlock  *block = ((CacheBlock *) ptr) - 1;
+        const size_t avail = block->size - sizeof(CacheBlock);
+
+        if (size <= avail)
+        {
+            return ptr;
+        }
+
+        ptr_new = cache_alloc(size);
+
+        if (ptr_new)
+        {
+            memcpy(ptr_new, ptr, avail);
+            cache_free(ptr);
+        }
+    }
+
+    return ptr_new;
+}
+
+static void cache_release(void)
+{
+    int i;
+
+    for (i = 0; i < NB_CLASSES; i++)
+    {
+        while (cache[i])
+        {
+            CacheBlock *block = cache[i];
+            cache[i] = block->next;
+            free(block);
+        }
+    }
+}
+
+void err_handler(OCI_Error *err)
+{
+    printf("%s\n", OCI_ErrorGetString(err));
+}
+
+static double run_workload(void)
+{
+    clock_t start   = clock();
+    int     nb_rows = NB_ROWS;
+    int     run;
+
+    OCI_Connection *cn = OCI_ConnectionCreate("db", "usr", "pwd", OCI_SESSION_DEFAULT);
+
+    for (run = 0; run < NB_RUNS; run++)
+    {
+        OCI_Statement *st = OCI_StatementCreate(cn);
+        OCI_Resultset *rs = NULL;
+
+        OCI_SetFetchSize(st, 100);
+        OCI_Prepare(st, "select level, 'row ' || level, sysdate, systimestamp from dual connect by level <= :n");
+        OCI_BindInt(st, ":n", &nb_rows);
+        OCI_Execute(st);
+
+        rs = OCI_GetResultset(st);
+
+        while (OCI_FetchNext(rs))
+        {
+            OCI_GetInt(rs, 1);
+            OCI_GetString(rs, 2);
+            OCI_GetDate(rs, 3);
+            OCI_GetTimestamp(rs, 4);
+        }
+
+        OCI_StatementFree(st);
+    }
+
+    OCI_ConnectionFree(cn);
+
+    return (double) (clock() - start) / CLOCKS_PER_SEC;
+}
+
+int main(void)
+{
+    double elapsed = 0;
+
+    /* default allocator */
+
+    if (!OCI_Initialize(err_handler, NULL, OCI_ENV_DEFAULT))
+    {
+        return EXIT_FAILURE;
+    }
+
+    elapsed = run_workload();
+
+    printf("default allocator : %.3f s\n", elapsed);
+
+    OCI_Cleanup();
+
+    /* custom allocator, must be installed before OCI_Initialize() */
+
+    OCI_SetMemoryHandlers(cache_alloc, cache_realloc, cache_free);
+
+    if (!OCI_Initialize(err_handler, NULL, OCI_ENV_DEFAULT))
+    {
+        return EXIT_FAILURE;
+    }
+
+    elapsed = run_workload();
+
+    printf("custom allocator  : %.3f s (%lu allocations, %lu served from cache)\n",
+           elapsed, (unsigned long) nb_allocs, (unsigned long) nb_hits);
+
+    OCI_Cleanup();
+
+    OCI_SetMemoryHandlers(NULL, NULL, NULL);
+
+    cache_release();
+
+    return EXIT_SUCCESS;
+}
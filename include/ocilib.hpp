@@ -166,6 +166,7 @@ namespace ocilib
 #include "ocilibcpp/detail/core/ConcurrentMap.hpp"
 #include "ocilibcpp/detail/core/ConcurrentList.hpp"
 #include "ocilibcpp/detail/core/SmartHandle.hpp"
+#include "ocilibcpp/detail/core/TaskPromise.hpp"
 
 /* Including support implementations  */
 
@@ -178,6 +179,7 @@ namespace ocilib
 #include "ocilibcpp/detail/support/HandleDeleter.hpp"
 #include "ocilibcpp/detail/support/HandleStoreResolver.hpp"
 #include "ocilibcpp/detail/support/NumericTypeResolver.hpp"
+#include "ocilibcpp/detail/support/RowLayout.hpp"
 
 /* Including types implementations  */
 
@@ -186,6 +188,8 @@ namespace ocilib
 #include "ocilibcpp/detail/Mutex.hpp"
 #include "ocilibcpp/detail/Thread.hpp"
 #include "ocilibcpp/detail/ThreadKey.hpp"
+#include "ocilibcpp/detail/Executor.hpp"
+#include "ocilibcpp/detail/Task.hpp"
 #include "ocilibcpp/detail/Pool.hpp"
 #include "ocilibcpp/detail/Connection.hpp"
 #include "ocilibcpp/detail/Transaction.hpp"
@@ -207,6 +211,8 @@ namespace ocilib
 #include "ocilibcpp/detail/BindInfo.hpp"
 #include "ocilibcpp/detail/Statement.hpp"
 #include "ocilibcpp/detail/Resultset.hpp"
+#include "ocilibcpp/detail/ColumnBlock.hpp"
+#include "ocilibcpp/detail/RowMapper.hpp"
 #include "ocilibcpp/detail/Column.hpp"
 #include "ocilibcpp/detail/Subscription.hpp"
 #include "ocilibcpp/detail/Event.hpp"
@@ -80,6 +80,16 @@
  * - OCI_ENV_THREADED : multi-threading support
  * - OCI_ENV_CONTEXT  : thread contextual error handling
  * - OCI_ENV_EVENTS   : enables events for subscription, HA Events, AQ notifications
+ * - OCI_ENV_NO_MEMORY_STATS : disables the accounting of allocated bytes
+ * - OCI_ENV_MEMORY_ARENA : internal structures owned by a connection (statements, binds,
+ *   resultsets, ...) are allocated from a per connection memory arena and released in bulk
+ *   when the connection is freed
+ * - OCI_ENV_MEMORY_PROFILING : enables per memory type allocation profiling (see OCI_GetMemoryProfileValue())
+ * - OCI_ENV_DESCRIPTOR_POOL : OCI descriptor arrays (timestamps, intervals, ...) used by defines and arrays
+ *   are kept in an environment wide pool and reused instead of being freed (see OCI_GetDescriptorPoolValue())
+ * - OCI_ENV_TYPEINFO_CACHE : type info descriptions are shared by all connections to the same database and user
+ *   instead of being described by each connection (see OCI_TypeInfoInvalidate())
+ * - OCI_ENV_STATEMENT_STATS : enables statement execution statistics (see OCI_GetStatementStats())
  *
  * @note
  * This function must be called before any OCILIB library function.
@@ -249,6 +259,11 @@ OCI_SYM_PUBLIC unsigned int OCI_API OCI_GetCharset
 * - OCI_MEM_OCILIB : bytes allocated by OCILIB library
 * - OCI_MEM_ORACLE : bytes allocated by all libraries
 *
+* @note
+* Counters are updated with atomic operations and are not serialized by any lock.
+* If OCI_Initialize() was called with the flag OCI_ENV_NO_MEMORY_STATS, no accounting
+* is performed and this function returns 0
+*
 */
 
 OCI_SYM_PUBLIC big_uint OCI_API OCI_GetAllocatedBytes
@@ -256,6 +271,180 @@ OCI_SYM_PUBLIC big_uint OCI_API OCI_GetAllocatedBytes
     unsigned int mem_type
 );
 
+/**
+* @brief
+* Return the number of entries of the memory allocation profile
+*
+* @note
+* Each entry corresponds to a type of memory block allocated by OCILIB (statements, define buffers,
+* bind buffers, strings, list items, ...) or by the Oracle client (first entry)
+*
+* @note
+* Profile entries are indexed from 1 to the value returned by this function
+*
+*/
+
+OCI_SYM_PUBLIC unsigned int OCI_API OCI_GetMemoryProfileSize
+(
+    void
+);
+
+/**
+* @brief
+* Return the name of the given memory allocation profile entry
+*
+* @param index - Profile entry index (starting at 1)
+*
+*/
+
+OCI_SYM_PUBLIC const otext * OCI_API OCI_GetMemoryProfileName
+(
+    unsigned int index
+);
+
+/**
+* @brief
+* Return a value of the given memory allocation profile entry
+*
+* @param index - Profile entry index (starting at 1)
+* @param value - Value to retrieve
+*
+* @note
+* Possible values are:
+* - OCI_MPV_BYTES : number of bytes currently allocated
+* - OCI_MPV_COUNT : number of blocks currently allocated
+* - OCI_MPV_PEAK  : highest number of bytes allocated at once (high-water mark)
+*
+* @note
+* Memory profiling must be enabled by passing OCI_ENV_MEMORY_PROFILING to OCI_Initialize().
+* Otherwise this function returns 0.
+*
+* @note
+* Blocks carved from connection memory arenas (OCI_ENV_MEMORY_ARENA) are not reported individually.
+* Arena slabs are reported as a whole under the "Internal memory arena" entry, so that profile
+* totals match OCI_GetAllocatedBytes().
+*
+*/
+
+OCI_SYM_PUBLIC big_uint OCI_API OCI_GetMemoryProfileValue
+(
+    unsigned int index,
+    unsigned int value
+);
+
+/**
+* @brief
+* Return a statistic of the OCI descriptor pool
+*
+* @param value - Value to retrieve
+*
+* @note
+* Possible values are:
+* - OCI_DPV_HITS   : number of descriptor array allocations served from the pool
+* - OCI_DPV_MISSES : number of descriptor array allocations forwarded to the Oracle client
+* - OCI_DPV_SIZE   : number of descriptor arrays currently kept in the pool
+*
+* @note
+* The descriptor pool must be enabled by passing OCI_ENV_DESCRIPTOR_POOL to OCI_Initialize().
+* Otherwise this function returns 0.
+*
+* @note
+* Descriptor arrays are pooled per environment handle, descriptor type and number of elements.
+* LOB and FILE locators are never pooled.
+* Pooled descriptors are released by OCI_Cleanup()
+*
+*/
+
+OCI_SYM_PUBLIC big_uint OCI_API OCI_GetDescriptorPoolValue
+(
+    unsigned int value
+);
+
+/**
+* @brief
+* Return the number of SQL statements for which statistics have been aggregated
+*
+* @note
+* Statistics of all statements executing the same SQL are aggregated in a single entry
+* identified by the SQL text
+*
+* @note
+* Entries are indexed from 1 to the value returned by this function
+*
+*/
+
+OCI_SYM_PUBLIC unsigned int OCI_API OCI_GetSqlStatsSize
+(
+    void
+);
+
+/**
+* @brief
+* Return the SQL text of the given statistics entry
+*
+* @param index - Statistics entry index (starting at 1)
+*
+*/
+
+OCI_SYM_PUBLIC const otext * OCI_API OCI_GetSqlStatsName
+(
+    unsigned int index
+);
+
+/**
+* @brief
+* Return an aggregated execution statistic of the given statistics entry
+*
+* @param index - Statistics entry index (starting at 1)
+* @param value - Value to retrieve
+*
+* @note
+* See OCI_GetStatementStats() for possible values
+*
+* @note
+* Statistics must be enabled by passing OCI_ENV_STATEMENT_STATS to OCI_Initialize().
+* Otherwise no entries are available.
+*
+*/
+
+OCI_SYM_PUBLIC big_uint OCI_API OCI_GetSqlStatsValue
+(
+    unsigned int index,
+    unsigned int value
+);
+
+/**
+* @brief
+* Install custom memory allocation routines
+*
+* @param alloc_func   - malloc() like routine
+* @param realloc_func - realloc() like routine
+* @param free_func    - free() like routine
+*
+* @note
+* Installed routines are used for all memory allocated by OCILIB and for all memory
+* allocated by the Oracle client through the OCI environment callbacks.
+* It allows using allocators like jemalloc, mimalloc or per thread caches.
+*
+* @note
+* Passing NULL for a routine restores the C runtime default one (malloc, realloc or free)
+*
+* @warning
+* This function must be called before OCI_Initialize() or after OCI_Cleanup().
+* Otherwise it fails with the error OCI_ERR_ALREADY_INITIALIZED
+*
+* @return
+* TRUE on success otherwise FALSE
+*
+*/
+
+OCI_SYM_PUBLIC boolean OCI_API OCI_SetMemoryHandlers
+(
+    POCI_MEM_ALLOC   alloc_func,
+    POCI_MEM_REALLOC realloc_func,
+    POCI_MEM_FREE    free_func
+);
+
 /**
  * @brief
  * Enable or disable Oracle warning notifications
@@ -1368,6 +1557,87 @@ OCI_SYM_PUBLIC boolean OCI_API OCI_SetStatementCacheSize
     unsigned int    value
 );
 
+/**
+ * @brief
+ * Return the maximum number of statements kept in the OCILIB prepared statement cache
+ *
+ * @param con  - Connection handle
+ *
+ * @note
+ * Default value is 0 (cache disabled)
+ *
+ */
+
+OCI_SYM_PUBLIC unsigned int OCI_API OCI_GetPreparedCacheSize
+(
+    OCI_Connection *con
+);
+
+/**
+ * @brief
+ * Set the maximum number of statements kept in the OCILIB prepared statement cache
+ *
+ * @param con   - Connection handle
+ * @param value - maximum number of statements in the cache (0 disables the cache)
+ *
+ * @note
+ * Unlike the OCI statement cache (see OCI_SetStatementCacheSize()) that only saves the server
+ * parse, the OCILIB prepared statement cache keeps fully initialized statement objects:
+ * - When OCI_StatementFree() is called, the statement is parked in the cache with its OCI handle,
+ *   its binds and its resultset defines
+ * - When a statement is prepared with the same SQL text, bind mode and bind allocation mode,
+ *   it takes over the parked statement state instead of preparing it again.
+ *   Its binds are retained and only values need to be set before executing it again.
+ *
+ * @note
+ * Only statements which binds are allocated by OCILIB (see OCI_SetBindAllocation() with
+ * OCI_BAM_INTERNAL) or statements without binds are cached.
+ * Statements with register binds (returning into), implicit resultsets, LONG or cursor binds
+ * or LONG columns are freed as usual.
+ *
+ * @note
+ * For statements taken from the cache, binding an existing bind name again updates the existing
+ * bind (as if OCI_AllowRebinding() was called). The datatype must not change.
+ *
+ * @note
+ * Lowering the cache size evicts the least recently parked statements. Setting it to 0 frees all
+ * parked statements (e.g. after DDL changing the columns of a cached query).
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_SYM_PUBLIC boolean OCI_API OCI_SetPreparedCacheSize
+(
+    OCI_Connection *con,
+    unsigned int    value
+);
+
+/**
+ * @brief
+ * Return statistics of the OCILIB prepared statement cache
+ *
+ * @param con   - Connection handle
+ * @param value - Value to retrieve
+ *
+ * @note
+ * Possible values are:
+ * - OCI_PCV_HITS   : number of prepare calls served from the cache
+ * - OCI_PCV_MISSES : number of prepare calls forwarded to OCI while the cache was enabled
+ * - OCI_PCV_SIZE   : number of statements currently parked in the cache
+ *
+ * @return
+ * Requested value on success otherwise 0
+ *
+ */
+
+OCI_SYM_PUBLIC big_uint OCI_API OCI_GetPreparedCacheValue
+(
+    OCI_Connection *con,
+    unsigned int    value
+);
+
 /**
  * @brief
  * Return the default LOB prefetch buffer size for the connection
@@ -1778,6 +2048,69 @@ OCI_SYM_PUBLIC boolean OCI_API OCI_PoolSetStatementCacheSize
     unsigned int value
 );
 
+/**
+ * @brief
+ * Run the partitions of a query concurrently over connections of the given pool
+ *
+ * @param pool          - Pool handle
+ * @param sql           - SELECT statement of a partition
+ * @param mode          - Partitioning mode
+ * @param nb_partitions - Number of partitions
+ * @param args          - Partitioning arguments (see below)
+ * @param fetch_size    - Fetch array size of partitions (0 for default)
+ * @param handler       - Row consumer
+ * @param ctx           - Pointer to user context passed to the consumer
+ *
+ * @note
+ * Possible values for parameter 'mode' :
+ *  - OCI_PQM_ROWID : rows are split in ranges of rowids holding the same number of blocks.
+ *    'args[0]' is the name of the table and the SQL statement must restrict its rows with
+ *    the binds :pq_low and :pq_high, e.g. "where rowid between :pq_low and :pq_high"
+ *  - OCI_PQM_HASH  : rows are split in hash buckets. 'args' is not used and the SQL statement
+ *    must restrict its rows with the binds :pq_bucket and :pq_max_bucket,
+ *    e.g. "where ora_hash(id, :pq_max_bucket) = :pq_bucket"
+ *  - OCI_PQM_RANGE : rows are split in user provided ranges. 'args' holds the low and high bounds
+ *    of each partition (2 * nb_partitions strings) bound to :pq_low and :pq_high,
+ *    e.g. "where id between :pq_low and :pq_high"
+ *
+ * @note
+ * Each partition runs on its own pooled connection and worker thread, within the limit of the
+ * pool maximum size. Remaining partitions are run by the first workers that complete.
+ * Rows of all partitions are fetched concurrently and handed to the consumer one at a time.
+ * Thus, the consumer does not need to be thread safe and at most 'nb_partitions' fetch arrays
+ * are held in memory.
+ *
+ * @note
+ * The resultset passed to the consumer is only valid during the call.
+ * The consumer can stop all partitions by returning FALSE.
+ *
+ * @note
+ * OCI_PQM_ROWID ranges are computed by the caller thread from the table extents found in
+ * USER_EXTENTS, each range holding the same number of blocks, without scanning the table.
+ * For tables not owned by the connected user or without allocated extents, ranges are computed
+ * with a single query using the NTILE() analytic function over the table rowids
+ *
+ * @warning
+ * OCILIB must be initialized with OCI_ENV_THREADED
+ *
+ * @return
+ * TRUE if all partitions have been run otherwise FALSE.
+ * The error of the first failed partition is reported with the error code OCI_ERR_PARALLEL_QUERY
+ *
+ */
+
+OCI_SYM_PUBLIC boolean OCI_API OCI_ParallelQuery
+(
+    OCI_Pool            *pool,
+    const otext         *sql,
+    unsigned int         mode,
+    unsigned int         nb_partitions,
+    const otext * const *args,
+    unsigned int         fetch_size,
+    POCI_PARALLEL_FETCH  handler,
+    void                *ctx
+);
+
 /**
  * @} OcilibCApiPools
  */
@@ -2134,6 +2467,13 @@ OCI_SYM_PUBLIC boolean OCI_API OCI_StatementFree
  * @note
  * Do not call this function for fetched statements (REF cursors)
  *
+ * @note
+ * When the statement is prepared again with the same SELECT statement, its resultset
+ * (column descriptions and fetch buffers) is kept. Once executed, columns are only checked
+ * against the new description and defined again. If the select list has changed
+ * (e.g. altered table), the resultset is fully described again.
+ * Resultsets with LONG, cursor, object or reference columns are always described again.
+ *
  * @return
  * TRUE on success otherwise FALSE
  */
@@ -2194,6 +2534,130 @@ OCI_SYM_PUBLIC boolean OCI_API OCI_ExecuteStmt
     const otext *  sql
 );
 
+/**
+ * @brief
+ * Execute a prepared SQL statement or PL/SQL block without blocking the calling thread
+ *
+ * @param stmt    - Statement handle
+ * @param handler - Completion callback (can be NULL)
+ * @param ctx     - User context pointer passed to the completion callback
+ *
+ * @note
+ * The execution is performed by a worker thread of the statement connection that
+ * calls OCI_Execute() and then the given completion callback.
+ * The worker thread is started by the first asynchronous call on the connection
+ * and runs all its asynchronous calls until the connection is freed.
+ * Thus, OCILIB must be initialized with the OCI_ENV_THREADED mode.
+ *
+ * @note
+ * Completion of the call can be either notified by the completion callback or
+ * checked with OCI_GetAsyncStatus() and OCI_WaitAsync().
+ *
+ * @note
+ * Only one call at a time runs on a connection. Starting an asynchronous call
+ * waits for the completion of any asynchronous call previously started on the
+ * same connection, unless started from its completion callback. In that case,
+ * the call is run by the same worker thread once the callback returns.
+ *
+ * @warning
+ * The completion callback and the global error handler are called from the worker thread.
+ * If OCILIB is initialized with the OCI_ENV_CONTEXT mode, OCI_GetLastError() called from
+ * the completion callback returns the error raised by the call.
+ *
+ * @warning
+ * The statement and its connection must not be used until the call is completed
+ *
+ * @return
+ * TRUE if the call has been started otherwise FALSE
+ *
+ */
+
+OCI_SYM_PUBLIC boolean OCI_API OCI_ExecuteAsync
+(
+    OCI_Statement *    stmt,
+    POCI_ASYNC_HANDLER handler,
+    void *             ctx
+);
+
+/**
+ * @brief
+ * Return the status of the last asynchronous call started for the given statement
+ *
+ * @param stmt - Statement handle
+ *
+ * @note
+ * Possible values are:
+ * - OCI_ACS_NONE      : No asynchronous call started for the statement
+ * - OCI_ACS_PENDING   : The call is running or its completion callback is not finished
+ * - OCI_ACS_COMPLETED : The call and its completion callback are finished
+ *
+ */
+
+OCI_SYM_PUBLIC unsigned int OCI_API OCI_GetAsyncStatus
+(
+    OCI_Statement *stmt
+);
+
+/**
+ * @brief
+ * Wait for the completion of the last asynchronous call started for the given statement
+ *
+ * @param stmt - Statement handle
+ *
+ * @note
+ * Called from a completion callback, it does not wait and only returns the call result.
+ *
+ * @return
+ * The value returned by the last asynchronous call started for the statement
+ *
+ */
+
+OCI_SYM_PUBLIC boolean OCI_API OCI_WaitAsync
+(
+    OCI_Statement *stmt
+);
+
+/**
+ * @brief
+ * Execute several prepared DML statements in a single server round trip
+ *
+ * @param con   - Connection handle
+ * @param stmts - Array of prepared statements
+ * @param count - Number of statements
+ * @param rows  - Array of count elements receiving the number of rows affected by each statement (optional)
+ *
+ * @note
+ * The statements, with their variables already bound, are executed in the given order within an
+ * anonymous PL/SQL block generated and executed by OCILIB. Their placeholders are renamed in
+ * the block in order to allow the same bind names in different statements.
+ *
+ * @note
+ * The statements must be INSERT, UPDATE, DELETE or MERGE statements prepared from the given
+ * connection, with variables bound by name. Array binds, returning into clauses, LONG and
+ * cursor binds are not supported.
+ *
+ * @note
+ * An error raised by a statement does not stop the execution of the next statements.
+ * OCI_GetBatchErrorCount() and OCI_GetBatchError() report the statement error and
+ * OCI_ErrorGetRow() returns the statement position (starting at 1) within the batch.
+ * The rows affected by a statement in error are reported as 0.
+ *
+ * @warning
+ * Placeholders within q'...' alternative quoting literals are not supported
+ *
+ * @return
+ * TRUE if all statements have been successfully executed otherwise FALSE
+ *
+ */
+
+OCI_SYM_PUBLIC boolean OCI_API OCI_ExecuteBatch
+(
+    OCI_Connection *con,
+    OCI_Statement **stmts,
+    unsigned int    count,
+    unsigned int   *rows
+);
+
 /**
  * @brief
  * Parse a SQL statement or PL/SQL block.
@@ -2298,6 +2762,48 @@ OCI_SYM_PUBLIC const otext * OCI_API OCI_GetSqlIdentifier
     OCI_Statement *stmt
 );
 
+/**
+ * @brief
+ * Return an execution statistic of the given statement
+ *
+ * @param stmt  - Statement handle
+ * @param value - Value to retrieve
+ *
+ * @note
+ * Possible values are:
+ * - OCI_SSV_PREPARE_COUNT : number of prepare calls
+ * - OCI_SSV_PREPARE_TIME  : time spent in prepare calls (microseconds)
+ * - OCI_SSV_EXECUTE_COUNT : number of execute calls
+ * - OCI_SSV_EXECUTE_TIME  : time spent in execute calls (microseconds)
+ * - OCI_SSV_FETCH_COUNT   : number of fetch calls
+ * - OCI_SSV_FETCH_TIME    : time spent in fetch calls (microseconds)
+ * - OCI_SSV_ROWS_FETCHED  : number of rows fetched
+ * - OCI_SSV_ROUND_TRIPS   : number of server round trips
+ * - OCI_SSV_BIND_BYTES    : size of the bind buffers sent by execute calls
+ * - OCI_SSV_DEFINE_BYTES  : size of the define buffers filled by fetch calls
+ *
+ * @note
+ * Statistics must be enabled by passing OCI_ENV_STATEMENT_STATS to OCI_Initialize().
+ * Otherwise this function returns 0.
+ *
+ * @note
+ * Statistics are reset each time a SQL statement is prepared.
+ * Times are wall clock times of the underlying OCI calls.
+ * Round trips are estimated from the number of execute and fetch calls and are thus an upper bound
+ * when rows are served from the client prefetch buffers.
+ * The average number of rows per fetch call is OCI_SSV_ROWS_FETCHED / OCI_SSV_FETCH_COUNT.
+ *
+ * @note
+ * Statistics are also aggregated per SQL statement at the environment level (see OCI_GetSqlStatsValue())
+ *
+ */
+
+OCI_SYM_PUBLIC big_uint OCI_API OCI_GetStatementStats
+(
+    OCI_Statement *stmt,
+    unsigned int   value
+);
+
 /**
  * @brief
  * Return the error position (in terms of characters) in the SQL statement
@@ -2550,6 +3056,44 @@ OCI_SYM_PUBLIC unsigned int OCI_API OCI_BindArrayGetSize
     OCI_Statement *stmt
 );
 
+/**
+ * @brief
+ * Execute an array DML statement in chunks filled from a user row source
+ *
+ * @param stmt - Statement handle
+ * @param fill - Row source callback filling the bound arrays
+ * @param ctx  - User context pointer passed to the callback
+ *
+ * @note
+ * This call allows executing an array DML statement with any number of rows while
+ * only allocating bind arrays for a single chunk. The chunk size is the array size set
+ * with OCI_BindArraySetSize() before binding the arrays.
+ *
+ * @note
+ * Until it returns 0, the callback is called to fill the bound arrays from index 0
+ * with the next rows and the statement is executed for the number of rows it returned.
+ *
+ * @note
+ * Errors raised by rows of a chunk do not stop the execution of the next chunks.
+ * Once all chunks are executed, OCI_GetBatchErrorCount() and OCI_GetBatchError()
+ * report the errors of all chunks and OCI_ErrorGetRow() returns the global row
+ * position (starting at 1) within the stream.
+ *
+ * @note
+ * OCI_GetAffectedRows() returns the number of rows affected by the last chunk.
+ *
+ * @return
+ * TRUE if all rows have been successfully executed otherwise FALSE
+ *
+ */
+
+OCI_SYM_PUBLIC boolean OCI_API OCI_ExecuteArrayStream
+(
+    OCI_Statement  *stmt,
+    POCI_ARRAY_FILL fill,
+    void           *ctx
+);
+
 /**
  * @brief
  * Allow different host variables to be binded using the same bind name or
@@ -4180,6 +4724,61 @@ OCI_SYM_PUBLIC unsigned int OCI_API OCI_BindGetDataSizeAtPos
     unsigned int position
 );
 
+/**
+ * @brief
+ * Set the actual sizes of the first elements of the bind input array in a single call
+ *
+ * @param bnd   - bind handle
+ * @param sizes - Array of sizes
+ * @param count - Number of sizes to set (from position 1)
+ *
+ * @note
+ * This is the vectored version of OCI_BindSetDataSizeAtPos() for array binds.
+ * See OCI_BindSetDataSize() for supported data types
+ *
+ * @warning
+ * For binds of type OCI_CDT_TEXT (strings), sizes are expressed in number of characters.
+ * A size of 0 is allowed and sets an empty value.
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_SYM_PUBLIC boolean OCI_API OCI_BindSetDataSizes
+(
+    OCI_Bind *          bnd,
+    const unsigned int *sizes,
+    unsigned int        count
+);
+
+/**
+ * @brief
+ * Retrieve the actual sizes of the first elements of the bind array in a single call
+ *
+ * @param bnd   - bind handle
+ * @param sizes - Array receiving the sizes
+ * @param count - Number of sizes to retrieve (from position 1)
+ *
+ * @note
+ * This is the vectored version of OCI_BindGetDataSizeAtPos() for array binds.
+ * See OCI_BindSetDataSize() for supported data types
+ *
+ * @warning
+ * For binds of type OCI_CDT_TEXT (strings), sizes are expressed in number of characters.
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_SYM_PUBLIC boolean OCI_API OCI_BindGetDataSizes
+(
+    OCI_Bind *    bnd,
+    unsigned int *sizes,
+    unsigned int  count
+);
+
 /**
  * @brief
  * Set the bind variable to null
@@ -4376,6 +4975,88 @@ OCI_SYM_PUBLIC unsigned int OCI_API OCI_BindGetAllocationMode
     OCI_Bind *bnd
 );
 
+/**
+ * @brief
+ * Get the big integer bind mode of a bind handle
+ *
+ * @param bnd - Bind handle
+ *
+ * @note
+ * Possible values are :
+ *  - OCI_BIM_NUMBER : values are converted to Oracle NUMBER buffers by OCILIB
+ *  - OCI_BIM_NATIVE : values are bound as native 64 bits integers
+ *
+ * return the big integer mode for big_int and big_uint binds otherwise OCI_UNKNOWN
+ *
+ */
+
+OCI_SYM_PUBLIC unsigned int OCI_API OCI_BindGetBigIntMode
+(
+    OCI_Bind *bnd
+);
+
+/**
+ * @brief
+ * Use a user provided array as the null indicators array of a bind
+ *
+ * @param bnd  - Bind handle
+ * @param inds - Array of indicators
+ *
+ * @note
+ * The array must contain at least as many elements as the bind and remain valid
+ * until the statement is freed, prepared again or the bind is rebound.
+ * A value of -1 marks the element as null and a value of 0 as not null.
+ * OCI_BindSetNullAtPos() and OCI_BindSetNotNullAtPos() update this array.
+ *
+ * @note
+ * This allows to provide null information for large array DML without per element calls.
+ * It is only supported for user binds of numeric, string, raw and boolean scalar types
+ * (OCI_Number binds and OCILIB handle based types are not supported).
+ *
+ * @warning
+ * Rebinding a variable with OCI_AllowRebinding() restores the internal indicators array
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_SYM_PUBLIC boolean OCI_API OCI_BindSetIndicatorArray
+(
+    OCI_Bind *bnd,
+    short    *inds
+);
+
+/**
+ * @brief
+ * Use a user provided array as the actual data lengths array of a string or raw bind
+ *
+ * @param bnd  - Bind handle
+ * @param lens - Array of lengths in bytes
+ *
+ * @note
+ * Lengths are expressed in bytes as seen by OCI and include the null terminator for strings.
+ * The array must contain at least as many elements
+ * as the bind and remain valid until the statement is freed, prepared again or the bind is rebound.
+ * Output values are updated by OCI in this array.
+ *
+ * @note
+ * For string binds, OCILIB does not reset anymore lengths before each execution.
+ *
+ * @warning
+ * Rebinding a variable with OCI_AllowRebinding() restores the internal lengths array
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_SYM_PUBLIC boolean OCI_API OCI_BindSetLengthArray
+(
+    OCI_Bind       *bnd,
+    unsigned short *lens
+);
+
 /**
  * @} OcilibCApiBinding
  */
@@ -4441,6 +5122,15 @@ OCI_SYM_PUBLIC unsigned int OCI_API OCI_BindGetAllocationMode
  * Resultsets are 'forward only' by default. Call OCI_SetFetchMode() with
  * OCI_SFM_SCROLLABLE to enable scrollable resultsets for a given statement.
  *
+ * @par Block access
+ *
+ * Rows are fetched by arrays holding the values of each column for all fetched rows.
+ * OCI_FetchBlock() moves to the next array of rows and OCI_GetColumnBlock() gives read-only
+ * access to the buffers of a column for these rows, without any per cell call.
+ *
+ * OCI_ResultsetToArrow() exports blocks as Apache Arrow record batches using the Arrow C data
+ * interface, without any dependency on an Arrow library.
+ *
  * @warning
  * Any use of scrollable fetching functions with a resultset that depends on a
  * statement with fetch mode set to OCI_SFM_DEFAULT will fail !
@@ -4514,90 +5204,264 @@ OCI_SYM_PUBLIC unsigned int OCI_API OCI_BindGetAllocationMode
  * @par Fetch Example
  * @include fetch.c
  *
- * @par Fetch Rows into user structures Example
- * @include fetch_struct.c
+ * @par Fetch Rows into user structures Example
+ * @include fetch_struct.c
+ *
+ * @par Meta data Example
+ * @include meta.c
+ *
+ * @par Ref cursor Example
+ * @include cursor.c
+ *
+ * @par Implicit resultset Example
+ * @include implicit_resultset.c
+ *
+ * @par Scrollable resultset Example
+ * @include scroll.c
+ *
+ */
+
+/**
+ * @brief
+ * Retrieve the resultset handle from an executed statement
+ *
+ * @param stmt - Statement handle
+ *
+ * @note
+ * See @ref OcilibCApiFetching for more details about what statements can return resultsets
+ *
+ * @warning
+ * If the statement has not been prepared and executed, no resultset will be  returned
+ *
+ * @return
+ * A resultset handle on success otherwise NULL
+ *
+ */
+
+OCI_SYM_PUBLIC OCI_Resultset * OCI_API OCI_GetResultset
+(
+    OCI_Statement *stmt
+);
+
+/**
+ * @brief
+ * Free the statement resultsets
+ *
+ * @param stmt - Statement handle
+ *
+ * @note
+ * This call is optional. Resultsets are automatically freed when the
+ * statement is destroyed or when it's reused.
+ *
+ * @note
+ * This function has been introduced for releasing big resultsets when the
+ * application wants to keep the statement alive and does not know when it
+ * will be destroyed.
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_SYM_PUBLIC boolean OCI_API OCI_ReleaseResultsets
+(
+    OCI_Statement *stmt
+);
+
+/**
+ * @brief
+ * Fetch the next row of the resultset
+ *
+ * @param rs - Resultset handle
+ *
+ * @note
+ * OCI_FetchNext() works for normal and scrollable resultsets
+ *
+ * @return
+ * TRUE on success otherwise FALSE if :
+ * - Empty resultset
+ * - Last row already fetched
+ * - An error occurred
+ *
+ */
+
+OCI_SYM_PUBLIC boolean OCI_API OCI_FetchNext
+(
+    OCI_Resultset *rs
+);
+
+/**
+ * @brief
+ * Fetch the next row of the resultset without blocking the calling thread
  *
- * @par Meta data Example
- * @include meta.c
+ * @param rs      - Resultset handle
+ * @param handler - Completion callback (can be NULL)
+ * @param ctx     - User context pointer passed to the completion callback
  *
- * @par Ref cursor Example
- * @include cursor.c
+ * @note
+ * The fetch is performed by a worker thread of the statement connection that calls
+ * OCI_FetchNext() and then the completion callback with the value it returned.
+ * Starting the next fetch from the completion callback runs it on the same thread.
  *
- * @par Implicit resultset Example
- * @include implicit_resultset.c
+ * @note
+ * See OCI_ExecuteAsync() for asynchronous calls requirements and completion handling
  *
- * @par Scrollable resultset Example
- * @include scroll.c
+ * @return
+ * TRUE if the call has been started otherwise FALSE
  *
  */
 
+OCI_SYM_PUBLIC boolean OCI_API OCI_FetchNextAsync
+(
+    OCI_Resultset *    rs,
+    POCI_ASYNC_HANDLER handler,
+    void *             ctx
+);
+
 /**
  * @brief
- * Retrieve the resultset handle from an executed statement
+ * Fetch the next block of rows of the resultset
  *
- * @param stmt - Statement handle
+ * @param rs    - Resultset handle
+ * @param nrows - Pointer to the number of rows of the block
  *
  * @note
- * See @ref OcilibCApiFetching for more details about what statements can return resultsets
+ * A block is made of the rows of the last internal fetch that have not been consumed yet.
+ * When all rows have been consumed, the next rows are fetched from the server.
+ * The number of rows per block is then up to the statement fetch size.
  *
- * @warning
- * If the statement has not been prepared and executed, no resultset will be  returned
+ * @note
+ * The current row becomes the last row of the block. Thus OCI_FetchNext() and OCI_FetchBlock()
+ * can be mixed and OCI_GetXXX() calls made after OCI_FetchBlock() return values of the last row of the block.
+ *
+ * @note
+ * Blocks are only available for resultsets created from SELECT statements.
  *
  * @return
- * A resultset handle on success otherwise NULL
+ * TRUE if a block of rows is available, FALSE if the end of the resultset is reached
+ * or an error occurred
  *
  */
 
-OCI_SYM_PUBLIC OCI_Resultset * OCI_API OCI_GetResultset
+OCI_SYM_PUBLIC boolean OCI_API OCI_FetchBlock
 (
-    OCI_Statement *stmt
+    OCI_Resultset *rs,
+    unsigned int  *nrows
 );
 
 /**
  * @brief
- * Free the statement resultsets
+ * Return the number of rows of the current block
  *
- * @param stmt - Statement handle
+ * @param rs - Resultset handle
  *
  * @note
- * This call is optional. Resultsets are automatically freed when the
- * statement is destroyed or when it's reused.
+ * It returns the value returned by the last call to OCI_FetchBlock() as long as no other
+ * rows have been fetched from the server, 0 otherwise
+ *
+ */
+
+OCI_SYM_PUBLIC unsigned int OCI_API OCI_GetBlockRowCount
+(
+    OCI_Resultset *rs
+);
+
+/**
+ * @brief
+ * Return the buffers of a given column for the rows of the current block
+ *
+ * @param rs    - Resultset handle
+ * @param index - Column position
+ * @param data  - Pointer to the column values of the first row of the block (can be NULL)
+ * @param size  - Pointer to the size in bytes of a value in the data array (can be NULL)
+ * @param inds  - Pointer to the null indicators of the block rows (can be NULL)
+ * @param lens  - Pointer to the lengths in bytes of the block rows values (can be NULL)
  *
  * @note
- * This function has been introduced for releasing big resultsets when the
- * application wants to keep the statement alive and does not know when it
- * will be destroyed.
+ * Returned arrays hold OCI_FetchBlock() rows. Values of the row n are located at
+ * ((const char *) data) + n * size, inds[n] and lens[n]. A value is null when its indicator is -1.
+ *
+ * @note
+ * Values are stored in their internal format:
+ * - Numeric columns: OCI Number content (see OCI_NumberSetContent()), or float and double values for
+ *   BINARY_FLOAT and BINARY_DOUBLE columns (see OCI_ColumnGetSubType())
+ * - Character columns: null terminated strings
+ * - RAW columns: bytes
+ * - DATE columns: OCI dates
+ * - Other columns: handles or descriptors
+ *
+ * @note
+ * Arrays are read-only and are valid until the next fetch call on the resultset.
  *
  * @return
  * TRUE on success otherwise FALSE
  *
  */
 
-OCI_SYM_PUBLIC boolean OCI_API OCI_ReleaseResultsets
+OCI_SYM_PUBLIC boolean OCI_API OCI_GetColumnBlock
 (
-    OCI_Statement *stmt
+    OCI_Resultset         *rs,
+    unsigned int           index,
+    const void           **data,
+    unsigned int          *size,
+    const short          **inds,
+    const unsigned short **lens
 );
 
 /**
  * @brief
- * Fetch the next row of the resultset
+ * Export the resultset description and the current block of rows using the Apache Arrow C data interface
  *
- * @param rs - Resultset handle
+ * @param rs     - Resultset handle
+ * @param schema - Pointer to the Arrow schema to fill with the resultset description (can be NULL)
+ * @param array  - Pointer to the Arrow array to fill with the current block rows (can be NULL)
  *
  * @note
- * OCI_FetchNext() works for normal and scrollable resultsets
+ * The schema describes a struct with one child field per column and the array holds the rows
+ * of the block returned by the last call to OCI_FetchBlock() as a record batch
+ *
+ * @note
+ * Columns are mapped as follows:
+ * - NUMBER(p, 0) with p <= 18 : int64
+ * - NUMBER(p, s) with p <= 38 : decimal128(p, s)
+ * - NUMBER without precision, FLOAT, BINARY_DOUBLE : float64
+ * - BINARY_FLOAT : float32
+ * - PL/SQL integers : int32 or uint32
+ * - BOOLEAN : boolean
+ * - CHAR, VARCHAR2, NCHAR, NVARCHAR2 : utf8
+ * - RAW : binary
+ * - DATE : timestamp (seconds)
+ * - TIMESTAMP : timestamp (microseconds)
+ * - TIMESTAMP WITH (LOCAL) TIME ZONE : timestamp (microseconds) in UTC
+ *
+ * Null values are exported in validity bitmaps built from the column indicators.
+ *
+ * @note
+ * In ANSI builds, character columns are exported as they are and the Oracle client character
+ * set must be UTF8 (NLS_LANG). In Unicode builds, they are converted to UTF8.
+ *
+ * @note
+ * Exported data is copied from the fetch buffers and allocated with the C runtime allocator.
+ * It is owned by the caller that must call the release callback of the schema and array
+ * structures once done. It remains valid after subsequent fetches and after OCI_Cleanup().
+ *
+ * @warning
+ * An error is raised if:
+ * - the resultset has a column of any other type
+ * - the resultset holds the rows of a DML returning statement
+ * - an array is requested without any current block
+ * - the character or binary data of a column exceeds 2GB for the block
  *
  * @return
- * TRUE on success otherwise FALSE if :
- * - Empty resultset
- * - Last row already fetched
- * - An error occurred
+ * TRUE on success otherwise FALSE
  *
  */
 
-OCI_SYM_PUBLIC boolean OCI_API OCI_FetchNext
+OCI_SYM_PUBLIC boolean OCI_API OCI_ResultsetToArrow
 (
-    OCI_Resultset *rs
+    OCI_Resultset      *rs,
+    struct ArrowSchema *schema,
+    struct ArrowArray  *array
 );
 
 /**
@@ -8444,6 +9308,58 @@ OCI_SYM_PUBLIC unsigned int OCI_API OCI_GetBindAllocation
     OCI_Statement *stmt
 );
 
+/**
+ * @brief
+ * Set the current big integer bind mode that will be used for subsequent binding calls
+ *
+ * @param stmt - Statement handle
+ * @param mode - big integer bind mode value
+ *
+ * @note
+ * Possible values are :
+ *  - OCI_BIM_NUMBER : big_int and big_uint values are converted to and from Oracle NUMBER buffers by OCILIB
+ *  - OCI_BIM_NATIVE : big_int and big_uint values are sent as native 64 bits integers and converted by the server
+ *
+ * @note
+ * This mode applies to OCI_BindBigInt(), OCI_BindUnsignedBigInt(), OCI_BindArrayOfBigInts()
+ * and OCI_BindArrayOfUnsignedBigInts().
+ * With OCI_BIM_NATIVE, user variables are directly bound to OCI with no intermediate buffers
+ * and no per row conversion at each execution. This is the fastest mode for large array DML.
+ * It requires an Oracle client 11gR2 or above.
+ *
+ * @warning
+ * When calling an OCI_BindXXXX() call, this value is used and stored in the OCI_Bind object created during the bind call.
+ * OCI_SetBindBigIntMode() can be called before each binding call if needed.
+ * Each bind mode is returned by OCI_BindGetBigIntMode()
+ *
+ */
+
+OCI_SYM_PUBLIC boolean OCI_API OCI_SetBindBigIntMode
+(
+    OCI_Statement *stmt,
+    unsigned int   mode
+);
+
+/**
+ * @brief
+ * Return the current big integer bind mode used for subsequent binding calls
+ *
+ * @param stmt - Statement handle
+ *
+ * @note
+ * See OCI_SetBindBigIntMode() for possible values
+ * Default value is OCI_BIM_NUMBER
+ *
+ * @note
+ * if stmt is NULL, the return value is OCI_UNKNOWN
+ *
+ */
+
+OCI_SYM_PUBLIC unsigned int OCI_API OCI_GetBindBigIntMode
+(
+    OCI_Statement *stmt
+);
+
 /**
  * @brief
  * Set the number of rows fetched per internal server fetch call
@@ -8564,6 +9480,107 @@ OCI_SYM_PUBLIC unsigned int OCI_API OCI_GetPrefetchMemory
     OCI_Statement *stmt
 );
 
+/**
+ * @brief
+ * Set the amount of memory the fetch buffers of the statement resultsets can use
+ *
+ * @param stmt - Statement handle
+ * @param size - memory budget in bytes (0 to disable)
+ *
+ * @note
+ * Default value is 0 and resultsets fetch OCI_GetFetchSize() rows per call.
+ *
+ * @note
+ * When a budget is set, the fetch buffers are sized from the described row width
+ * (buffers, indicators and lengths of all columns) to hold as many rows as the budget allows.
+ * Forward only resultsets start fetching OCI_GetFetchSize() rows and double the number of
+ * rows per fetch call while the observed throughput improves, up to the budget.
+ * Scrollable resultsets always fetch the number of rows allowed by the budget.
+ *
+ * @note
+ * The budget is applied to resultsets created by subsequent executions.
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_SYM_PUBLIC boolean OCI_API OCI_SetFetchMemory
+(
+    OCI_Statement *stmt,
+    unsigned int   size
+);
+
+/**
+ * @brief
+ * Return the amount of memory the fetch buffers of the statement resultsets can use
+ *
+ * @param stmt - Statement handle
+ *
+ * @note
+ * Default value is 0
+ *
+ */
+
+OCI_SYM_PUBLIC unsigned int OCI_API OCI_GetFetchMemory
+(
+    OCI_Statement *stmt
+);
+
+/**
+ * @brief
+ * Enable or disable fetching rows in background
+ *
+ * @param stmt  - Statement handle
+ * @param value - Enable/disable read-ahead
+ *
+ * @note
+ * When enabled, once a block of rows is fetched, the next block is fetched by a
+ * helper thread into a second set of buffers while the application consumes the current one.
+ * OCI_FetchNext() then switches buffers when it reaches the end of the current block.
+ * The helper thread is started by the first read-ahead fetch and lives until the
+ * resultset is freed.
+ * It overlaps network latency and client side processing.
+ *
+ * @note
+ * Read-ahead requires OCILIB to be initialized with OCI_ENV_THREADED.
+ * It applies to forward only resultsets of subsequent executions whose columns
+ * are all numeric, character, raw, date, timestamp, interval or boolean columns.
+ * Other resultsets are fetched synchronously.
+ *
+ * @note
+ * Default value is FALSE
+ *
+ * @warning
+ * Read-ahead doubles the memory used for fetch buffers.
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_SYM_PUBLIC boolean OCI_API OCI_SetReadAhead
+(
+    OCI_Statement *stmt,
+    boolean        value
+);
+
+/**
+ * @brief
+ * Return TRUE if rows are fetched in background otherwise FALSE
+ *
+ * @param stmt - Statement handle
+ *
+ * @note
+ * Default value is FALSE
+ *
+ */
+
+OCI_SYM_PUBLIC boolean OCI_API OCI_GetReadAhead
+(
+    OCI_Statement *stmt
+);
+
 /**
  * @brief
  * Set the piece size for dynamic fetch operations (XMLTYPE, LONGs) 
@@ -13595,6 +14612,35 @@ OCI_SYM_PUBLIC boolean OCI_API OCI_TypeInfoFree
     OCI_TypeInfo *typinf
 );
 
+/**
+ * @brief
+ * Invalidate type info descriptions kept in the environment wide type info cache
+ *
+ * @param name - Name of the object (optionally prefixed by its schema) or NULL for all objects
+ *
+ * @note
+ * The type info cache is enabled by passing OCI_ENV_TYPEINFO_CACHE to OCI_Initialize().
+ * When enabled, the description of an object retrieved by a connection is shared by all
+ * connections (standalone or from pools) using the same database and user.
+ * Other connections build their type info objects from the shared description instead
+ * of performing their own describe round trips.
+ *
+ * @note
+ * If no schema is provided, the object is invalidated for all schemas.
+ * Invalidation only affects type info objects retrieved afterwards. Type info objects already
+ * retrieved by a connection remain valid until the connection is freed.
+ * This call should be made after altering or recreating a type or table.
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_SYM_PUBLIC boolean OCI_API OCI_TypeInfoInvalidate
+(
+    const otext *name
+);
+
 /**
  * @brief
  * Return the number of columns of a table/view/object
@@ -13764,6 +14810,11 @@ OCI_SYM_PUBLIC OCI_TypeInfo * OCI_API OCI_TypeInfoGetSuperType
  * - '%o'  : (OCI_Object *) -----> Object  (not implemented yet)
  * - '%c'  : (OCI_Coll *) -------> collection  (not implemented yet)
  *
+ * @note
+ * By default, input values are formatted as SQL literals.
+ * Thus each distinct value produces a distinct SQL text that the server has to hard parse.
+ * Use OCI_SetFormatParameterMode() with OCI_FPM_BIND to have values bound instead.
+ *
  * @par Example
  * @include format.c
  *
@@ -13934,6 +14985,66 @@ OCI_SYM_PUBLIC boolean OCI_DescribeFmt
     ...
 );
 
+/**
+ * @brief
+ * Set the way input values are passed to the server by formatted functions
+ *
+ * @param stmt - Statement handle
+ * @param mode - format parameter mode
+ *
+ * @note
+ * Possible values are :
+ *  - OCI_FPM_LITERAL : values are formatted as SQL literals into the SQL text
+ *  - OCI_FPM_BIND    : placeholders are replaced by generated bind variables and values are bound
+ *
+ * @note
+ * This mode applies to OCI_PrepareFmt(), OCI_ExecuteStmtFmt(), OCI_ParseFmt() and OCI_DescribeFmt().
+ * With OCI_FPM_BIND, the SQL text does not depend on the input values anymore.
+ * Thus the server and the OCI statement cache can share the same cursor for all calls.
+ *
+ * @note
+ * With OCI_FPM_BIND :
+ *  - '%m' and '%r' identifiers are still formatted into the SQL text
+ *  - Other identifiers are replaced by bind variables named :p1, :p2, ... in order of appearance
+ *  - '%t', '%p', '%v' and '%n' values are bound as strings and converted with TO_DATE(),
+ *    TO_TIMESTAMP(), TO_DSINTERVAL() / TO_YMINTERVAL() and TO_NUMBER() using fixed formats
+ *  - NULL strings and handles are bound as NULL values
+ *  - Bound values are copied and remain valid until the statement is prepared again or freed
+ *
+ * @warning
+ * With OCI_FPM_BIND, the SQL text must not contain user bind variables named :p1, :p2, ...
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_SYM_PUBLIC boolean OCI_API OCI_SetFormatParameterMode
+(
+    OCI_Statement *stmt,
+    unsigned int   mode
+);
+
+/**
+ * @brief
+ * Return the way input values are passed to the server by formatted functions
+ *
+ * @param stmt - Statement handle
+ *
+ * @note
+ * See OCI_SetFormatParameterMode() for possible values
+ * Default value is OCI_FPM_LITERAL
+ *
+ * @note
+ * if stmt is NULL, the return value is OCI_UNKNOWN
+ *
+ */
+
+OCI_SYM_PUBLIC unsigned int OCI_API OCI_GetFormatParameterMode
+(
+    OCI_Statement *stmt
+);
+
 /**
  * @} OcilibCApiFormatting
  */
@@ -13961,16 +15072,20 @@ OCI_SYM_PUBLIC boolean OCI_DescribeFmt
  * @par Internal conception
  *
  * - The hash table is composed of an array of slots.
- * - Each slot can hold a linked list of entries (one per key)
+ * - Each slot can hold one entry (one per key)
  * - Each entry can hold a linked list of values
  *
  * @note
  * - The internal hash function computes the index in the array where the entry
- *   has to be inserted/looked up.
+ *   has to be inserted/looked up. Keys are case insensitive.
  *
  *
  * @note
- * Collisions are handled by chaining method.
+ * Collisions are handled by open addressing (linear probing).
+ * The table grows automatically when it is 75% full.
+ * Thus, OCI_HashGetSize() may return a value greater than the size given to OCI_HashCreate()
+ * and entries returned by OCI_HashLookup() or OCI_HashGetEntry() are only valid until the next
+ * insertion of a new key
  *
  * @include hash.c
  *
@@ -125,8 +125,10 @@
 #define OCI_ERR_XA_CONN_FROM_STRING         29
 #define OCI_ERR_BIND_EXTERNAL_NOT_ALLOWED   30
 #define OCI_ERR_UNFREED_BYTES               31
+#define OCI_ERR_ALREADY_INITIALIZED         32
+#define OCI_ERR_PARALLEL_QUERY              33
 
-#define OCI_ERR_COUNT                       32
+#define OCI_ERR_COUNT                       34
 
 /* Public OCILIB handles */
 
@@ -170,6 +172,37 @@
 #define OCI_MEM_OCILIB                      2
 #define OCI_MEM_ALL                         (OCI_MEM_ORACLE | OCI_MEM_OCILIB)
 
+/* memory profile values */
+
+#define OCI_MPV_BYTES                       1
+#define OCI_MPV_COUNT                       2
+#define OCI_MPV_PEAK                        3
+
+/* descriptor pool values */
+
+#define OCI_DPV_HITS                        1
+#define OCI_DPV_MISSES                      2
+#define OCI_DPV_SIZE                        3
+
+/* prepared statement cache values */
+
+#define OCI_PCV_HITS                        1
+#define OCI_PCV_MISSES                      2
+#define OCI_PCV_SIZE                        3
+
+/* statement statistics values */
+
+#define OCI_SSV_PREPARE_COUNT               1
+#define OCI_SSV_PREPARE_TIME                2
+#define OCI_SSV_EXECUTE_COUNT               3
+#define OCI_SSV_EXECUTE_TIME                4
+#define OCI_SSV_FETCH_COUNT                 5
+#define OCI_SSV_FETCH_TIME                  6
+#define OCI_SSV_ROWS_FETCHED                7
+#define OCI_SSV_ROUND_TRIPS                 8
+#define OCI_SSV_BIND_BYTES                  9
+#define OCI_SSV_DEFINE_BYTES                10
+
 /* binding */
 
 #define OCI_BIND_BY_POS                     0
@@ -249,6 +282,12 @@
 #define OCI_ENV_THREADED                    1
 #define OCI_ENV_CONTEXT                     2
 #define OCI_ENV_EVENTS                      4
+#define OCI_ENV_NO_MEMORY_STATS             8
+#define OCI_ENV_MEMORY_ARENA                16
+#define OCI_ENV_MEMORY_PROFILING            32
+#define OCI_ENV_DESCRIPTOR_POOL             64
+#define OCI_ENV_TYPEINFO_CACHE              128
+#define OCI_ENV_STATEMENT_STATS             256
 
 /* sessions modes */
 
@@ -338,6 +377,33 @@
 #define OCI_BAM_EXTERNAL                    1
 #define OCI_BAM_INTERNAL                    2
 
+/* big integer bind mode */
+
+#define OCI_BIM_NUMBER                      1
+#define OCI_BIM_NATIVE                      2
+
+/* formatted functions parameter mode */
+
+#define OCI_FPM_LITERAL                     1
+#define OCI_FPM_BIND                        2
+
+/* parallel query partitioning modes */
+
+#define OCI_PQM_ROWID                       1
+#define OCI_PQM_HASH                        2
+#define OCI_PQM_RANGE                       3
+
+/* asynchronous call types */
+
+#define OCI_ACT_EXECUTE                     1
+#define OCI_ACT_FETCH                       2
+
+/* asynchronous call status */
+
+#define OCI_ACS_NONE                        0
+#define OCI_ACS_PENDING                     1
+#define OCI_ACS_COMPLETED                   2
+
 /* bind direction mode */
 
 #define OCI_BDM_IN                          1
@@ -52,6 +52,7 @@
 #include <string.h>
 #include <time.h>
 #include <limits.h>
+#include <stdint.h>
 
 /* --------------------------------------------------------------------------------------------- *
  * MS Windows platform detection
@@ -546,6 +546,79 @@ typedef void (*POCI_THREADKEYDEST)
     void *data
 );
 
+/**
+ * @var POCI_ARRAY_FILL
+ *
+ * @brief
+ * Array DML row source prototype used by OCI_ExecuteArrayStream()
+ *
+ * @param stmt   - Statement handle
+ * @param offset - Global index of the first row of the chunk to fill
+ * @param size   - Maximum number of rows to fill (bind array size)
+ * @param ctx    - Pointer passed to OCI_ExecuteArrayStream()
+ *
+ * @return
+ * User callback should return the number of rows written into the bound arrays
+ * (from index 0) or 0 when there are no more rows to execute
+ *
+ */
+
+typedef unsigned int (*POCI_ARRAY_FILL)
+(
+    OCI_Statement *stmt,
+    unsigned int   offset,
+    unsigned int   size,
+    void *         ctx
+);
+
+/**
+ * @var POCI_PARALLEL_FETCH
+ *
+ * @brief
+ * Parallel query row consumer prototype used by OCI_ParallelQuery()
+ *
+ * @param rs        - Resultset of the partition positioned on the fetched row
+ * @param partition - Index of the partition (starting at 1)
+ * @param ctx       - Pointer passed to OCI_ParallelQuery()
+ *
+ * @return
+ * User callback should return TRUE to continue or FALSE to stop all partitions
+ *
+ */
+
+typedef boolean (*POCI_PARALLEL_FETCH)
+(
+    OCI_Resultset *rs,
+    unsigned int   partition,
+    void *         ctx
+);
+
+/**
+ * @var POCI_ASYNC_HANDLER
+ *
+ * @brief
+ * Asynchronous call completion callback prototype.
+ *
+ * @param stmt   - Statement handle
+ * @param type   - Type of the completed call
+ * @param result - Value returned by the call
+ * @param ctx    - Pointer passed to OCI_ExecuteAsync() or OCI_FetchNextAsync()
+ *
+ * @note
+ * Possible values for parameter 'type' :
+ *  - OCI_ACT_EXECUTE : OCI_Execute() call started by OCI_ExecuteAsync()
+ *  - OCI_ACT_FETCH   : OCI_FetchNext() call started by OCI_FetchNextAsync()
+ *
+ */
+
+typedef void (*POCI_ASYNC_HANDLER)
+(
+    OCI_Statement *stmt,
+    unsigned int   type,
+    boolean        result,
+    void *         ctx
+);
+
 /**
  * @var POCI_NOTIFY
  *
@@ -561,6 +634,53 @@ typedef void (*POCI_NOTIFY)
     OCI_Event *event
 );
 
+/**
+ * @var POCI_MEM_ALLOC
+ *
+ * @brief
+ * Memory allocation procedure prototype (same semantics as malloc())
+ *
+ * @param size - Number of bytes to allocate
+ *
+ */
+
+typedef void * (*POCI_MEM_ALLOC)
+(
+    size_t size
+);
+
+/**
+ * @var POCI_MEM_REALLOC
+ *
+ * @brief
+ * Memory reallocation procedure prototype (same semantics as realloc())
+ *
+ * @param ptr  - Pointer to the memory block to resize
+ * @param size - New size in bytes
+ *
+ */
+
+typedef void * (*POCI_MEM_REALLOC)
+(
+    void  *ptr,
+    size_t size
+);
+
+/**
+ * @var POCI_MEM_FREE
+ *
+ * @brief
+ * Memory release procedure prototype (same semantics as free())
+ *
+ * @param ptr - Pointer to the memory block to release
+ *
+ */
+
+typedef void (*POCI_MEM_FREE)
+(
+    void *ptr
+);
+
 /**
  * @var POCI_NOTIFY_AQ
  *
@@ -743,6 +863,74 @@ typedef struct OCI_HashEntry
     struct OCI_HashEntry *next;
 } OCI_HashEntry;
 
+/**
+ * @struct ArrowSchema
+ *
+ * @brief
+ * Apache Arrow C data interface schema description
+ *
+ * Definition of the Arrow C data interface ABI used by OCI_ResultsetToArrow().
+ * It is only defined if not already provided by an Arrow implementation header.
+ *
+ */
+
+/**
+ * @struct ArrowArray
+ *
+ * @brief
+ * Apache Arrow C data interface array data
+ *
+ * Definition of the Arrow C data interface ABI used by OCI_ResultsetToArrow().
+ * It is only defined if not already provided by an Arrow implementation header.
+ *
+ */
+
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE           2
+#define ARROW_FLAG_MAP_KEYS_SORTED    4
+
+struct ArrowSchema
+{
+    /* array type description */
+    const char *          format;
+    const char *          name;
+    const char *          metadata;
+    int64_t               flags;
+    int64_t               n_children;
+    struct ArrowSchema ** children;
+    struct ArrowSchema *  dictionary;
+
+    /* release callback */
+    void (*release)(struct ArrowSchema *);
+
+    /* opaque producer specific data */
+    void *private_data;
+};
+
+struct ArrowArray
+{
+    /* array data description */
+    int64_t              length;
+    int64_t              null_count;
+    int64_t              offset;
+    int64_t              n_buffers;
+    int64_t              n_children;
+    const void **        buffers;
+    struct ArrowArray ** children;
+    struct ArrowArray *  dictionary;
+
+    /* release callback */
+    void (*release)(struct ArrowArray *);
+
+    /* opaque producer specific data */
+    void *private_data;
+};
+
+#endif /* ARROW_C_DATA_INTERFACE */
+
 /**
  * @} OcilibCApiDatatypes
  */
@@ -61,6 +61,14 @@ extern "C" {
 
 #define OCILIBPP_HAS_ENABLEIF
 #define OCILIBPP_HAS_VARIADIC
+#define OCILIBPP_HAS_EXCEPTION_PTR
+#define OCILIBPP_HAS_FUTURE
+
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#define OCILIBPP_HAS_COROUTINE
+#endif
+#endif
 
 #ifdef  OCILIBCPP_DEBUG_MEMORY
 
@@ -89,6 +97,18 @@ extern "C" {
 #undef OCILIBPP_HAS_VARIADIC
 #endif
 
+#ifdef OCILIBPP_HAS_EXCEPTION_PTR
+#undef OCILIBPP_HAS_EXCEPTION_PTR
+#endif
+
+#ifdef OCILIBPP_HAS_FUTURE
+#undef OCILIBPP_HAS_FUTURE
+#endif
+
+#ifdef OCILIBPP_HAS_COROUTINE
+#undef OCILIBPP_HAS_COROUTINE
+#endif
+
 #ifdef OCILIBPP_DEBUG_MEMORY_ENABLED
 #undef OCILIBPP_DEBUG_MEMORY_ENABLED
 #endif
@@ -181,6 +201,21 @@ class Transaction;
 class Environment;
 class Statement;
 class Resultset;
+template<class>
+class ColumnBlock;
+#ifdef OCILIBPP_HAS_VARIADIC
+template<class>
+struct RowTraits;
+template<class>
+class RowMapper;
+#endif
+#ifdef OCILIBPP_HAS_COROUTINE
+class Executor;
+template<class>
+class AsyncOperation;
+template<class>
+class Task;
+#endif
 class Date;
 class Timestamp;
 class Interval;
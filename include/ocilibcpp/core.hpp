@@ -25,6 +25,14 @@
 
 #include "ocilibcpp/config.hpp"
 
+#ifdef OCILIBPP_HAS_COROUTINE
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <mutex>
+#include <optional>
+#endif
+
 // ReSharper disable CppClangTidyCppcoreguidelinesMacroUsage
 // ReSharper disable CppClangTidyHicppSpecialMemberFunctions
 // ReSharper disable CppClangTidyCppcoreguidelinesSpecialMemberFunctions
@@ -478,5 +486,121 @@ namespace ocilib
                 return lhs;
             }
         };
+
+#ifdef OCILIBPP_HAS_COROUTINE
+
+        /**
+        * @brief Internal usage.
+        * Holds the value or the exception produced by an asynchronous operation
+        */
+        template<class T>
+        class AsyncResult
+        {
+        public:
+
+            template<class F>
+            void Invoke(F& func);
+
+            void SetValue(T value);
+            void SetException(std::exception_ptr exception);
+            T GetValue();
+
+        private:
+
+            std::optional<T> _value;
+            std::exception_ptr _exception;
+        };
+
+        template<>
+        class AsyncResult<void>
+        {
+        public:
+
+            template<class F>
+            void Invoke(F& func);
+
+            void SetException(std::exception_ptr exception);
+            void GetValue();
+
+        private:
+
+            std::exception_ptr _exception;
+        };
+
+        /**
+        * @brief Internal usage.
+        * Coroutine promise part common to all ocilib::Task types
+        */
+        class TaskPromiseBase
+        {
+        public:
+
+            struct FinalAwaiter
+            {
+                bool await_ready() const noexcept;
+
+                template<class P>
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<P> handle) noexcept;
+
+                void await_resume() const noexcept;
+            };
+
+            TaskPromiseBase();
+
+            std::suspend_always initial_suspend() const noexcept;
+            FinalAwaiter final_suspend() const noexcept;
+
+            void SetContinuation(std::coroutine_handle<> continuation);
+            void Wait();
+
+        private:
+
+            std::coroutine_handle<> Complete() noexcept;
+
+            std::coroutine_handle<> _continuation;
+            std::mutex _mutex;
+            std::condition_variable _condition;
+            bool _completed;
+        };
+
+        /**
+        * @brief Internal usage.
+        * Coroutine promise of ocilib::Task
+        */
+        template<class T>
+        class TaskPromise : public TaskPromiseBase
+        {
+        public:
+
+            Task<T> get_return_object() noexcept;
+
+            void return_value(T value);
+            void unhandled_exception() noexcept;
+
+            T GetValue();
+
+        private:
+
+            AsyncResult<T> _result;
+        };
+
+        template<>
+        class TaskPromise<void> : public TaskPromiseBase
+        {
+        public:
+
+            Task<void> get_return_object() noexcept;
+
+            void return_void() noexcept;
+            void unhandled_exception() noexcept;
+
+            void GetValue();
+
+        private:
+
+            AsyncResult<void> _result;
+        };
+
+#endif
     }
 }
@@ -0,0 +1,308 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2025 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ocilibcpp/types.hpp"
+
+namespace ocilib
+{
+
+template<class T>
+ColumnBlock<T>::ColumnBlock() :
+    _data(nullptr), _inds(nullptr), _lens(nullptr), _size(0), _count(0), _converter(nullptr)
+{
+
+}
+
+template<class T>
+ColumnBlock<T>::ColumnBlock(OCI_Resultset* resultset, unsigned int index) :
+    _data(nullptr), _inds(nullptr), _lens(nullptr), _size(0), _count(0), _converter(nullptr)
+{
+    OCI_Column* column = core::Check(OCI_GetColumn(resultset, index));
+
+    if (core::Check(OCI_ColumnGetType(column)) != static_cast<unsigned int>(support::ColumnTypeResolver<T>::Value))
+    {
+        throw Exception(OCI_ERR_NOT_COMPATIBLE, OTEXT("Column type is not compatible with the column block type"));
+    }
+
+    /* the conversion is resolved once from the column subtype and reused for every row */
+
+    _converter = GetConverter(core::Check(OCI_ColumnGetSubType(column)), static_cast<T*>(nullptr));
+}
+
+template<class T>
+void ColumnBlock<T>::Update(OCI_Resultset* resultset, unsigned int index)
+{
+    const void* data = nullptr;
+
+    core::Check(OCI_GetColumnBlock(resultset, index, &data, &_size, &_inds, &_lens));
+
+    _data  = static_cast<const unsigned char*>(data);
+    _count = core::Check(OCI_GetBlockRowCount(resultset));
+}
+
+template<class T>
+unsigned int ColumnBlock<T>::GetCount() const
+{
+    return _count;
+}
+
+template<class T>
+bool ColumnBlock<T>::IsNull(unsigned int index) const
+{
+    return _inds[index] == -1;
+}
+
+template<class T>
+T ColumnBlock<T>::operator [] (unsigned int index) const
+{
+    T value = T();
+
+    GetValue(index, value);
+
+    return value;
+}
+
+template<class T>
+const void* ColumnBlock<T>::GetData() const
+{
+    return _data;
+}
+
+template<class T>
+unsigned int ColumnBlock<T>::GetSize() const
+{
+    return _size;
+}
+
+template<class T>
+void ColumnBlock<T>::GetValue(unsigned int index, T& value) const
+{
+    if (IsNull(index))
+    {
+        value = T();
+    }
+    else
+    {
+        (this->*_converter)(_data + static_cast<size_t>(index) * _size, index, value);
+    }
+}
+
+template<class T>
+template<class U>
+typename ColumnBlock<T>::Converter ColumnBlock<T>::GetConverter(unsigned int subtype, U*)
+{
+    switch (subtype)
+    {
+        case OCI_NUM_INT:
+        {
+            return &ColumnBlock::template GetNative<int>;
+        }
+        case OCI_NUM_UINT:
+        {
+            return &ColumnBlock::template GetNative<unsigned int>;
+        }
+        case OCI_NUM_FLOAT:
+        {
+            return &ColumnBlock::template GetNative<float>;
+        }
+        case OCI_NUM_DOUBLE:
+        {
+            return &ColumnBlock::template GetNative<double>;
+        }
+        default:
+        {
+            return &ColumnBlock::GetNumber;
+        }
+    }
+}
+
+template<class T>
+typename ColumnBlock<T>::Converter ColumnBlock<T>::GetConverter(unsigned int subtype, ostring*)
+{
+    ARG_NOT_USED(subtype);
+
+    return &ColumnBlock::GetString;
+}
+
+template<class T>
+typename ColumnBlock<T>::Converter ColumnBlock<T>::GetConverter(unsigned int subtype, Raw*)
+{
+    ARG_NOT_USED(subtype);
+
+    return &ColumnBlock::GetRaw;
+}
+
+template<class T>
+typename ColumnBlock<T>::Converter ColumnBlock<T>::GetConverter(unsigned int subtype, Date*)
+{
+    ARG_NOT_USED(subtype);
+
+    return &ColumnBlock::GetDate;
+}
+
+template<class T>
+template<class U>
+void ColumnBlock<T>::GetNative(const unsigned char* value, unsigned int index, T& result) const
+{
+    ARG_NOT_USED(index);
+
+    result = static_cast<T>(*reinterpret_cast<const U*>(value));
+}
+
+template<class T>
+void ColumnBlock<T>::GetNumber(const unsigned char* value, unsigned int index, T& result) const
+{
+    ARG_NOT_USED(index);
+
+    const unsigned int type = static_cast<unsigned int>(support::NumericTypeResolver<T>::Value);
+
+    if (type == OCI_NUM_DOUBLE || type == OCI_NUM_FLOAT)
+    {
+        result = static_cast<T>(NumberToDouble(value));
+    }
+    else
+    {
+        bool negative = false;
+
+        const big_uint integer = NumberToInteger(value, negative);
+
+        result = static_cast<T>(negative ? 0 - integer : integer);
+    }
+}
+
+template<class T>
+void ColumnBlock<T>::GetString(const unsigned char* value, unsigned int index, T& result) const
+{
+    ARG_NOT_USED(index);
+
+    result = reinterpret_cast<const otext*>(value);
+}
+
+template<class T>
+void ColumnBlock<T>::GetRaw(const unsigned char* value, unsigned int index, T& result) const
+{
+    result.assign(value, value + _lens[index]);
+}
+
+template<class T>
+void ColumnBlock<T>::GetDate(const unsigned char* value, unsigned int index, T& result) const
+{
+    ARG_NOT_USED(index);
+
+    /* OCI date layout : signed 16 bits year followed by month, day, hour, minute and second bytes */
+
+    short year = 0;
+
+    memcpy(&year, value, sizeof(year));
+
+    if (result.IsNull())
+    {
+        result = Date(true);
+    }
+
+    result.SetDateTime(year, value[2], value[3], value[4], value[5], value[6]);
+}
+
+template<class T>
+big_uint ColumnBlock<T>::NumberToInteger(const unsigned char* value, bool& negative)
+{
+    /* Oracle numbers are made of a length byte, an exponent byte and base 100 digits.
+       Value is sum(digit[i] * 100 ^ (exponent - i)). Negative numbers have their exponent
+       and digits complemented and may end with a terminal byte (102).
+       Digits of the fractional part are ignored */
+
+    const int length = static_cast<int>(value[0]);
+
+    int digits = length - 1;
+
+    negative = length > 0 && (value[1] & 0x80) == 0;
+
+    if (digits <= 0)
+    {
+        return 0;
+    }
+
+    if (negative && value[length] == 102)
+    {
+        digits--;
+    }
+
+    const int exponent = (negative ? (~value[1]) & 0x7F : value[1] & 0x7F) - 65;
+
+    big_uint integer = 0;
+
+    for (int i = 0; i <= exponent; i++)
+    {
+        integer *= 100;
+
+        if (i < digits)
+        {
+            integer += negative ? 101 - value[i + 2] : value[i + 2] - 1;
+        }
+    }
+
+    return integer;
+}
+
+template<class T>
+double ColumnBlock<T>::NumberToDouble(const unsigned char* value)
+{
+    /* same layout as in NumberToInteger(). Digits are accumulated as an integral mantissa
+       that is scaled once, keeping exact results for values with up to 15 significant digits */
+
+    const int length = static_cast<int>(value[0]);
+
+    const bool negative = length > 0 && (value[1] & 0x80) == 0;
+
+    int digits = length - 1;
+
+    if (digits <= 0)
+    {
+        return 0;
+    }
+
+    if (negative && value[length] == 102)
+    {
+        digits--;
+    }
+
+    const int exponent = (negative ? (~value[1]) & 0x7F : value[1] & 0x7F) - 65;
+
+    double mantissa = 0;
+    double scale    = 1;
+
+    for (int i = 0; i < digits; i++)
+    {
+        mantissa = mantissa * 100 + (negative ? 101 - value[i + 2] : value[i + 2] - 1);
+    }
+
+    for (int i = exponent - digits + 1; i != 0; i += (i > 0 ? -1 : 1))
+    {
+        scale *= 100;
+    }
+
+    mantissa = exponent - digits + 1 >= 0 ? mantissa * scale : mantissa / scale;
+
+    return negative ? -mantissa : mantissa;
+}
+
+}
@@ -81,6 +81,32 @@ inline void Connection::Break()
     core::Check(OCI_Break(*this));
 }
 
+inline bool Connection::ExecuteBatch(const std::vector<Statement>& statements, std::vector<unsigned int>& rows)
+{
+    std::vector<OCI_Statement*> handles;
+
+    handles.reserve(statements.size());
+
+    for (std::vector<Statement>::const_iterator it = statements.begin(), end = statements.end(); it != end; ++it)
+    {
+        it->SetInData();
+        handles.push_back(*it);
+    }
+
+    rows.assign(statements.size(), 0);
+
+    const boolean res = core::Check(OCI_ExecuteBatch(*this, handles.empty() ? nullptr : &handles[0],
+                                                     static_cast<unsigned int>(handles.size()),
+                                                     rows.empty() ? nullptr : &rows[0]));
+
+    for (std::vector<Statement>::const_iterator it = statements.begin(), end = statements.end(); it != end; ++it)
+    {
+        it->SetOutData();
+    }
+
+    return (res == TRUE);
+}
+
 inline void Connection::SetAutoCommit(bool enabled)
 {
     core::Check(OCI_SetAutoCommit(*this, enabled));
@@ -256,6 +282,21 @@ inline void Connection::SetStatementCacheSize(unsigned int value)
     core::Check(OCI_SetStatementCacheSize(*this, value));
 }
 
+inline unsigned int Connection::GetPreparedCacheSize() const
+{
+    return core::Check(OCI_GetPreparedCacheSize(*this));
+}
+
+inline void Connection::SetPreparedCacheSize(unsigned int value)
+{
+    core::Check(OCI_SetPreparedCacheSize(*this, value));
+}
+
+inline big_uint Connection::GetPreparedCacheValue(PreparedCacheValue value) const
+{
+    return core::Check(OCI_GetPreparedCacheValue(*this, value));
+}
+
 inline unsigned int Connection::GetDefaultLobPrefetchSize() const
 {
     return core::Check(OCI_GetDefaultLobPrefetchSize(*this));
@@ -110,11 +110,51 @@ inline unsigned int Environment::GetCharMaxSize()
     return GetInstance()->_charMaxSize;
 }
 
+inline void Environment::SetMemoryHandlers(POCI_MEM_ALLOC allocFunc, POCI_MEM_REALLOC reallocFunc, POCI_MEM_FREE freeFunc)
+{
+    core::Check(OCI_SetMemoryHandlers(allocFunc, reallocFunc, freeFunc));
+}
+
 inline big_uint Environment::GetAllocatedBytes(AllocatedBytesFlags type)
 {
     return core::Check(OCI_GetAllocatedBytes(type.GetValues()));
 }
 
+inline unsigned int Environment::GetMemoryProfileSize()
+{
+    return core::Check(OCI_GetMemoryProfileSize());
+}
+
+inline ostring Environment::GetMemoryProfileName(unsigned int index)
+{
+    return core::MakeString(core::Check(OCI_GetMemoryProfileName(index)));
+}
+
+inline big_uint Environment::GetMemoryProfileValue(unsigned int index, MemoryProfileValue value)
+{
+    return core::Check(OCI_GetMemoryProfileValue(index, value));
+}
+
+inline big_uint Environment::GetDescriptorPoolValue(DescriptorPoolValue value)
+{
+    return core::Check(OCI_GetDescriptorPoolValue(value));
+}
+
+inline unsigned int Environment::GetSqlStatsSize()
+{
+    return core::Check(OCI_GetSqlStatsSize());
+}
+
+inline ostring Environment::GetSqlStatsName(unsigned int index)
+{
+    return core::MakeString(core::Check(OCI_GetSqlStatsName(index)));
+}
+
+inline big_uint Environment::GetSqlStatsValue(unsigned int index, StatementStatsValue value)
+{
+    return core::Check(OCI_GetSqlStatsValue(index, value));
+}
+
 inline bool Environment::Initialized()
 {
     return GetInstance()->_initialized;
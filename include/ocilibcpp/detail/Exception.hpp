@@ -48,6 +48,18 @@ inline Exception::Exception(OCI_Error *err) noexcept
     SetWhat(OCI_ErrorGetString(err));
 }
 
+inline Exception::Exception(int errLib, const otext* message) noexcept
+    : _what(nullptr),
+    _pStatement(nullptr),
+    _pConnnection(nullptr),
+    _row(0),
+    _type(OcilibError),
+    _errLib(errLib),
+    _errOracle(0)
+{
+    SetWhat(message);
+}
+
 inline Exception::Exception(const Exception& other) noexcept : Exception()
 {
     *this = other;
@@ -0,0 +1,138 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2025 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+
+#include "ocilibcpp/types.hpp"
+
+#ifdef OCILIBPP_HAS_COROUTINE
+
+namespace ocilib
+{
+
+inline Executor::Executor(unsigned int threads) : _mutex(), _condition(), _jobs(), _threads(), _stopping(false)
+{
+    _threads.reserve(threads);
+
+    for (unsigned int i = 0; i < threads; i++)
+    {
+        _threads.emplace_back(&Executor::Run, this);
+    }
+}
+
+inline Executor::~Executor() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        _stopping = true;
+    }
+
+    _condition.notify_all();
+
+    for (auto& thread : _threads)
+    {
+        thread.join();
+    }
+}
+
+inline unsigned int Executor::GetThreadCount() const
+{
+    return static_cast<unsigned int>(_threads.size());
+}
+
+inline void Executor::Post(std::function<void()> job)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        _jobs.push_back(std::move(job));
+    }
+
+    _condition.notify_one();
+}
+
+template<class T>
+AsyncOperation<T> Executor::Schedule(std::function<T()> func)
+{
+    return AsyncOperation<T>(*this, std::move(func));
+}
+
+inline void Executor::Run()
+{
+    for (;;)
+    {
+        std::function<void()> job;
+
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+
+            _condition.wait(lock, [this]() { return _stopping || !_jobs.empty(); });
+
+            /* pending jobs are drained before stopping */
+
+            if (_jobs.empty())
+            {
+                return;
+            }
+
+            job = std::move(_jobs.front());
+            _jobs.pop_front();
+        }
+
+        job();
+    }
+}
+
+template<class T>
+AsyncOperation<T>::AsyncOperation(Executor& executor, std::function<T()> func)
+    : _executor(&executor), _func(std::move(func)), _result()
+{
+
+}
+
+template<class T>
+bool AsyncOperation<T>::await_ready() const noexcept
+{
+    return false;
+}
+
+template<class T>
+void AsyncOperation<T>::await_suspend(std::coroutine_handle<> handle)
+{
+    /* the coroutine may be resumed and this object destroyed before Post() returns */
+
+    _executor->Post([this, handle]()
+    {
+        _result.Invoke(_func);
+        handle.resume();
+    });
+}
+
+template<class T>
+T AsyncOperation<T>::await_resume()
+{
+    return _result.GetValue();
+}
+
+}
+
+#endif
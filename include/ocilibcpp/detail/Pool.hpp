@@ -120,4 +120,75 @@ inline void Pool::SetStatementCacheSize(unsigned int value)
     core::Check(OCI_PoolSetStatementCacheSize(*this, value));
 }
 
+template<class T>
+struct Pool::ParallelQueryContext
+{
+    ParallelQueryContext(T* consumer) : Consumer(consumer), HasUserError(false)
+    {
+    }
+
+    T* Consumer;
+    Exception UserError;
+    bool HasUserError;
+#ifdef OCILIBPP_HAS_EXCEPTION_PTR
+    std::exception_ptr Failure;
+#endif
+};
+
+template<class T>
+boolean Pool::ParallelQueryFetch(OCI_Resultset* rs, unsigned int partition, void* ctx)
+{
+    ParallelQueryContext<T>* context = static_cast<ParallelQueryContext<T>*>(ctx);
+
+    try
+    {
+        return (*context->Consumer)(Resultset(rs, nullptr), partition) ? TRUE : FALSE;
+    }
+    catch (Exception& e)
+    {
+        context->UserError = e;
+        context->HasUserError = true;
+    }
+#ifdef OCILIBPP_HAS_EXCEPTION_PTR
+    catch (...)
+    {
+        context->Failure = std::current_exception();
+    }
+#endif
+
+    return FALSE;
+}
+
+template<class T>
+void Pool::ParallelQuery(const ostring& sql, ParallelQueryMode mode, unsigned int partitions,
+                         const std::vector<ostring>& args, T consumer, unsigned int fetchSize)
+{
+    ParallelQueryContext<T> context(&consumer);
+
+    std::vector<const otext*> values;
+
+    for (typename std::vector<ostring>::const_iterator it = args.begin(); it != args.end(); ++it)
+    {
+        values.push_back(it->c_str());
+    }
+
+    const boolean res = OCI_ParallelQuery(*this, sql.c_str(), mode, partitions,
+                                          values.empty() ? nullptr : &values[0],
+                                          fetchSize, ParallelQueryFetch<T>, &context);
+
+#ifdef OCILIBPP_HAS_EXCEPTION_PTR
+    if (context.Failure)
+    {
+        std::rethrow_exception(context.Failure);
+    }
+#endif
+
+    if (context.HasUserError)
+    {
+        throw context.UserError;
+    }
+
+    core::Check(res);
+}
+
 }
@@ -35,6 +35,97 @@ inline bool Resultset::Next()
     return (core::Check(OCI_FetchNext(*this)) == TRUE);
 }
 
+inline unsigned int Resultset::FetchBlock()
+{
+    unsigned int rows = 0;
+
+    core::Check(OCI_FetchBlock(*this, &rows));
+
+    return rows;
+}
+
+template<class T>
+ColumnBlock<T> Resultset::GetColumnBlock(unsigned int index) const
+{
+    ColumnBlock<T> block(*this, index);
+
+    block.Update(*this, index);
+
+    return block;
+}
+
+#ifdef OCILIBPP_HAS_VARIADIC
+
+template<class T>
+RowMapper<T> Resultset::Map() const
+{
+    return RowMapper<T>(*this);
+}
+
+#endif
+
+#ifdef OCILIBPP_HAS_FUTURE
+
+struct Resultset::AsyncFetchContext
+{
+    AsyncFetchContext(const Resultset& owner) : Owner(owner)
+    {
+    }
+
+    Resultset Owner;
+    std::promise<bool> Promise;
+};
+
+inline void Resultset::AsyncFetchHandler(OCI_Statement* stmt, unsigned int type, boolean result, void* ctx)
+{
+    ARG_NOT_USED(stmt);
+    ARG_NOT_USED(type);
+
+    AsyncFetchContext* context = static_cast<AsyncFetchContext*>(ctx);
+
+    try
+    {
+        context->Promise.set_value(core::Check(result) == TRUE);
+    }
+    catch (...)
+    {
+        context->Promise.set_exception(std::current_exception());
+    }
+
+    delete core::OnDeallocate(context);
+}
+
+inline std::future<bool> Resultset::NextAsync()
+{
+    AsyncFetchContext* context = core::OnAllocate(new AsyncFetchContext(*this));
+
+    std::future<bool> future = context->Promise.get_future();
+
+    const boolean res = OCI_FetchNextAsync(*this, AsyncFetchHandler, context);
+
+    if (!res)
+    {
+        delete core::OnDeallocate(context);
+    }
+
+    core::Check(res);
+
+    return future;
+}
+
+#endif
+
+#ifdef OCILIBPP_HAS_COROUTINE
+
+inline AsyncOperation<bool> Resultset::NextAsync(Executor& executor)
+{
+    Resultset resultset(*this);
+
+    return executor.Schedule<bool>([resultset]() mutable { return resultset.Next(); });
+}
+
+#endif
+
 inline bool Resultset::Prev()
 {
     return (core::Check(OCI_FetchPrev(*this)) == TRUE);
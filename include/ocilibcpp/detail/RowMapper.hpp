@@ -0,0 +1,180 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2025 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ocilibcpp/types.hpp"
+
+#ifdef OCILIBPP_HAS_VARIADIC
+
+namespace ocilib
+{
+
+template<class T>
+RowMapper<T>::RowMapper(const Resultset& resultset) :
+    _resultset(resultset), _fields(Layout::GetFields()), _blocks(), _row(), _index(0), _count(0)
+{
+    if (_resultset.GetColumnCount() != static_cast<unsigned int>(Layout::Count) || !CheckColumns<0>(HasField<0>()))
+    {
+        throw Exception(OCI_ERR_NOT_COMPATIBLE, OTEXT("Resultset columns are not compatible with the mapped row type"));
+    }
+
+    CreateBlocks<0>(HasField<0>());
+}
+
+template<class T>
+bool RowMapper<T>::Next()
+{
+    if (++_index >= _count)
+    {
+        _index = 0;
+        _count = _resultset.FetchBlock();
+
+        if (_count == 0)
+        {
+            return false;
+        }
+
+        SetBlocks<0>(HasField<0>());
+    }
+
+    SetFields<0>(HasField<0>());
+
+    return true;
+}
+
+template<class T>
+const T& RowMapper<T>::Get() const
+{
+    return _row;
+}
+
+template<class T>
+bool RowMapper<T>::IsNull(unsigned int index) const
+{
+    return IsNull<0>(index, HasField<0>());
+}
+
+template<class T>
+template<class U>
+unsigned int RowMapper<T>::ForEach(U callback)
+{
+    unsigned int count = 0;
+
+    while (Next())
+    {
+        count++;
+
+        if (!callback(static_cast<const T&>(_row)))
+        {
+            break;
+        }
+    }
+
+    return count;
+}
+
+template<class T>
+template<std::size_t I>
+bool RowMapper<T>::CheckColumns(std::true_type) const
+{
+    typedef typename Layout::template Field<I>::Type Type;
+
+    const unsigned int type = core::Check(OCI_ColumnGetType(core::Check(OCI_GetColumn(_resultset, I + 1))));
+
+    return type == static_cast<unsigned int>(support::ColumnTypeResolver<Type>::Value) && CheckColumns<I + 1>(HasField<I + 1>());
+}
+
+template<class T>
+template<std::size_t I>
+bool RowMapper<T>::CheckColumns(std::false_type) const
+{
+    return true;
+}
+
+template<class T>
+template<std::size_t I>
+void RowMapper<T>::CreateBlocks(std::true_type)
+{
+    typedef typename Layout::template Field<I>::Type Type;
+
+    std::get<I>(_blocks) = ColumnBlock<Type>(_resultset, I + 1);
+
+    CreateBlocks<I + 1>(HasField<I + 1>());
+}
+
+template<class T>
+template<std::size_t I>
+void RowMapper<T>::CreateBlocks(std::false_type)
+{
+
+}
+
+template<class T>
+template<std::size_t I>
+void RowMapper<T>::SetBlocks(std::true_type)
+{
+    std::get<I>(_blocks).Update(_resultset, I + 1);
+
+    SetBlocks<I + 1>(HasField<I + 1>());
+}
+
+template<class T>
+template<std::size_t I>
+void RowMapper<T>::SetBlocks(std::false_type)
+{
+
+}
+
+template<class T>
+template<std::size_t I>
+void RowMapper<T>::SetFields(std::true_type)
+{
+    std::get<I>(_blocks).GetValue(_index, Layout::template Field<I>::Get(_row, _fields));
+
+    SetFields<I + 1>(HasField<I + 1>());
+}
+
+template<class T>
+template<std::size_t I>
+void RowMapper<T>::SetFields(std::false_type)
+{
+
+}
+
+template<class T>
+template<std::size_t I>
+bool RowMapper<T>::IsNull(unsigned int index, std::true_type) const
+{
+    return index == I + 1 ? std::get<I>(_blocks).IsNull(_index) : IsNull<I + 1>(index, HasField<I + 1>());
+}
+
+template<class T>
+template<std::size_t I>
+bool RowMapper<T>::IsNull(unsigned int index, std::false_type) const
+{
+    ARG_NOT_USED(index);
+
+    return false;
+}
+
+}
+
+#endif
@@ -112,6 +112,214 @@ unsigned int Statement::ExecutePrepared(T callback, U adapter)
     return Fetch(callback, adapter);
 }
 
+#ifdef OCILIBPP_HAS_FUTURE
+
+struct Statement::AsyncExecuteContext
+{
+    AsyncExecuteContext(const Statement& owner) : Owner(owner)
+    {
+    }
+
+    Statement Owner;
+    std::promise<void> Promise;
+};
+
+inline void Statement::AsyncExecuteHandler(OCI_Statement* stmt, unsigned int type, boolean result, void* ctx)
+{
+    ARG_NOT_USED(stmt);
+    ARG_NOT_USED(type);
+
+    AsyncExecuteContext* context = static_cast<AsyncExecuteContext*>(ctx);
+
+    try
+    {
+        core::Check(result);
+        context->Owner.SetOutData();
+        context->Promise.set_value();
+    }
+    catch (...)
+    {
+        context->Promise.set_exception(std::current_exception());
+    }
+
+    delete core::OnDeallocate(context);
+}
+
+inline std::future<void> Statement::ExecutePreparedAsync()
+{
+    ReleaseResultsets();
+    SetInData();
+
+    AsyncExecuteContext* context = core::OnAllocate(new AsyncExecuteContext(*this));
+
+    std::future<void> future = context->Promise.get_future();
+
+    const boolean res = OCI_ExecuteAsync(*this, AsyncExecuteHandler, context);
+
+    if (!res)
+    {
+        delete core::OnDeallocate(context);
+    }
+
+    core::Check(res);
+
+    return future;
+}
+
+inline std::future<void> Statement::ExecuteAsync(const ostring& sql)
+{
+    Prepare(sql);
+
+    return ExecutePreparedAsync();
+}
+
+#endif
+
+#ifdef OCILIBPP_HAS_COROUTINE
+
+inline AsyncOperation<void> Statement::ExecutePreparedAsync(Executor& executor)
+{
+    Statement statement(*this);
+
+    return executor.Schedule<void>([statement]() mutable { statement.ExecutePrepared(); });
+}
+
+inline AsyncOperation<void> Statement::ExecuteAsync(Executor& executor, const ostring& sql)
+{
+    Statement statement(*this);
+
+    return executor.Schedule<void>([statement, sql]() mutable { statement.Execute(sql); });
+}
+
+#endif
+
+template<class T>
+struct Statement::ArrayStreamContext
+{
+    ArrayStreamContext(Statement* owner, T* source) : Owner(owner), Source(source), Count(0), HasError(false), HasUserError(false)
+    {
+    }
+
+    Statement* Owner;
+    T* Source;
+    unsigned int Count;
+    Exception Error;
+    bool HasError;
+    Exception UserError;
+    bool HasUserError;
+#ifdef OCILIBPP_HAS_EXCEPTION_PTR
+    std::exception_ptr Failure;
+#endif
+};
+
+template<class I, class U>
+struct Statement::ArrayStreamRange
+{
+    I Current;
+    I Last;
+    U Assign;
+
+    unsigned int operator ()(unsigned int offset, unsigned int size)
+    {
+        ARG_NOT_USED(offset);
+
+        unsigned int count = 0;
+
+        for (; Current != Last && count < size; ++Current, ++count)
+        {
+            Assign(*Current, count);
+        }
+
+        return count;
+    }
+};
+
+template<class T>
+unsigned int Statement::ArrayStreamFill(OCI_Statement* stmt, unsigned int offset, unsigned int size, void* ctx)
+{
+    ARG_NOT_USED(stmt);
+
+    ArrayStreamContext<T>* context = static_cast<ArrayStreamContext<T>*>(ctx);
+
+    /* OCILIB calls made while filling the chunk reset the error of the previous chunk */
+
+    OCI_Error* err = OCI_GetLastError();
+
+    if (err && !context->HasError)
+    {
+        context->Error = Exception(err);
+        context->HasError = true;
+    }
+
+    unsigned int count = 0;
+
+    try
+    {
+        count = (*context->Source)(offset, size);
+
+        if (count > 0)
+        {
+            context->Owner->SetInData();
+        }
+    }
+    catch (Exception& e)
+    {
+        context->UserError = e;
+        context->HasUserError = true;
+        count = 0;
+    }
+#ifdef OCILIBPP_HAS_EXCEPTION_PTR
+    catch (...)
+    {
+        context->Failure = std::current_exception();
+        count = 0;
+    }
+#endif
+
+    context->Count += count;
+
+    return count;
+}
+
+template<class T>
+unsigned int Statement::ExecuteArrayStream(T source)
+{
+    ArrayStreamContext<T> context(this, &source);
+
+    ReleaseResultsets();
+
+    const boolean res = OCI_ExecuteArrayStream(*this, ArrayStreamFill<T>, &context);
+
+#ifdef OCILIBPP_HAS_EXCEPTION_PTR
+    if (context.Failure)
+    {
+        std::rethrow_exception(context.Failure);
+    }
+#endif
+
+    if (context.HasUserError)
+    {
+        throw context.UserError;
+    }
+
+    core::Check(res);
+
+    if (context.HasError)
+    {
+        throw context.Error;
+    }
+
+    return context.Count;
+}
+
+template<class I, class U>
+unsigned int Statement::ExecuteArrayStream(I first, I last, U assign)
+{
+    ArrayStreamRange<I, U> range = { first, last, assign };
+
+    return ExecuteArrayStream(range);
+}
+
 inline void Statement::Execute(const ostring& sql)
 {
     ClearBinds();
@@ -182,6 +390,11 @@ inline ostring Statement::GetSqlIdentifier() const
     return core::MakeString(core::Check(OCI_GetSqlIdentifier(*this)));
 }
 
+inline big_uint Statement::GetStats(Environment::StatementStatsValue value) const
+{
+    return core::Check(OCI_GetStatementStats(*this, value));
+}
+
 inline Resultset Statement::GetResultset()
 {
    return Resultset(core::Check(OCI_GetResultset(*this)), GetHandle());
@@ -290,6 +503,14 @@ void Statement::BindVector2(M &method, const ostring& name, std::vector<T> &valu
     core::Check(res);
 }
 
+template<typename M, class T>
+void Statement::BindInPlace1(M &method, const ostring& name, T* values, unsigned int count, BindInfo::BindDirection mode, BindInfo::VectorType type, short* indicators)
+{
+    core::Check(method(*this, name.c_str(), values, type == BindInfo::AsPlSqlTable ? count : 0));
+    SetLastBindMode(mode);
+    SetLastBindArrays(indicators, nullptr);
+}
+
 template<>
 inline void Statement::Bind<bool>(const ostring& name, bool &value, BindInfo::BindDirection mode)
 {
@@ -708,6 +929,80 @@ inline void Statement::Bind<Raw, unsigned int>(const ostring& name, std::vector<
     core::Check(res);
 }
 
+template<>
+inline void Statement::BindInPlace<short>(const ostring& name, short* values, unsigned int count, BindInfo::BindDirection mode, BindInfo::VectorType type, short* indicators)
+{
+    BindInPlace1(OCI_BindArrayOfShorts, name, values, count, mode, type, indicators);
+}
+
+template<>
+inline void Statement::BindInPlace<unsigned short>(const ostring& name, unsigned short* values, unsigned int count, BindInfo::BindDirection mode, BindInfo::VectorType type, short* indicators)
+{
+    BindInPlace1(OCI_BindArrayOfUnsignedShorts, name, values, count, mode, type, indicators);
+}
+
+template<>
+inline void Statement::BindInPlace<int>(const ostring& name, int* values, unsigned int count, BindInfo::BindDirection mode, BindInfo::VectorType type, short* indicators)
+{
+    BindInPlace1(OCI_BindArrayOfInts, name, values, count, mode, type, indicators);
+}
+
+template<>
+inline void Statement::BindInPlace<unsigned int>(const ostring& name, unsigned int* values, unsigned int count, BindInfo::BindDirection mode, BindInfo::VectorType type, short* indicators)
+{
+    BindInPlace1(OCI_BindArrayOfUnsignedInts, name, values, count, mode, type, indicators);
+}
+
+template<>
+inline void Statement::BindInPlace<big_int>(const ostring& name, big_int* values, unsigned int count, BindInfo::BindDirection mode, BindInfo::VectorType type, short* indicators)
+{
+    BindInPlace1(OCI_BindArrayOfBigInts, name, values, count, mode, type, indicators);
+}
+
+template<>
+inline void Statement::BindInPlace<big_uint>(const ostring& name, big_uint* values, unsigned int count, BindInfo::BindDirection mode, BindInfo::VectorType type, short* indicators)
+{
+    BindInPlace1(OCI_BindArrayOfUnsignedBigInts, name, values, count, mode, type, indicators);
+}
+
+template<>
+inline void Statement::BindInPlace<float>(const ostring& name, float* values, unsigned int count, BindInfo::BindDirection mode, BindInfo::VectorType type, short* indicators)
+{
+    BindInPlace1(OCI_BindArrayOfFloats, name, values, count, mode, type, indicators);
+}
+
+template<>
+inline void Statement::BindInPlace<double>(const ostring& name, double* values, unsigned int count, BindInfo::BindDirection mode, BindInfo::VectorType type, short* indicators)
+{
+    BindInPlace1(OCI_BindArrayOfDoubles, name, values, count, mode, type, indicators);
+}
+
+template<class T>
+void Statement::BindInPlace(const ostring& name, std::vector<T>& values, BindInfo::BindDirection mode, BindInfo::VectorType type, short* indicators)
+{
+    BindInPlace<T>(name, values.empty() ? nullptr : &values[0], static_cast<unsigned int>(values.size()), mode, type, indicators);
+}
+
+template<class T, std::size_t N>
+void Statement::BindInPlace(const ostring& name, T(&values)[N], BindInfo::BindDirection mode, BindInfo::VectorType type, short* indicators)
+{
+    BindInPlace<T>(name, values, static_cast<unsigned int>(N), mode, type, indicators);
+}
+
+inline void Statement::BindInPlace(const ostring& name, otext* values, unsigned int maxSize, unsigned int count, BindInfo::BindDirection mode, BindInfo::VectorType type, short* indicators, unsigned short* lengths)
+{
+    core::Check(OCI_BindArrayOfStrings(*this, name.c_str(), values, maxSize, type == BindInfo::AsPlSqlTable ? count : 0));
+    SetLastBindMode(mode);
+    SetLastBindArrays(indicators, lengths);
+}
+
+inline void Statement::BindInPlace(const ostring& name, unsigned char* values, unsigned int maxSize, unsigned int count, BindInfo::BindDirection mode, BindInfo::VectorType type, short* indicators, unsigned short* lengths)
+{
+    core::Check(OCI_BindArrayOfRaws(*this, name.c_str(), values, maxSize, type == BindInfo::AsPlSqlTable ? count : 0));
+    SetLastBindMode(mode);
+    SetLastBindArrays(indicators, lengths);
+}
+
 template<class T>
 void Statement::Bind(const ostring& name, std::vector<T> &values, TypeInfo &typeInfo, BindInfo::BindDirection mode, BindInfo::VectorType type)
 {
@@ -894,6 +1189,16 @@ inline Statement::BindMode Statement::GetBindMode() const
     return BindMode(static_cast<BindMode::Type>(core::Check(OCI_GetBindMode(*this))));
 }
 
+inline void Statement::SetBigIntBindMode(BigIntBindMode value)
+{
+    core::Check(OCI_SetBindBigIntMode(*this, value));
+}
+
+inline Statement::BigIntBindMode Statement::GetBigIntBindMode() const
+{
+    return BigIntBindMode(static_cast<BigIntBindMode::Type>(core::Check(OCI_GetBindBigIntMode(*this))));
+}
+
 inline void Statement::SetFetchSize(unsigned int value)
 {
     core::Check(OCI_SetFetchSize(*this, value));
@@ -924,6 +1229,26 @@ inline unsigned int Statement::GetPrefetchMemory() const
     return core::Check(OCI_GetPrefetchMemory(*this));
 }
 
+inline void Statement::SetFetchMemory(unsigned int value)
+{
+    core::Check(OCI_SetFetchMemory(*this, value));
+}
+
+inline unsigned int Statement::GetFetchMemory() const
+{
+    return core::Check(OCI_GetFetchMemory(*this));
+}
+
+inline void Statement::SetReadAhead(bool value)
+{
+    core::Check(OCI_SetReadAhead(*this, value));
+}
+
+inline bool Statement::GetReadAhead() const
+{
+    return (core::Check(OCI_GetReadAhead(*this)) == TRUE);
+}
+
 inline void Statement::SetPieceSize(unsigned int value)
 {
     core::Check(OCI_SetPieceSize(*this, value));
@@ -1042,6 +1367,24 @@ inline void Statement::SetLastBindMode(BindInfo::BindDirection mode)
     core::Check(OCI_BindSetDirection(core::Check(OCI_GetBind(*this, core::Check(OCI_GetBindCount(*this)))),  mode));
 }
 
+inline void Statement::SetLastBindArrays(short* indicators, unsigned short* lengths)
+{
+    if (indicators || lengths)
+    {
+        OCI_Bind* bnd = core::Check(OCI_GetBind(*this, core::Check(OCI_GetBindCount(*this))));
+
+        if (indicators)
+        {
+            core::Check(OCI_BindSetIndicatorArray(bnd, indicators));
+        }
+
+        if (lengths)
+        {
+            core::Check(OCI_BindSetLengthArray(bnd, lengths));
+        }
+    }
+}
+
 inline support::BindsHolder * Statement::GetBindsHolder(bool create) const
 {
     support::BindsHolder * bindsHolder = static_cast<support::BindsHolder *>(_smartHandle->GetExtraInfos());
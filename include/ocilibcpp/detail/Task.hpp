@@ -0,0 +1,85 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2025 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+
+#include "ocilibcpp/types.hpp"
+
+#ifdef OCILIBPP_HAS_COROUTINE
+
+namespace ocilib
+{
+
+template<class T>
+Task<T>::Task(std::coroutine_handle<promise_type> handle) noexcept : _handle(handle)
+{
+
+}
+
+template<class T>
+Task<T>::Task(Task&& other) noexcept : _handle(other._handle)
+{
+    other._handle = nullptr;
+}
+
+template<class T>
+Task<T>::~Task() noexcept
+{
+    if (_handle)
+    {
+        _handle.destroy();
+    }
+}
+
+template<class T>
+bool Task<T>::await_ready() const noexcept
+{
+    return false;
+}
+
+template<class T>
+std::coroutine_handle<> Task<T>::await_suspend(std::coroutine_handle<> continuation) noexcept
+{
+    _handle.promise().SetContinuation(continuation);
+
+    return _handle;
+}
+
+template<class T>
+T Task<T>::await_resume()
+{
+    return _handle.promise().GetValue();
+}
+
+template<class T>
+T Task<T>::Get()
+{
+    /* the coroutine runs on the calling thread until its first suspension */
+
+    _handle.resume();
+    _handle.promise().Wait();
+
+    return _handle.promise().GetValue();
+}
+
+}
+
+#endif
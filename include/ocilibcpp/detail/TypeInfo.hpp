@@ -81,4 +81,9 @@ inline TypeInfo TypeInfo::GetSuperType() const
     return TypeInfo(core::Check(OCI_TypeInfoGetSuperType(*this)), connection.GetHandle());
 }
 
+inline void TypeInfo::Invalidate(const ostring& name)
+{
+    core::Check(OCI_TypeInfoInvalidate(name.empty() ? nullptr : name.c_str()));
+}
+
 }
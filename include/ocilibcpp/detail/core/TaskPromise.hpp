@@ -0,0 +1,202 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2025 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+
+#include "ocilibcpp/types.hpp"
+
+#ifdef OCILIBPP_HAS_COROUTINE
+
+namespace ocilib
+{
+    namespace core
+    {
+        template<class T>
+        template<class F>
+        void AsyncResult<T>::Invoke(F& func)
+        {
+            try
+            {
+                SetValue(func());
+            }
+            catch (...)
+            {
+                SetException(std::current_exception());
+            }
+        }
+
+        template<class T>
+        void AsyncResult<T>::SetValue(T value)
+        {
+            _value.emplace(std::move(value));
+        }
+
+        template<class T>
+        void AsyncResult<T>::SetException(std::exception_ptr exception)
+        {
+            _exception = exception;
+        }
+
+        template<class T>
+        T AsyncResult<T>::GetValue()
+        {
+            if (_exception)
+            {
+                std::rethrow_exception(_exception);
+            }
+
+            return std::move(*_value);
+        }
+
+        template<class F>
+        void AsyncResult<void>::Invoke(F& func)
+        {
+            try
+            {
+                func();
+            }
+            catch (...)
+            {
+                SetException(std::current_exception());
+            }
+        }
+
+        inline void AsyncResult<void>::SetException(std::exception_ptr exception)
+        {
+            _exception = exception;
+        }
+
+        inline void AsyncResult<void>::GetValue()
+        {
+            if (_exception)
+            {
+                std::rethrow_exception(_exception);
+            }
+        }
+
+        inline bool TaskPromiseBase::FinalAwaiter::await_ready() const noexcept
+        {
+            return false;
+        }
+
+        template<class P>
+        std::coroutine_handle<> TaskPromiseBase::FinalAwaiter::await_suspend(std::coroutine_handle<P> handle) noexcept
+        {
+            return handle.promise().Complete();
+        }
+
+        inline void TaskPromiseBase::FinalAwaiter::await_resume() const noexcept
+        {
+
+        }
+
+        inline TaskPromiseBase::TaskPromiseBase() : _continuation(), _mutex(), _condition(), _completed(false)
+        {
+
+        }
+
+        inline std::suspend_always TaskPromiseBase::initial_suspend() const noexcept
+        {
+            return {};
+        }
+
+        inline TaskPromiseBase::FinalAwaiter TaskPromiseBase::final_suspend() const noexcept
+        {
+            return {};
+        }
+
+        inline void TaskPromiseBase::SetContinuation(std::coroutine_handle<> continuation)
+        {
+            _continuation = continuation;
+        }
+
+        inline void TaskPromiseBase::Wait()
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+
+            _condition.wait(lock, [this]() { return _completed; });
+        }
+
+        inline std::coroutine_handle<> TaskPromiseBase::Complete() noexcept
+        {
+            /* an awaiting coroutine is resumed by symmetric transfer, otherwise Wait() is
+               notified while holding the lock as the waiter destroys this promise when woken */
+
+            if (_continuation)
+            {
+                return _continuation;
+            }
+
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            _completed = true;
+            _condition.notify_all();
+
+            return std::noop_coroutine();
+        }
+
+        template<class T>
+        Task<T> TaskPromise<T>::get_return_object() noexcept
+        {
+            return Task<T>(std::coroutine_handle<TaskPromise<T> >::from_promise(*this));
+        }
+
+        template<class T>
+        void TaskPromise<T>::return_value(T value)
+        {
+            _result.SetValue(std::move(value));
+        }
+
+        template<class T>
+        void TaskPromise<T>::unhandled_exception() noexcept
+        {
+            _result.SetException(std::current_exception());
+        }
+
+        template<class T>
+        T TaskPromise<T>::GetValue()
+        {
+            return _result.GetValue();
+        }
+
+        inline Task<void> TaskPromise<void>::get_return_object() noexcept
+        {
+            return Task<void>(std::coroutine_handle<TaskPromise<void> >::from_promise(*this));
+        }
+
+        inline void TaskPromise<void>::return_void() noexcept
+        {
+
+        }
+
+        inline void TaskPromise<void>::unhandled_exception() noexcept
+        {
+            _result.SetException(std::current_exception());
+        }
+
+        inline void TaskPromise<void>::GetValue()
+        {
+            _result.GetValue();
+        }
+    }
+}
+
+#endif
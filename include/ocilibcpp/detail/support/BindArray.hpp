@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include "ocilibcpp/support.hpp"
 
 // ReSharper disable CppClangTidyModernizePassByValue
@@ -80,7 +82,7 @@ namespace ocilib
 
         template<class T>
         BindArray::BindArrayObject<T>::BindArrayObject(const ocilib::Statement& statement, const ostring& name, ObjectVector& vector, bool isPlSqlTable, unsigned int mode, unsigned int elemSize)
-            : _statement(statement), _name(name), _vector(vector), _data(nullptr), _isPlSqlTable(isPlSqlTable), _mode(mode), _elemCount(BindArrayObject<T>::GetSize()), _elemSize(elemSize)
+            : _statement(statement), _name(name), _vector(vector), _data(nullptr), _bind(nullptr), _sizes(nullptr), _isPlSqlTable(isPlSqlTable), _mode(mode), _elemCount(BindArrayObject<T>::GetSize()), _elemSize(elemSize)
         {
             AllocData();
         }
@@ -107,6 +109,8 @@ namespace ocilib
             _data = core::OnAllocate(new otext[count], count);
 
             memset(_data, 0, count * sizeof(otext));
+
+            _sizes = core::OnAllocate(new unsigned int[_elemCount], _elemCount);
         }
 
         template<>
@@ -117,12 +121,36 @@ namespace ocilib
             _data = core::OnAllocate(new unsigned char[count], count);
 
             memset(_data, 0, count * sizeof(unsigned char));
+
+            _sizes = core::OnAllocate(new unsigned int[_elemCount], _elemCount);
         }
 
         template<class T>
         void BindArray::BindArrayObject<T>::FreeData() const
         {
             delete[] core::OnDeallocate(_data);
+            delete[] core::OnDeallocate(_sizes);
+        }
+
+        template<class T>
+        OCI_Bind* BindArray::BindArrayObject<T>::GetBind()
+        {
+            /* the bind handle is resolved once as it remains the same for the bind object lifetime */
+
+            if (_bind == nullptr)
+            {
+                _bind = core::Check(OCI_GetBind2(_statement, GetName().c_str()));
+            }
+
+            return _bind;
+        }
+
+        template<class T>
+        unsigned int BindArray::BindArrayObject<T>::GetCopyCount() const
+        {
+            const unsigned int vectorSize = static_cast<unsigned int>(_vector.size());
+
+            return (std::min)((std::min)(vectorSize, _elemCount), GetSize());
         }
 
         template<class T>
@@ -158,21 +186,23 @@ namespace ocilib
         template<>
         inline void BindArray::BindArrayObject<ocilib::Raw>::SetInData()
         {
-            std::vector<Raw>::iterator it, it_end;
-
-            unsigned int index = 0;
-            const unsigned int currElemCount = GetSize();
+            const unsigned int count = GetCopyCount();
 
-            for (it = _vector.begin(), it_end = _vector.end(); it != it_end && index < _elemCount && index < currElemCount; ++it, ++index)
+            for (unsigned int index = 0; index < count; ++index)
             {
-                Raw& value = *it;
+                Raw& value = _vector[index];
 
                 if (!value.empty())
                 {
                     memcpy(_data + (_elemSize * index), &value[0], value.size());
                 }
 
-                OCI_BindSetDataSizeAtPos(OCI_GetBind2(_statement, GetName().c_str()), index + 1, static_cast<unsigned int>(value.size()));
+                _sizes[index] = static_cast<unsigned int>(value.size());
+            }
+
+            if (count > 0)
+            {
+                core::Check(OCI_BindSetDataSizes(GetBind(), _sizes, count));
             }
         }
 
@@ -193,36 +223,36 @@ namespace ocilib
         template<>
         inline void BindArray::BindArrayObject<ocilib::ostring>::SetOutData()
         {
-            std::vector<ostring>::iterator it, it_end;
-
-            OCI_Bind* pBind = core::Check(OCI_GetBind2(_statement, GetName().c_str()));
+            const unsigned int count = GetCopyCount();
 
-            unsigned int index = 0;
-            const unsigned int currElemCount = GetSize();
+            if (count > 0)
+            {
+                core::Check(OCI_BindGetDataSizes(GetBind(), _sizes, count));
+            }
 
-            for (it = _vector.begin(), it_end = _vector.end(); it != it_end && index < _elemCount && index < currElemCount; ++it, ++index)
+            for (unsigned int index = 0; index < count; ++index)
             {
                 otext* currData = _data + (_elemSize * sizeof(otext) * index);
 
-                (*it).assign(currData, currData + core::Check(OCI_BindGetDataSizeAtPos(pBind, index + 1)));
+                _vector[index].assign(currData, currData + _sizes[index]);
             }
         }
 
         template<>
         inline void BindArray::BindArrayObject<ocilib::Raw>::SetOutData()
         {
-            std::vector<Raw>::iterator it, it_end;
+            const unsigned int count = GetCopyCount();
 
-            OCI_Bind* pBind = core::Check(OCI_GetBind2(_statement, GetName().c_str()));
-
-            unsigned int index = 0;
-            const unsigned int currElemCount = GetSize();
+            if (count > 0)
+            {
+                core::Check(OCI_BindGetDataSizes(GetBind(), _sizes, count));
+            }
 
-            for (it = _vector.begin(), it_end = _vector.end(); it != it_end && index < _elemCount && index < currElemCount; ++it, ++index)
+            for (unsigned int index = 0; index < count; ++index)
             {
                 unsigned char* currData = _data + (_elemSize * index);
 
-                (*it).assign(currData, currData + core::Check(OCI_BindGetDataSizeAtPos(pBind, index + 1)));
+                _vector[index].assign(currData, currData + _sizes[index]);
             }
         }
 
@@ -0,0 +1,125 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2025 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ocilibcpp/types.hpp"
+
+namespace ocilib
+{
+    namespace support
+    {
+        /**
+        * @brief Internal usage.
+        * Allow resolving the C API column type a C++ type can be mapped from
+        */
+        template<class T> struct ColumnTypeResolver {};
+
+        template<> struct ColumnTypeResolver<short> { enum { Value = TypeNumeric }; };
+        template<> struct ColumnTypeResolver<unsigned short> { enum { Value = TypeNumeric }; };
+        template<> struct ColumnTypeResolver<int> { enum { Value = TypeNumeric }; };
+        template<> struct ColumnTypeResolver<unsigned int> { enum { Value = TypeNumeric }; };
+        template<> struct ColumnTypeResolver<big_int> { enum { Value = TypeNumeric }; };
+        template<> struct ColumnTypeResolver<big_uint> { enum { Value = TypeNumeric }; };
+        template<> struct ColumnTypeResolver<double> { enum { Value = TypeNumeric }; };
+        template<> struct ColumnTypeResolver<float> { enum { Value = TypeNumeric }; };
+        template<> struct ColumnTypeResolver<ostring> { enum { Value = TypeString }; };
+        template<> struct ColumnTypeResolver<Raw> { enum { Value = TypeRaw }; };
+        template<> struct ColumnTypeResolver<Date> { enum { Value = TypeDate }; };
+
+#ifdef OCILIBPP_HAS_VARIADIC
+
+        /**
+        * @brief Internal usage.
+        * Allow resolving the type of a class member from a pointer to member type
+        */
+        template<class T> struct MemberTypeResolver {};
+
+        template<class C, class T> struct MemberTypeResolver<T C::*> { typedef T Type; };
+
+        /**
+        * @brief Internal usage.
+        * Allow resolving the column blocks type from a tuple of pointers to members
+        */
+        template<class T> struct MemberBlocksResolver {};
+
+        template<class... T> struct MemberBlocksResolver<std::tuple<T...>>
+        {
+            typedef std::tuple<ColumnBlock<typename MemberTypeResolver<T>::Type>...> Type;
+        };
+
+        /* Types described by a RowTraits specialization */
+
+        template<class T>
+        struct RowLayout
+        {
+            typedef typename std::decay<decltype(RowTraits<T>::Fields())>::type Fields;
+            typedef typename MemberBlocksResolver<Fields>::Type Blocks;
+
+            enum { Count = std::tuple_size<Fields>::value };
+
+            template<std::size_t I>
+            struct Field
+            {
+                typedef typename MemberTypeResolver<typename std::tuple_element<I, Fields>::type>::Type Type;
+
+                static Type& Get(T& row, const Fields& fields)
+                {
+                    return row.*std::get<I>(fields);
+                }
+            };
+
+            static Fields GetFields()
+            {
+                return RowTraits<T>::Fields();
+            }
+        };
+
+        /* Tuples */
+
+        template<class... T>
+        struct RowLayout<std::tuple<T...>>
+        {
+            typedef std::tuple<> Fields;
+            typedef std::tuple<ColumnBlock<T>...> Blocks;
+
+            enum { Count = sizeof...(T) };
+
+            template<std::size_t I>
+            struct Field
+            {
+                typedef typename std::tuple_element<I, std::tuple<T...>>::type Type;
+
+                static Type& Get(std::tuple<T...>& row, const Fields&)
+                {
+                    return std::get<I>(row);
+                }
+            };
+
+            static Fields GetFields()
+            {
+                return Fields();
+            }
+        };
+
+#endif
+
+    }
+}
@@ -135,10 +135,15 @@ namespace ocilib
                 void AllocData();
                 void FreeData() const;
 
+                OCI_Bind* GetBind();
+                unsigned int GetCopyCount() const;
+
                 const ocilib::Statement& _statement;
                 ostring _name;
                 ObjectVector& _vector;
                 NativeType* _data;
+                OCI_Bind* _bind;
+                unsigned int* _sizes;
                 bool _isPlSqlTable;
                 unsigned int _mode;
                 unsigned int _elemCount;
@@ -228,5 +233,15 @@ namespace ocilib
             std::vector<BindObject*> _bindObjects;
             const ocilib::Statement& _statement;
         };
+
+#ifdef OCILIBPP_HAS_VARIADIC
+
+        /**
+        * @brief Internal usage.
+        * Allow accessing the fields of a row type filled by RowMapper
+        */
+        template<class T> struct RowLayout;
+
+#endif
     }
 }
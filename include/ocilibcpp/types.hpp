@@ -21,12 +21,28 @@
 #pragma once
 
 #include <cstddef>
+#include <exception>
 #include <iterator>
 #include <vector>
 
 #include "ocilibcpp/core.hpp"
 #include "ocilibcpp/support.hpp"
 
+#ifdef OCILIBPP_HAS_VARIADIC
+#include <tuple>
+#include <type_traits>
+#endif
+
+#ifdef OCILIBPP_HAS_FUTURE
+#include <future>
+#endif
+
+#ifdef OCILIBPP_HAS_COROUTINE
+#include <deque>
+#include <functional>
+#include <thread>
+#endif
+
 // ReSharper disable CppClangTidyCppcoreguidelinesMacroUsage
 // ReSharper disable CppClangTidyModernizeUseNodiscard
 // ReSharper disable CppClangTidyHicppSpecialMemberFunctions
@@ -363,6 +379,13 @@ namespace ocilib
         template<class T>
         friend T core::Check(T result);
         friend class Statement;
+        friend class Pool;
+        template<class>
+        friend class ColumnBlock;
+#ifdef OCILIBPP_HAS_VARIADIC
+        template<class>
+        friend class RowMapper;
+#endif
 
     public:
 
@@ -472,6 +495,7 @@ namespace ocilib
 
         Exception() noexcept;
         Exception(OCI_Error* err) noexcept;
+        Exception(int errLib, const otext* message) noexcept;
 
         void SetWhat(const otext* value) noexcept;
         void CopyWhat(const char* value) noexcept;
@@ -586,7 +610,19 @@ namespace ocilib
             /** Enable support for multi-threading */
             Threaded = OCI_ENV_THREADED,
             /** Enable support for events related to subscriptions, HA and AQ notifications */
-            Events = OCI_ENV_EVENTS
+            Events = OCI_ENV_EVENTS,
+            /** Disable the accounting of allocated bytes (see Environment::GetAllocatedBytes()) */
+            NoMemoryStats = OCI_ENV_NO_MEMORY_STATS,
+            /** Allocate connection owned internal structures from per connection memory arenas */
+            MemoryArena = OCI_ENV_MEMORY_ARENA,
+            /** Enable per memory type allocation profiling */
+            MemoryProfiling = OCI_ENV_MEMORY_PROFILING,
+            /** Reuse OCI descriptor arrays through an environment wide pool */
+            DescriptorPool = OCI_ENV_DESCRIPTOR_POOL,
+            /** Share type info descriptions between connections to the same database */
+            TypeInfoCache = OCI_ENV_TYPEINFO_CACHE,
+            /** Enable statement execution statistics (see Statement::GetStats()) */
+            StatementStats = OCI_ENV_STATEMENT_STATS
         };
 
         /**
@@ -817,6 +853,92 @@ namespace ocilib
         */
         typedef core::Flags<AllocatedBytesValues> AllocatedBytesFlags;
 
+        /**
+        * @brief
+        * Memory profile enumerated values
+        *
+        */
+        enum MemoryProfileValues
+        {
+            /** Number of bytes currently allocated */
+            ProfileBytes = OCI_MPV_BYTES,
+            /** Number of blocks currently allocated */
+            ProfileCount = OCI_MPV_COUNT,
+            /** Highest number of bytes allocated at once */
+            ProfilePeak = OCI_MPV_PEAK
+        };
+
+        /**
+        * @brief
+        * Memory profile value
+        *
+        * Possible values are Environment::MemoryProfileValues
+        *
+        */
+        typedef core::Enum<MemoryProfileValues> MemoryProfileValue;
+
+        /**
+        * @brief
+        * Descriptor pool enumerated values
+        *
+        */
+        enum DescriptorPoolValues
+        {
+            /** Number of descriptor array allocations served from the pool */
+            DescriptorPoolHits = OCI_DPV_HITS,
+            /** Number of descriptor array allocations forwarded to the Oracle client */
+            DescriptorPoolMisses = OCI_DPV_MISSES,
+            /** Number of descriptor arrays currently pooled */
+            DescriptorPoolSize = OCI_DPV_SIZE
+        };
+
+        /**
+        * @brief
+        * Descriptor pool value
+        *
+        * Possible values are Environment::DescriptorPoolValues
+        *
+        */
+        typedef core::Enum<DescriptorPoolValues> DescriptorPoolValue;
+
+        /**
+        * @brief
+        * Statement statistics enumerated values
+        *
+        */
+        enum StatementStatsValues
+        {
+            /** Number of prepare calls */
+            StatsPrepareCount = OCI_SSV_PREPARE_COUNT,
+            /** Time spent in prepare calls (microseconds) */
+            StatsPrepareTime = OCI_SSV_PREPARE_TIME,
+            /** Number of execute calls */
+            StatsExecuteCount = OCI_SSV_EXECUTE_COUNT,
+            /** Time spent in execute calls (microseconds) */
+            StatsExecuteTime = OCI_SSV_EXECUTE_TIME,
+            /** Number of fetch calls */
+            StatsFetchCount = OCI_SSV_FETCH_COUNT,
+            /** Time spent in fetch calls (microseconds) */
+            StatsFetchTime = OCI_SSV_FETCH_TIME,
+            /** Number of rows fetched */
+            StatsRowsFetched = OCI_SSV_ROWS_FETCHED,
+            /** Estimated number of server round trips */
+            StatsRoundTrips = OCI_SSV_ROUND_TRIPS,
+            /** Size of the bind buffers sent by execute calls */
+            StatsBindBytes = OCI_SSV_BIND_BYTES,
+            /** Size of the define buffers filled by fetch calls */
+            StatsDefineBytes = OCI_SSV_DEFINE_BYTES
+        };
+
+        /**
+        * @brief
+        * Statement statistics value
+        *
+        * Possible values are Environment::StatementStatsValues
+        *
+        */
+        typedef core::Enum<StatementStatsValues> StatementStatsValue;
+
         /**
         * @brief
         * Locales string enumerated values
@@ -934,6 +1056,24 @@ namespace ocilib
          */
         static void Initialize(EnvironmentFlags mode = Environment::Default, const ostring& libpath = OTEXT(""));
 
+        /**
+         * @brief
+         * Install custom memory allocation routines
+         *
+         * @param allocFunc   - malloc() like routine
+         * @param reallocFunc - realloc() like routine
+         * @param freeFunc    - free() like routine
+         *
+         * @note
+         * Routines are used for all memory allocated by OCILIB and by the Oracle client.
+         * Passing nullptr for a routine restores the C runtime default one.
+         *
+         * @warning
+         * It must be called before Initialize() or after Cleanup()
+         *
+         */
+        static void SetMemoryHandlers(POCI_MEM_ALLOC allocFunc, POCI_MEM_REALLOC reallocFunc, POCI_MEM_FREE freeFunc);
+
         /**
          * @brief
          * Clean up all resources allocated by the environment
@@ -991,9 +1131,89 @@ namespace ocilib
         *
         * @param type : type of memory to request
         *
+        * @note
+        * Returns 0 if the environment was initialized with Environment::NoMemoryStats
+        *
         */
         static big_uint GetAllocatedBytes(AllocatedBytesFlags type);
 
+        /**
+        * @brief
+        * Return the number of entries of the memory allocation profile
+        *
+        * @note
+        * Each entry corresponds to a type of memory block (statements, define buffers, bind buffers, strings, ...)
+        * Entries are indexed from 1 to the returned value
+        *
+        */
+        static unsigned int GetMemoryProfileSize();
+
+        /**
+        * @brief
+        * Return the name of the given memory allocation profile entry
+        *
+        * @param index - Profile entry index (starting at 1)
+        *
+        */
+        static ostring GetMemoryProfileName(unsigned int index);
+
+        /**
+        * @brief
+        * Return a value of the given memory allocation profile entry
+        *
+        * @param index - Profile entry index (starting at 1)
+        * @param value - Value to retrieve
+        *
+        * @note
+        * Returns 0 unless the environment was initialized with Environment::MemoryProfiling
+        *
+        */
+        static big_uint GetMemoryProfileValue(unsigned int index, MemoryProfileValue value);
+
+        /**
+        * @brief
+        * Return a statistic of the OCI descriptor pool
+        *
+        * @param value - Value to retrieve
+        *
+        * @note
+        * Returns 0 unless the environment was initialized with Environment::DescriptorPool
+        *
+        */
+        static big_uint GetDescriptorPoolValue(DescriptorPoolValue value);
+
+        /**
+        * @brief
+        * Return the number of SQL statements for which statistics have been aggregated
+        *
+        * @note
+        * Entries are identified by the SQL text
+        *
+        */
+        static unsigned int GetSqlStatsSize();
+
+        /**
+        * @brief
+        * Return the SQL text of the given statistics entry
+        *
+        * @param index - Statistics entry index (starting at 1)
+        *
+        */
+        static ostring GetSqlStatsName(unsigned int index);
+
+        /**
+        * @brief
+        * Return an aggregated execution statistic of the given statistics entry
+        *
+        * @param index - Statistics entry index (starting at 1)
+        * @param value - Value to retrieve
+        *
+        * @note
+        * No entries are available unless the environment was initialized with Environment::StatementStats
+        *
+        */
+        static big_uint GetSqlStatsValue(unsigned int index, StatementStatsValue value);
+
         /**
         * @brief
         * Return true if the environment has been successfully initialized
@@ -1443,6 +1663,175 @@ namespace ocilib
         static AnyPointer GetValue(const ostring& name);
     };
 
+#ifdef OCILIBPP_HAS_COROUTINE
+
+    /**
+     * @brief
+     * Pool of worker threads running OCILIB calls awaited by C++20 coroutines
+     *
+     * Awaitable methods taking an executor (e.g. Statement::ExecuteAsync(Executor&, const ostring&))
+     * run the blocking OCILIB call on one of the executor threads and resume the awaiting
+     * coroutine on that thread once the call is completed.
+     * Thus, coroutines of an application share the executor threads instead of blocking their own.
+     *
+     * @note
+     * The environment must be initialized with Environment::Threaded.
+     *
+     * @warning
+     * An executor must outlive the operations posted to it and must not be destroyed from one of its threads.
+     *
+     */
+    class Executor
+    {
+    public:
+
+        /**
+         * @brief
+         * Create an executor and start its worker threads
+         *
+         * @param threads - Number of worker threads
+         *
+         */
+        explicit Executor(unsigned int threads = 1);
+
+        /**
+         * @brief
+         * Wait for the pending jobs to complete and stop the worker threads
+         *
+         */
+        ~Executor() noexcept;
+
+        /**
+         * @brief
+         * Return the number of worker threads
+         *
+         */
+        unsigned int GetThreadCount() const;
+
+        /**
+         * @brief
+         * Queue the given job to be run by one of the worker threads
+         *
+         * @param job - Function to run
+         *
+         * @warning
+         * The job must not throw exceptions
+         *
+         */
+        void Post(std::function<void()> job);
+
+        /**
+         * @brief
+         * Return an awaitable operation running the given function on one of the worker threads
+         *
+         * @tparam T   - Function return type
+         * @param func - Function to run
+         *
+         */
+        template<class T>
+        AsyncOperation<T> Schedule(std::function<T()> func);
+
+    private:
+
+        Executor(const Executor& other) = delete;
+        Executor& operator = (const Executor& other) = delete;
+
+        void Run();
+
+        std::mutex _mutex;
+        std::condition_variable _condition;
+        std::deque<std::function<void()> > _jobs;
+        std::vector<std::thread> _threads;
+        bool _stopping;
+    };
+
+    /**
+     * @brief
+     * Awaitable operation run by an Executor
+     *
+     * Awaiting it suspends the coroutine until the operation is completed
+     * on one of the executor threads that then resumes the coroutine.
+     * Exceptions thrown by the operation are rethrown in the awaiting coroutine.
+     *
+     * @tparam T - Operation result type
+     *
+     */
+    template<class T>
+    class AsyncOperation
+    {
+    public:
+
+        /**
+         * @brief
+         * Create an operation running the given function on the given executor
+         *
+         * @param executor - Executor running the operation
+         * @param func     - Function to run
+         *
+         */
+        AsyncOperation(Executor& executor, std::function<T()> func);
+
+        bool await_ready() const noexcept;
+        void await_suspend(std::coroutine_handle<> handle);
+        T await_resume();
+
+    private:
+
+        Executor* _executor;
+        std::function<T()> _func;
+        core::AsyncResult<T> _result;
+    };
+
+    /**
+     * @brief
+     * Coroutine return type allowing to await OCILIB asynchronous operations
+     *
+     * A task starts when awaited from another coroutine or when Get() is called.
+     *
+     * @tparam T - Coroutine result type
+     *
+     */
+    template<class T = void>
+    class Task
+    {
+        friend class core::TaskPromise<T>;
+
+    public:
+
+        typedef core::TaskPromise<T> promise_type;
+
+        Task(Task&& other) noexcept;
+        ~Task() noexcept;
+
+        bool await_ready() const noexcept;
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) noexcept;
+        T await_resume();
+
+        /**
+         * @brief
+         * Start the task and block the calling thread until it is completed
+         *
+         * @return
+         * The coroutine result. Exceptions thrown by the coroutine are rethrown
+         *
+         * @warning
+         * Must be called only once and not for a task awaited by another coroutine
+         *
+         */
+        T Get();
+
+    private:
+
+        explicit Task(std::coroutine_handle<promise_type> handle) noexcept;
+
+        Task(const Task& other) = delete;
+        Task& operator = (const Task& other) = delete;
+
+        std::coroutine_handle<promise_type> _handle;
+    };
+
+#endif
+
     /**
       * @brief
       * A connection or session Pool.
@@ -1476,6 +1865,30 @@ namespace ocilib
         */
         typedef core::Enum<PoolTypeValues> PoolType;
 
+        /**
+         * @brief
+         * Parallel query partitioning modes enumerated values
+         *
+         */
+        enum ParallelQueryModeValues
+        {
+            /** Ranges of rowids holding the same number of blocks of a table */
+            ParallelRowid = OCI_PQM_ROWID,
+            /** Hash buckets */
+            ParallelHash = OCI_PQM_HASH,
+            /** User provided ranges */
+            ParallelRange = OCI_PQM_RANGE
+        };
+
+        /**
+        * @brief
+        * Parallel query partitioning mode
+        *
+        * Possible values are Pool::ParallelQueryModeValues
+        *
+        */
+        typedef core::Enum<ParallelQueryModeValues> ParallelQueryMode;
+
         /**
          * @brief
          * Default constructor
@@ -1672,6 +2085,49 @@ namespace ocilib
          *
          */
         void SetStatementCacheSize(unsigned int value);
+
+        /**
+         * @brief
+         * Run the partitions of a query concurrently over connections of the pool
+         *
+         * @tparam T - type of the row consumer
+         *
+         * @param sql        - SELECT statement of a partition
+         * @param mode       - Partitioning mode
+         * @param partitions - Number of partitions
+         * @param args       - Partitioning arguments
+         * @param consumer   - Row consumer
+         * @param fetchSize  - Fetch array size of partitions (0 for default)
+         *
+         * @note
+         * The row consumer must conform to the following prototype:
+         * bool consumer(const Resultset& rs, unsigned int partition)
+         * It shall return true to continue or false to stop all partitions
+         *
+         * @note
+         * 'args' holds the table name for Pool::ParallelRowid, the low and high bounds of
+         * each partition for Pool::ParallelRange and is not used for Pool::ParallelHash.
+         * See OCI_ParallelQuery() for the binds the SQL statement must use for each mode
+         *
+         * @note
+         * Rows of all partitions are fetched concurrently and handed to the consumer one at a time.
+         * Exceptions thrown by the consumer stop all partitions and are rethrown by this method.
+         *
+         * @warning
+         * The environment must be initialized with Environment::Threaded
+         *
+         */
+        template<class T>
+        void ParallelQuery(const ostring& sql, ParallelQueryMode mode, unsigned int partitions,
+                           const std::vector<ostring>& args, T consumer, unsigned int fetchSize = 0);
+
+    private:
+
+        template<typename T>
+        struct ParallelQueryContext;
+
+        template<typename T>
+        static boolean ParallelQueryFetch(OCI_Resultset* rs, unsigned int partition, void* ctx);
     };
 
     /**
@@ -1839,6 +2295,30 @@ namespace ocilib
         */
         typedef core::Enum<SessionTraceValues> SessionTrace;
 
+        /**
+        * @brief
+        * Prepared statement cache enumerated values
+        *
+        */
+        enum PreparedCacheValues
+        {
+            /** Number of prepare calls served from the cache */
+            PreparedCacheHits = OCI_PCV_HITS,
+            /** Number of prepare calls forwarded to OCI */
+            PreparedCacheMisses = OCI_PCV_MISSES,
+            /** Number of statements currently parked in the cache */
+            PreparedCacheSize = OCI_PCV_SIZE
+        };
+
+        /**
+        * @brief
+        * Prepared statement cache value
+        *
+        * Possible values are Connection::PreparedCacheValues
+        *
+        */
+        typedef core::Enum<PreparedCacheValues> PreparedCacheValue;
+
         /**
         * @typedef TAFHandlerProc
         *
@@ -1947,9 +2427,30 @@ namespace ocilib
 
         /**
          * @brief
-         * Enable or disable auto commit mode (implicit commits after every SQL execution)
+         * Execute several prepared DML statements in a single server round trip
          *
-         * @param enabled - auto commit new status
+         * @param statements - Prepared statements with their variables bound
+         * @param rows       - Receives the number of rows affected by each statement
+         *
+         * @note
+         * The statements are executed in the given order within a generated anonymous PL/SQL block.
+         * An error raised by a statement does not stop the execution of the next ones.
+         * Statements in error report it with Statement::GetBatchErrors() and their affected rows are 0.
+         *
+         * @note
+         * See OCI_ExecuteBatch() for the supported statements and binds
+         *
+         * @return
+         * true if all statements have been successfully executed otherwise false
+         *
+         */
+        bool ExecuteBatch(const std::vector<Statement>& statements, std::vector<unsigned int>& rows);
+
+        /**
+         * @brief
+         * Enable or disable auto commit mode (implicit commits after every SQL execution)
+         *
+         * @param enabled - auto commit new status
          *
          */
         void SetAutoCommit(bool enabled);
@@ -2326,6 +2827,40 @@ namespace ocilib
          */
         void SetStatementCacheSize(unsigned int value);
 
+        /**
+         * @brief
+         * Return the maximum number of statements kept in the OCILIB prepared statement cache
+         *
+         * @note
+         * Default value is 0 (cache disabled)
+         *
+         */
+        unsigned int GetPreparedCacheSize() const;
+
+        /**
+         * @brief
+         * Set the maximum number of statements kept in the OCILIB prepared statement cache
+         *
+         * @param value - maximum number of statements in the cache (0 disables the cache)
+         *
+         * @note
+         * Freed statements are parked with their binds and defines and handed back to the next
+         * statement prepared with the same SQL text and bind configuration.
+         * Statements with binds on program variables are not cached.
+         * See OCI_SetPreparedCacheSize() for details.
+         *
+         */
+        void SetPreparedCacheSize(unsigned int value);
+
+        /**
+         * @brief
+         * Return statistics of the OCILIB prepared statement cache
+         *
+         * @param value - Value to retrieve
+         *
+         */
+        big_uint GetPreparedCacheValue(PreparedCacheValue value) const;
+
         /**
          * @brief
          * Return the default LOB prefetch buffer size for the connection
@@ -4867,6 +5402,21 @@ namespace ocilib
         */
         TypeInfo GetSuperType() const;
 
+        /**
+        * @brief
+        * Invalidate type info descriptions kept in the environment wide type info cache
+        *
+        * @param name - Name of the object (optionally prefixed by its schema). All objects if empty
+        *
+        * @note
+        * The cache is enabled by passing Environment::TypeInfoCache to Environment::Initialize()
+        *
+        * @note
+        * Only TypeInfo objects retrieved afterwards are affected
+        *
+        */
+        static void Invalidate(const ostring& name = OTEXT(""));
+
     private:
 
         TypeInfo(OCI_TypeInfo* pTypeInfo, core::Handle* parent);
@@ -5958,6 +6508,7 @@ namespace ocilib
         friend class Long;
         friend class BindInfo;
         friend class BindObject;
+        friend class Connection;
 
     public:
 
@@ -6045,6 +6596,28 @@ namespace ocilib
         */
         typedef core::Enum<BindModeValues> BindMode;
 
+        /**
+        * @brief
+        * Big integer bind modes enumerated values
+        *
+        */
+        enum BigIntBindModeValues
+        {
+            /** big_int and big_uint values are converted to Oracle NUMBER buffers */
+            BigIntBindNumber = OCI_BIM_NUMBER,
+            /** big_int and big_uint values are bound as native 64 bits integers */
+            BigIntBindNative = OCI_BIM_NATIVE
+        };
+
+        /**
+        * @brief
+        * Big integer bind modes
+        *
+        * Possible values are Statement::BigIntBindModeValues
+        *
+        */
+        typedef core::Enum<BigIntBindModeValues> BigIntBindMode;
+
         /**
         * @brief
         * LONG data type mapping modes enumerated values
@@ -6217,6 +6790,131 @@ namespace ocilib
         template<class T, class U>
         unsigned int ExecutePrepared(T callback, U adapter);
 
+#ifdef OCILIBPP_HAS_FUTURE
+
+        /**
+        * @brief
+        * Execute the prepared SQL statement or PL/SQL block without blocking the calling thread
+        *
+        * @note
+        * The execution is performed by a worker thread of the statement connection.
+        * Thus, the environment must be initialized with Environment::Threaded.
+        *
+        * @note
+        * The returned future becomes ready once the execution is completed.
+        * It holds the exception thrown if the execution failed.
+        *
+        * @warning
+        * The statement and its connection must not be used until the execution is completed
+        *
+        */
+        std::future<void> ExecutePreparedAsync();
+
+        /**
+        * @brief
+        * Prepare the given SQL statement or PL/SQL block and execute it without blocking the calling thread
+        *
+        * @param sql  - SQL order - PL/SQL block
+        *
+        * @note
+        * See ExecutePreparedAsync() for asynchronous execution requirements
+        *
+        */
+        std::future<void> ExecuteAsync(const ostring& sql);
+
+#endif
+
+#ifdef OCILIBPP_HAS_COROUTINE
+
+        /**
+        * @brief
+        * Return an awaitable operation executing the prepared SQL statement or PL/SQL block
+        *
+        * @param executor - Executor running the execution
+        *
+        * @note
+        * Usage: co_await statement.ExecutePreparedAsync(executor);
+        *
+        * @warning
+        * The statement must not be used until the operation is completed
+        *
+        */
+        AsyncOperation<void> ExecutePreparedAsync(Executor& executor);
+
+        /**
+        * @brief
+        * Return an awaitable operation preparing and executing the given SQL statement or PL/SQL block
+        *
+        * @param executor - Executor running the execution
+        * @param sql      - SQL order - PL/SQL block
+        *
+        * @note
+        * Usage: co_await statement.ExecuteAsync(executor, sql);
+        *
+        * @warning
+        * The statement must not be used until the operation is completed
+        *
+        */
+        AsyncOperation<void> ExecuteAsync(Executor& executor, const ostring& sql);
+
+#endif
+
+        /**
+        * @brief
+        * Execute the prepared array DML statement in chunks filled by the given row source
+        *
+        * @tparam T - type of the row source callback
+        *
+        * @param source - User defined row source
+        *
+        * @note
+        * The row source must conform to the following prototype:
+        * unsigned int source(unsigned int offset, unsigned int size)
+        * It shall fill the bound arrays from index 0 with at most 'size' rows starting at the
+        * global row 'offset' and return the number of rows filled or 0 when no rows are left
+        *
+        * @note
+        * The chunk size is the array size set with SetBindArraySize() before binding the arrays.
+        * Thus, only one chunk of rows is held in memory whatever the number of rows to execute.
+        *
+        * @note
+        * Errors raised by rows of a chunk do not stop the execution of the next chunks.
+        * If any row failed, an exception is thrown once all chunks are executed and GetBatchErrors()
+        * returns the errors of all chunks with Exception::GetRow() returning global row positions.
+        *
+        * @return
+        * The number of rows executed
+        *
+        */
+        template<class T>
+        unsigned int ExecuteArrayStream(T source);
+
+        /**
+        * @brief
+        * Execute the prepared array DML statement in chunks filled from the given range of rows
+        *
+        * @tparam I - type of the range iterators
+        * @tparam U - type of the row assignment callback
+        *
+        * @param first  - Iterator on the first row to execute
+        * @param last   - Iterator past the last row to execute
+        * @param assign - User defined row assignment callback
+        *
+        * @note
+        * The row assignment callback must conform to the following prototype:
+        * void assign(const T& row, unsigned int index)
+        * It shall write the given row at the given index of the bound arrays
+        *
+        * @note
+        * See ExecuteArrayStream(T source) for chunking and errors handling
+        *
+        * @return
+        * The number of rows executed
+        *
+        */
+        template<class I, class U>
+        unsigned int ExecuteArrayStream(I first, I last, U assign);
+
         /**
         * @brief
         * Execute the given SQL statement, retrieve all resultsets, and call the given callback for each row of each resultsets
@@ -6292,6 +6990,18 @@ namespace ocilib
         */
         ostring GetSqlIdentifier()  const;
 
+        /**
+        * @brief
+        * Return an execution statistic of the last SQL or PL/SQL statement prepared by the statement
+        *
+        * @param value - Value to retrieve
+        *
+        * @note
+        * Returns 0 unless the environment was initialized with Environment::StatementStats
+        *
+        */
+        big_uint GetStats(Environment::StatementStatsValue value) const;
+
         /**
         * @brief
         * Retrieve the resultset from an executed statement
@@ -6589,6 +7299,112 @@ namespace ocilib
         template<class T, class U>
         void Bind(const ostring& name, std::vector<T>& values, U extraInfo, BindInfo::BindDirection mode, BindInfo::VectorType type = BindInfo::AsArray);
 
+        /**
+        * @brief
+        * Bind a contiguous array of host variables without intermediate buffer
+        *
+        * @tparam T  - C++ type of the host variables
+        *
+        * @param name       - Bind name
+        * @param values     - Pointer to the first host variable
+        * @param count      - Number of host variables
+        * @param mode       - bind direction mode
+        * @param type       - array type (regular array or PL/SQL table)
+        * @param indicators - Optional caller owned array of null indicators (-1 : null, 0 : not null)
+        *
+        * @note
+        * Unlike vector binds, OCI reads and writes directly the caller memory.
+        * No copy is performed before and after each execution and values are not resized.
+        * The storage (and the indicators array if provided) must remain valid while the statement uses the bind.
+        * For regular arrays, count must be greater or equal to Statement::GetBindArraySize().
+        *
+        * @warning
+        * This method has built-in specialized versions for short, unsigned short, int, unsigned int,
+        * big_int, big_uint, float and double.
+        * big_int and big_uint values are converted internally unless Statement::SetBigIntBindMode()
+        * was called with Statement::BigIntBindNative prior to the bind call.
+        *
+        */
+        template<class T>
+        void BindInPlace(const ostring& name, T* values, unsigned int count, BindInfo::BindDirection mode, BindInfo::VectorType type = BindInfo::AsArray, short* indicators = nullptr);
+
+        /**
+        * @brief
+        * Bind the storage of a vector of host variables without intermediate buffer
+        *
+        * @tparam T  - C++ type of the host variables
+        *
+        * @param name       - Bind name
+        * @param values     - Vector of host variables
+        * @param mode       - bind direction mode
+        * @param type       - vector type (regular array or PL/SQL table)
+        * @param indicators - Optional caller owned array of null indicators
+        *
+        * @note
+        * See the pointer version of BindInPlace(). The vector must not be resized while bound.
+        *
+        */
+        template<class T>
+        void BindInPlace(const ostring& name, std::vector<T>& values, BindInfo::BindDirection mode, BindInfo::VectorType type = BindInfo::AsArray, short* indicators = nullptr);
+
+        /**
+        * @brief
+        * Bind a C array of host variables without intermediate buffer
+        *
+        * @tparam T  - C++ type of the host variables
+        * @tparam N  - Number of host variables
+        *
+        * @param name       - Bind name
+        * @param values     - Array of host variables
+        * @param mode       - bind direction mode
+        * @param type       - array type (regular array or PL/SQL table)
+        * @param indicators - Optional caller owned array of null indicators
+        *
+        * @note
+        * See the pointer version of BindInPlace()
+        *
+        */
+        template<class T, std::size_t N>
+        void BindInPlace(const ostring& name, T(&values)[N], BindInfo::BindDirection mode, BindInfo::VectorType type = BindInfo::AsArray, short* indicators = nullptr);
+
+        /**
+        * @brief
+        * Bind a contiguous buffer of fixed size strings without intermediate buffer
+        *
+        * @param name       - Bind name
+        * @param values     - Buffer holding count strings of (maxSize + 1) characters each
+        * @param maxSize    - Maximum number of characters of each string
+        * @param count      - Number of strings
+        * @param mode       - bind direction mode
+        * @param type       - array type (regular array or PL/SQL table)
+        * @param indicators - Optional caller owned array of null indicators
+        * @param lengths    - Optional caller owned array of string sizes in bytes (null terminator included)
+        *
+        * @note
+        * See the pointer version of BindInPlace() and OCI_BindSetLengthArray()
+        *
+        */
+        void BindInPlace(const ostring& name, otext* values, unsigned int maxSize, unsigned int count, BindInfo::BindDirection mode, BindInfo::VectorType type = BindInfo::AsArray, short* indicators = nullptr, unsigned short* lengths = nullptr);
+
+        /**
+        * @brief
+        * Bind a contiguous buffer of fixed size raw values without intermediate buffer
+        *
+        * @param name       - Bind name
+        * @param values     - Buffer holding count raw values of maxSize bytes each
+        * @param maxSize    - Maximum size in bytes of each raw value
+        * @param count      - Number of raw values
+        * @param mode       - bind direction mode
+        * @param type       - array type (regular array or PL/SQL table)
+        * @param indicators - Optional caller owned array of null indicators
+        * @param lengths    - Optional caller owned array of raw values sizes in bytes
+        *
+        * @note
+        * See the pointer version of BindInPlace() and OCI_BindSetLengthArray()
+        *
+        */
+        void BindInPlace(const ostring& name, unsigned char* values, unsigned int maxSize, unsigned int count, BindInfo::BindDirection mode, BindInfo::VectorType type = BindInfo::AsArray, short* indicators = nullptr, unsigned short* lengths = nullptr);
+
         /**
         * @brief
         * Register a host variable as an output for a column present in a SQL RETURNING INTO  clause
@@ -6712,6 +7528,29 @@ namespace ocilib
         */
         BindMode GetBindMode() const;
 
+        /**
+        * @brief
+        * Set the big integer bind mode used for subsequent big_int and big_uint binding calls
+        *
+        * @param value - big integer bind mode value
+        *
+        * @note
+        * Statement::BigIntBindNative avoids converting each value to and from Oracle NUMBER buffers
+        * at every execution. Refer to OCI_SetBindBigIntMode() for more details.
+        *
+        */
+        void SetBigIntBindMode(BigIntBindMode value);
+
+        /**
+        * @brief
+        * Return the big integer bind mode used for subsequent big_int and big_uint binding calls
+        *
+        * @note
+        * Default value is Statement::BigIntBindNumber
+        *
+        */
+        BigIntBindMode GetBigIntBindMode() const;
+
         /**
         * @brief
         * Set the number of rows fetched per internal server fetch call
@@ -6783,6 +7622,58 @@ namespace ocilib
         */
         unsigned int GetPrefetchMemory() const;
 
+        /**
+        * @brief
+        * Set the amount of memory the fetch buffers of the statement resultsets can use
+        *
+        * @param value - memory budget in bytes (0 to disable)
+        *
+        * @note
+        * Default value is 0 and resultsets fetch GetFetchSize() rows per call.
+        * When a budget is set, fetch buffers are sized from the described row width and forward only
+        * resultsets grow the number of rows per fetch call while the observed throughput improves.
+        *
+        */
+        void SetFetchMemory(unsigned int value);
+
+        /**
+        * @brief
+        * Return the amount of memory the fetch buffers of the statement resultsets can use
+        *
+        * @note
+        * Default value is 0
+        *
+        */
+        unsigned int GetFetchMemory() const;
+
+        /**
+        * @brief
+        * Enable or disable fetching rows in background
+        *
+        * @param value - Enable/disable read-ahead
+        *
+        * @note
+        * When enabled, the next block of rows of forward only resultsets is fetched by a helper thread
+        * while the application consumes the current one.
+        * It requires the environment to be initialized with Environment::Threaded.
+        * See OCI_SetReadAhead() for supported column types.
+        *
+        * @note
+        * Default value is false
+        *
+        */
+        void SetReadAhead(bool value);
+
+        /**
+        * @brief
+        * Return true if rows are fetched in background otherwise false
+        *
+        * @note
+        * Default value is false
+        *
+        */
+        bool GetReadAhead() const;
+
         /**
         * @brief
         * Set the piece size for dynamic fetch operations (XMLTYPE, LONGs) 
@@ -6869,6 +7760,8 @@ namespace ocilib
 
         void SetLastBindMode(BindInfo::BindDirection mode);
 
+        void SetLastBindArrays(short* indicators, unsigned short* lengths);
+
         void SetInData() const;
         void SetOutData() const;
         void ClearBinds() const;
@@ -6885,11 +7778,31 @@ namespace ocilib
         template<typename M, class T, class U>
         void BindVector2(M& method, const ostring& name, std::vector<T>& values, BindInfo::BindDirection mode, U subType, BindInfo::VectorType type);
 
+        template<typename M, class T>
+        void BindInPlace1(M& method, const ostring& name, T* values, unsigned int count, BindInfo::BindDirection mode, BindInfo::VectorType type, short* indicators);
+
         template<typename T>
         unsigned int Fetch(T callback);
 
         template<typename T, typename U>
         unsigned int Fetch(T callback, U adapter);
+
+        template<typename T>
+        struct ArrayStreamContext;
+
+        template<typename I, typename U>
+        struct ArrayStreamRange;
+
+#ifdef OCILIBPP_HAS_FUTURE
+
+        struct AsyncExecuteContext;
+
+        static void AsyncExecuteHandler(OCI_Statement* stmt, unsigned int type, boolean result, void* ctx);
+
+#endif
+
+        template<typename T>
+        static unsigned int ArrayStreamFill(OCI_Statement* stmt, unsigned int offset, unsigned int size, void* ctx);
     };
 
     /**
@@ -6902,6 +7815,7 @@ namespace ocilib
     class Resultset : public core::HandleHolder<OCI_Resultset*>
     {
         friend class Statement;
+        friend class Pool;
     public:
 
         /**
@@ -7060,6 +7974,102 @@ namespace ocilib
         */
         bool Next();
 
+        /**
+        * @brief
+        * Fetch the next block of rows of the resultset
+        *
+        * @note
+        * The current row becomes the last row of the block.
+        * Column values of the block rows are accessed with GetColumnBlock().
+        * See OCI_FetchBlock() for more details
+        *
+        * @return
+        * The number of rows of the block or 0 if the end of the resultset is reached
+        *
+        */
+        unsigned int FetchBlock();
+
+        /**
+        * @brief
+        * Return a read-only view on the values of the given column for the rows of the current block
+        *
+        * @tparam T - C++ type of the values (supported numeric types, ostring, Raw or Date)
+        *
+        * @param index - Column position
+        *
+        * @note
+        * Column position starts at 1.
+        *
+        */
+        template<class T>
+        ColumnBlock<T> GetColumnBlock(unsigned int index) const;
+
+#ifdef OCILIBPP_HAS_VARIADIC
+
+        /**
+        * @brief
+        * Return a mapper filling rows of the given type from the resultset
+        *
+        * @tparam T - Row type: a std::tuple or a type described by a RowTraits specialization
+        *
+        * @note
+        * Row fields are mapped to the resultset columns by position and can be of any type
+        * supported by GetColumnBlock().
+        * Column types are checked once when calling this method and each field is then filled
+        * from the block buffers with a conversion resolved at compile time.
+        *
+        * @note
+        * The mapper fetches rows with FetchBlock().
+        * Thus, the resultset rows shall not be fetched with other methods while the mapper is in use.
+        *
+        * @warning
+        * An Exception with the internal error code OCI_ERR_NOT_COMPATIBLE is thrown
+        * if the number of columns or one of the column types does not match the row type
+        *
+        */
+        template<class T>
+        RowMapper<T> Map() const;
+
+#endif
+
+#ifdef OCILIBPP_HAS_FUTURE
+
+        /**
+        * @brief
+        * Fetch the next row of the resultset without blocking the calling thread
+        *
+        * @note
+        * The fetch is performed by a worker thread of the statement connection.
+        * Thus, the environment must be initialized with Environment::Threaded.
+        *
+        * @note
+        * The returned future becomes ready with the value Next() returned once the fetch is completed
+        *
+        * @warning
+        * The resultset, its statement and connection must not be used until the fetch is completed
+        *
+        */
+        std::future<bool> NextAsync();
+
+#endif
+
+#ifdef OCILIBPP_HAS_COROUTINE
+
+        /**
+        * @brief
+        * Return an awaitable operation fetching the next row of the resultset
+        *
+        * @param executor - Executor running the fetch
+        *
+        * @note
+        * The operation result is the value Next() returned. Rows can be iterated from a coroutine with:
+        * while (co_await resultset.NextAsync(executor)) { ... }
+        *
+        */
+        AsyncOperation<bool> NextAsync(Executor& executor);
+
+#endif
+
         /**
         * @brief
         * Fetch the previous row of the resultset
@@ -7249,8 +8259,284 @@ namespace ocilib
     private:
 
         Resultset(OCI_Resultset* resultset, core::Handle* parent);
+
+#ifdef OCILIBPP_HAS_FUTURE
+
+        struct AsyncFetchContext;
+
+        static void AsyncFetchHandler(OCI_Statement* stmt, unsigned int type, boolean result, void* ctx);
+
+#endif
     };
 
+    /**
+     * @brief
+     * Read-only view on the values of a resultset column for the rows of the current block
+     *
+     * Values are read from the resultset internal buffers without copying the whole column.
+     * The view is valid until the next rows are fetched from the server.
+     *
+     * @note
+     * An exception is thrown if the column type does not match the C++ type of the values.
+     *
+     * @tparam T - C++ type of the values (supported numeric types, ostring, Raw or Date)
+     *
+     */
+    template<class T>
+    class ColumnBlock
+    {
+        friend class Resultset;
+#ifdef OCILIBPP_HAS_VARIADIC
+        template<class>
+        friend class RowMapper;
+#endif
+
+    public:
+
+        /**
+        * @brief
+        * Create an empty block
+        *
+        */
+        ColumnBlock();
+
+        /**
+        * @brief
+        * Return the number of rows of the block
+        *
+        */
+        unsigned int GetCount() const;
+
+        /**
+        * @brief
+        * Check if the value of the given row is null
+        *
+        * @param index - Row position in the block
+        *
+        * @note
+        * Row position starts at 0.
+        *
+        */
+        bool IsNull(unsigned int index) const;
+
+        /**
+        * @brief
+        * Return the value of the given row or a default constructed value if the value is null
+        *
+        * @param index - Row position in the block
+        *
+        * @note
+        * Row position starts at 0.
+        *
+        */
+        T operator [] (unsigned int index) const;
+
+        /**
+        * @brief
+        * Return the raw column values of the block rows
+        *
+        * @note
+        * See OCI_GetColumnBlock() for the values format
+        *
+        */
+        const void* GetData() const;
+
+        /**
+        * @brief
+        * Return the size in bytes of a value in the GetData() array
+        *
+        */
+        unsigned int GetSize() const;
+
+    private:
+
+        typedef void (ColumnBlock::*Converter)(const unsigned char* value, unsigned int index, T& result) const;
+
+        ColumnBlock(OCI_Resultset* resultset, unsigned int index);
+
+        void Update(OCI_Resultset* resultset, unsigned int index);
+
+        void GetValue(unsigned int index, T& value) const;
+
+        template<class U>
+        static Converter GetConverter(unsigned int subtype, U*);
+
+        static Converter GetConverter(unsigned int subtype, ostring*);
+
+        static Converter GetConverter(unsigned int subtype, Raw*);
+
+        static Converter GetConverter(unsigned int subtype, Date*);
+
+        template<class U>
+        void GetNative(const unsigned char* value, unsigned int index, T& result) const;
+
+        void GetNumber(const unsigned char* value, unsigned int index, T& result) const;
+
+        void GetString(const unsigned char* value, unsigned int index, T& result) const;
+
+        void GetRaw(const unsigned char* value, unsigned int index, T& result) const;
+
+        void GetDate(const unsigned char* value, unsigned int index, T& result) const;
+
+        static big_uint NumberToInteger(const unsigned char* value, bool& negative);
+
+        static double NumberToDouble(const unsigned char* value);
+
+        const unsigned char* _data;
+        const short* _inds;
+        const unsigned short* _lens;
+        unsigned int _size;
+        unsigned int _count;
+        Converter _converter;
+    };
+
+#ifdef OCILIBPP_HAS_VARIADIC
+
+    /**
+     * @brief
+     * Describe the fields of a user defined type filled by Resultset::Map()
+     *
+     * Specializations shall provide a static method Fields() returning a std::tuple of
+     * pointers to the type members, in the order of the resultset columns:
+     *
+     * @code
+     * struct Employee { int id; ostring name; Date hired; };
+     *
+     * template<> struct ocilib::RowTraits<Employee>
+     * {
+     *     static std::tuple<int Employee::*, ostring Employee::*, Date Employee::*> Fields()
+     *     {
+     *         return std::make_tuple(&Employee::id, &Employee::name, &Employee::hired);
+     *     }
+     * };
+     * @endcode
+     *
+     * @tparam T - User defined row type
+     *
+     */
+    template<class T>
+    struct RowTraits
+    {
+    };
+
+    /**
+     * @brief
+     * Fill rows of a given type from the successive blocks of a resultset
+     *
+     * Row fields are filled from the resultset block buffers with conversions resolved at compile time
+     * and from the column types when the mapper is created.
+     * Null values are mapped to default constructed values.
+     *
+     * @note
+     * Fields of the current row are updated in place by Next(). Date fields keep the same handle
+     * from one row to the next, use Date::Clone() to keep a date value beyond the current row.
+     *
+     * @tparam T - Row type: a std::tuple or a type described by a RowTraits specialization
+     *
+     */
+    template<class T>
+    class RowMapper
+    {
+        friend class Resultset;
+
+    public:
+
+        /**
+        * @brief
+        * Fill the current row with the next row of the resultset
+        *
+        * @return
+        * true on success otherwise false if the end of the resultset is reached
+        *
+        */
+        bool Next();
+
+        /**
+        * @brief
+        * Return the current row
+        *
+        */
+        const T& Get() const;
+
+        /**
+        * @brief
+        * Check if the value of the given field is null for the current row
+        *
+        * @param index - Field position
+        *
+        * @note
+        * Field position starts at 1.
+        *
+        */
+        bool IsNull(unsigned int index) const;
+
+        /**
+        * @brief
+        * Fetch all remaining rows and call the given callback for each row
+        *
+        * @param callback - User defined callback
+        *
+        * @note
+        * The user defined callback function must conform to the following prototype:
+        * bool callback(const T &)
+        * It shall return true to continue fetching the resultset or false to stop the fetch
+        *
+        * @return
+        * The number of rows processed
+        *
+        */
+        template<class U>
+        unsigned int ForEach(U callback);
+
+    private:
+
+        typedef support::RowLayout<T> Layout;
+
+        template<std::size_t I>
+        using HasField = std::integral_constant<bool, (I < static_cast<std::size_t>(Layout::Count))>;
+
+        RowMapper(const Resultset& resultset);
+
+        template<std::size_t I>
+        bool CheckColumns(std::true_type) const;
+
+        template<std::size_t I>
+        bool CheckColumns(std::false_type) const;
+
+        template<std::size_t I>
+        void CreateBlocks(std::true_type);
+
+        template<std::size_t I>
+        void CreateBlocks(std::false_type);
+
+        template<std::size_t I>
+        void SetBlocks(std::true_type);
+
+        template<std::size_t I>
+        void SetBlocks(std::false_type);
+
+        template<std::size_t I>
+        void SetFields(std::true_type);
+
+        template<std::size_t I>
+        void SetFields(std::false_type);
+
+        template<std::size_t I>
+        bool IsNull(unsigned int index, std::true_type) const;
+
+        template<std::size_t I>
+        bool IsNull(unsigned int index, std::false_type) const;
+
+        Resultset _resultset;
+        typename Layout::Fields _fields;
+        typename Layout::Blocks _blocks;
+        T _row;
+        unsigned int _index;
+        unsigned int _count;
+    };
+
+#endif
+
     /**
      * @brief
      * Encapsulate a Resultset column or object member properties
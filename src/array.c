@@ -189,6 +189,7 @@ boolean OcilibArrayDispose
     {
         OcilibMemoryFreeDescriptorArray
         (
+            (dvoid  *)arr->env,
             (dvoid**)arr->mem_handle,
             (ub4)arr->handle_type,
             (ub4)arr->nb_elem
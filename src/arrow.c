@@ -0,0 +1,1110 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2025 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arrow.h"
+
+#include "define.h"
+#include "macros.h"
+#include "number.h"
+
+/* Arrow types used for exporting columns */
+
+#define ARROW_TYPE_UNSUPPORTED  0
+#define ARROW_TYPE_INT32        1
+#define ARROW_TYPE_UINT32       2
+#define ARROW_TYPE_INT64        3
+#define ARROW_TYPE_DECIMAL      4
+#define ARROW_TYPE_NUMBER       5
+#define ARROW_TYPE_FLOAT        6
+#define ARROW_TYPE_DOUBLE       7
+#define ARROW_TYPE_BOOLEAN      8
+#define ARROW_TYPE_UTF8         9
+#define ARROW_TYPE_BINARY       10
+#define ARROW_TYPE_DATE         11
+#define ARROW_TYPE_TIMESTAMP    12
+#define ARROW_TYPE_TIMESTAMP_TZ 13
+
+#define ARROW_FORMAT_SIZE       32
+#define ARROW_MAX_BUFFERS       3
+
+#define ARROW_DECIMAL_MAX_PREC  38
+#define ARROW_INT64_MAX_PREC    18
+
+#define ARROW_SECONDS_PER_DAY   86400
+
+typedef struct ArrowSchemaData
+{
+    char                 format[ARROW_FORMAT_SIZE];
+    char                *name;
+    struct ArrowSchema **children;
+} ArrowSchemaData;
+
+typedef struct ArrowArrayData
+{
+    const void         *buffers[ARROW_MAX_BUFFERS];
+    struct ArrowArray **children;
+} ArrowArrayData;
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibArrowGetType
+ * --------------------------------------------------------------------------------------------- */
+
+static int OcilibArrowGetType
+(
+    OCI_Column *col,
+    char       *format
+)
+{
+    int type = ARROW_TYPE_UNSUPPORTED;
+
+    switch (col->datatype)
+    {
+        case OCI_CDT_NUMERIC:
+        {
+            switch (col->subtype)
+            {
+                case OCI_NUM_INT:
+                {
+                    type = ARROW_TYPE_INT32;
+                    break;
+                }
+                case OCI_NUM_UINT:
+                {
+                    type = ARROW_TYPE_UINT32;
+                    break;
+                }
+                case OCI_NUM_FLOAT:
+                {
+                    type = ARROW_TYPE_FLOAT;
+                    break;
+                }
+                case OCI_NUM_DOUBLE:
+                {
+                    type = ARROW_TYPE_DOUBLE;
+                    break;
+                }
+                case OCI_NUM_NUMBER:
+                {
+                    /* NUMBER without precision and FLOAT columns are mapped to doubles */
+
+                    if (col->prec > 0 && col->scale == 0 && col->prec <= ARROW_INT64_MAX_PREC)
+                    {
+                        type = ARROW_TYPE_INT64;
+                    }
+                    else if (col->prec > 0 && col->scale != -127 && col->prec <= ARROW_DECIMAL_MAX_PREC)
+                    {
+                        type = ARROW_TYPE_DECIMAL;
+                    }
+                    else
+                    {
+                        type = ARROW_TYPE_NUMBER;
+                    }
+                    break;
+                }
+            }
+            break;
+        }
+        case OCI_CDT_BOOLEAN:
+        {
+            type = ARROW_TYPE_BOOLEAN;
+            break;
+        }
+        case OCI_CDT_TEXT:
+        {
+            /* ROWIDs and LONGs mapped to strings are not stored as null terminated strings */
+
+            if (!IS_ROWID_COL(col) && OCI_CLONG != col->subtype)
+            {
+                type = ARROW_TYPE_UTF8;
+            }
+            break;
+        }
+        case OCI_CDT_RAW:
+        {
+            type = ARROW_TYPE_BINARY;
+            break;
+        }
+        case OCI_CDT_DATETIME:
+        {
+            type = ARROW_TYPE_DATE;
+            break;
+        }
+        case OCI_CDT_TIMESTAMP:
+        {
+            type = (OCI_TIMESTAMP == col->subtype) ? ARROW_TYPE_TIMESTAMP : ARROW_TYPE_TIMESTAMP_TZ;
+            break;
+        }
+    }
+
+    if (NULL != format)
+    {
+        const char *str = NULL;
+
+        switch (type)
+        {
+            case ARROW_TYPE_INT32:        str = "i";       break;
+            case ARROW_TYPE_UINT32:       str = "I";       break;
+            case ARROW_TYPE_INT64:        str = "l";       break;
+            case ARROW_TYPE_NUMBER:       str = "g";       break;
+            case ARROW_TYPE_FLOAT:        str = "f";       break;
+            case ARROW_TYPE_DOUBLE:       str = "g";       break;
+            case ARROW_TYPE_BOOLEAN:      str = "b";       break;
+            case ARROW_TYPE_UTF8:         str = "u";       break;
+            case ARROW_TYPE_BINARY:       str = "z";       break;
+            case ARROW_TYPE_DATE:         str = "tss:";    break;
+            case ARROW_TYPE_TIMESTAMP:    str = "tsu:";    break;
+            case ARROW_TYPE_TIMESTAMP_TZ: str = "tsu:UTC"; break;
+        }
+
+        if (ARROW_TYPE_DECIMAL == type)
+        {
+            sprintf(format, "d:%d,%d", (int) col->prec, (int) col->scale);
+        }
+        else if (NULL != str)
+        {
+            strcpy(format, str);
+        }
+    }
+
+    return type;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibArrowEncodeString
+ * --------------------------------------------------------------------------------------------- */
+
+static size_t OcilibArrowEncodeString
+(
+    const otext *str,
+    char        *buffer
+)
+{
+    unsigned char *out  = (unsigned char *) buffer;
+    size_t         size = 0;
+
+    if (sizeof(otext) == sizeof(char))
+    {
+        /* ANSI strings are expected to be already UTF8 encoded */
+
+        size = strlen((const char *) str);
+
+        if (NULL != out)
+        {
+            memcpy(out, str, size);
+        }
+
+        return size;
+    }
+
+    /* wide strings are UTF16 or UTF32 encoded depending on the platform */
+
+    for (; *str; str++)
+    {
+        unsigned int code = (unsigned int) *str;
+        size_t       len  = 0;
+
+        if (sizeof(otext) == sizeof(ub2))
+        {
+            code &= 0xFFFF;
+
+            if (code >= 0xD800 && code <= 0xDBFF && str[1] != 0)
+            {
+                const unsigned int low = ((unsigned int) str[1]) & 0xFFFF;
+
+                if (low >= 0xDC00 && low <= 0xDFFF)
+                {
+                    code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                    str++;
+                }
+            }
+        }
+
+        len = (code < 0x80) ? 1 : (code < 0x800) ? 2 : (code < 0x10000) ? 3 : 4;
+
+        if (NULL != out)
+        {
+            switch (len)
+            {
+                case 1:
+                {
+                    out[0] = (unsigned char) code;
+                    break;
+                }
+                case 2:
+                {
+                    out[0] = (unsigned char) (0xC0 | (code >> 6));
+                    out[1] = (unsigned char) (0x80 | (code & 0x3F));
+                    break;
+                }
+                case 3:
+                {
+                    out[0] = (unsigned char) (0xE0 | (code >> 12));
+                    out[1] = (unsigned char) (0x80 | ((code >> 6) & 0x3F));
+                    out[2] = (unsigned char) (0x80 | (code & 0x3F));
+                    break;
+                }
+                default:
+                {
+                    out[0] = (unsigned char) (0xF0 | (code >> 18));
+                    out[1] = (unsigned char) (0x80 | ((code >> 12) & 0x3F));
+                    out[2] = (unsigned char) (0x80 | ((code >> 6) & 0x3F));
+                    out[3] = (unsigned char) (0x80 | (code & 0x3F));
+                    break;
+                }
+            }
+
+            out += len;
+        }
+
+        size += len;
+    }
+
+    return size;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibArrowDecimalMulAdd
+ * --------------------------------------------------------------------------------------------- */
+
+static void OcilibArrowDecimalMulAdd
+(
+    big_uint    *high,
+    big_uint    *low,
+    unsigned int mul,
+    unsigned int add
+)
+{
+    /* 128 bits value = value * mul + add, computed on 32 bits halves of the low part */
+
+    const big_uint lo_lo = (*low & 0xFFFFFFFF) * mul + add;
+    const big_uint lo_hi = (*low >> 32) * mul + (lo_lo >> 32);
+
+    *high = *high * mul + (lo_hi >> 32);
+    *low  = (lo_hi << 32) | (lo_lo & 0xFFFFFFFF);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibArrowNumberToDecimal
+ * --------------------------------------------------------------------------------------------- */
+
+static void OcilibArrowNumberToDecimal
+(
+    const OCINumber *number,
+    int              scale,
+    big_uint        *high,
+    big_uint        *low
+)
+{
+    /* Oracle numbers are made of a length byte, an exponent byte and base 100 digits.
+       Value is sum(digit[i] * 100 ^ (exponent - i)). Negative numbers have their exponent
+       and digits complemented and may end with a terminal byte (102) */
+
+    const ub1 *bytes    = number->OCINumberPart;
+    const int  length   = (int) bytes[0];
+    const int  negative = (length > 0) && (0 == (bytes[1] & 0x80));
+
+    int digits   = length - 1;
+    int exponent = 0;
+    int power    = 0;
+    int last     = 0;
+
+    *high = 0;
+    *low  = 0;
+
+    if (digits <= 0)
+    {
+        /* zero */
+
+        return;
+    }
+
+    if (negative)
+    {
+        exponent = ((~bytes[1]) & 0x7F) - 65;
+
+        if (102 == bytes[length])
+        {
+            digits--;
+        }
+    }
+    else
+    {
+        exponent = (bytes[1] & 0x7F) - 65;
+    }
+
+    /* compute the unscaled value (value * 10 ^ scale) using Horner's method, ignoring
+       digits beyond the scale that cannot appear for columns with that scale */
+
+    power = 2 * exponent + scale;
+
+    for (int i = 0; i < digits && power >= -1; i++, power -= 2)
+    {
+        const unsigned int digit = negative ? (unsigned int) (101 - bytes[i + 2]) :
+                                              (unsigned int) (bytes[i + 2] - 1);
+
+        if (power >= 0)
+        {
+            OcilibArrowDecimalMulAdd(high, low, 100, digit);
+        }
+        else
+        {
+            OcilibArrowDecimalMulAdd(high, low, 10, digit / 10);
+        }
+
+        last = power;
+    }
+
+    for (; last > 0; last--)
+    {
+        OcilibArrowDecimalMulAdd(high, low, 10, 0);
+    }
+
+    if (negative)
+    {
+        /* two's complement */
+
+        *low  = ~(*low) + 1;
+        *high = ~(*high) + (0 == *low ? 1 : 0);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibArrowGetSeconds
+ * --------------------------------------------------------------------------------------------- */
+
+static big_int OcilibArrowGetSeconds
+(
+    int year,
+    int month,
+    int day,
+    int hour,
+    int min,
+    int sec
+)
+{
+    /* days since 1970-01-01 in the proleptic gregorian calendar */
+
+    const int      y   = year - (month <= 2 ? 1 : 0);
+    const int      era = (y >= 0 ? y : y - 399) / 400;
+    const unsigned yoe = (unsigned) (y - era * 400);
+    const unsigned doy = (unsigned) ((153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1);
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+
+    const big_int days = (big_int) era * 146097 + (big_int) doe - 719468;
+
+    return days * ARROW_SECONDS_PER_DAY + (big_int) (hour * 3600 + min * 60 + sec);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibArrowAlloc
+ * --------------------------------------------------------------------------------------------- */
+
+static void * OcilibArrowAlloc
+(
+    size_t size
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ void*, NULL,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    /* exported data is owned by the consumer and can outlive the library environment,
+       thus it is allocated with the C runtime and not tracked by OCILIB */
+
+    void *ptr = calloc(1, size > 0 ? size : 1);
+
+    if (NULL == ptr)
+    {
+        THROW(OcilibExceptionMemory, OCI_IPC_VOID, size)
+    }
+
+    SET_RETVAL(ptr)
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibArrowReleaseSchema
+ * --------------------------------------------------------------------------------------------- */
+
+static void OcilibArrowReleaseSchema
+(
+    struct ArrowSchema *schema
+)
+{
+    ArrowSchemaData *data = (ArrowSchemaData *) schema->private_data;
+
+    if (NULL != data)
+    {
+        for (int64_t i = 0; i < schema->n_children && NULL != data->children; i++)
+        {
+            struct ArrowSchema *child = data->children[i];
+
+            if (NULL != child)
+            {
+                if (NULL != child->release)
+                {
+                    child->release(child);
+                }
+
+                free(child);
+            }
+        }
+
+        free(data->children);
+        free(data->name);
+        free(data);
+    }
+
+    schema->release = NULL;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibArrowReleaseArray
+ * --------------------------------------------------------------------------------------------- */
+
+static void OcilibArrowReleaseArray
+(
+    struct ArrowArray *array
+)
+{
+    ArrowArrayData *data = (ArrowArrayData *) array->private_data;
+
+    if (NULL != data)
+    {
+        for (int64_t i = 0; i < array->n_children && NULL != data->children; i++)
+        {
+            struct ArrowArray *child = data->children[i];
+
+            if (NULL != child)
+            {
+                if (NULL != child->release)
+                {
+                    child->release(child);
+                }
+
+                free(child);
+            }
+        }
+
+        for (int i = 0; i < ARROW_MAX_BUFFERS; i++)
+        {
+            free((void *) data->buffers[i]);
+        }
+
+        free(data->children);
+        free(data);
+    }
+
+    array->release = NULL;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibArrowInitSchema
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean OcilibArrowInitSchema
+(
+    struct ArrowSchema *schema,
+    const otext        *name,
+    unsigned int        nb_children
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    ArrowSchemaData *data = NULL;
+
+    CHECK_PTR(OCI_IPC_VOID, schema)
+
+    memset(schema, 0, sizeof(*schema));
+
+    data = (ArrowSchemaData *) OcilibArrowAlloc(sizeof(*data));
+    CHECK_NULL(data)
+
+    schema->private_data = data;
+    schema->release      = OcilibArrowReleaseSchema;
+    schema->format       = data->format;
+    schema->name         = "";
+
+    if (NULL != name)
+    {
+        data->name = (char *) OcilibArrowAlloc(OcilibArrowEncodeString(name, NULL) + 1);
+        CHECK_NULL(data->name)
+
+        OcilibArrowEncodeString(name, data->name);
+
+        schema->name = data->name;
+    }
+
+    if (nb_children > 0)
+    {
+        data->children = (struct ArrowSchema **) OcilibArrowAlloc(sizeof(*data->children) * nb_children);
+        CHECK_NULL(data->children)
+
+        schema->children   = data->children;
+        schema->n_children = (int64_t) nb_children;
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibArrowInitArray
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean OcilibArrowInitArray
+(
+    struct ArrowArray *array,
+    ub4                length,
+    unsigned int       nb_buffers,
+    unsigned int       nb_children
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    ArrowArrayData *data = NULL;
+
+    CHECK_PTR(OCI_IPC_VOID, array)
+
+    memset(array, 0, sizeof(*array));
+
+    data = (ArrowArrayData *) OcilibArrowAlloc(sizeof(*data));
+    CHECK_NULL(data)
+
+    array->private_data = data;
+    array->release      = OcilibArrowReleaseArray;
+    array->length       = (int64_t) length;
+    array->buffers      = data->buffers;
+    array->n_buffers    = (int64_t) nb_buffers;
+
+    if (nb_children > 0)
+    {
+        data->children = (struct ArrowArray **) OcilibArrowAlloc(sizeof(*data->children) * nb_children);
+        CHECK_NULL(data->children)
+
+        array->children   = data->children;
+        array->n_children = (int64_t) nb_children;
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibArrowExportValidity
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean OcilibArrowExportValidity
+(
+    struct ArrowArray *array,
+    const OCIInd      *inds
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    CHECK_PTR(OCI_IPC_VOID, array)
+
+    ArrowArrayData *data   = (ArrowArrayData *) array->private_data;
+    const ub4       length = (ub4) array->length;
+    ub1            *bitmap = NULL;
+    int64_t         nulls  = 0;
+
+    for (ub4 i = 0; i < length; i++)
+    {
+        if (OCI_IND_NULL == inds[i])
+        {
+            nulls++;
+        }
+    }
+
+    /* the validity bitmap can be omitted when there is no null value */
+
+    if (nulls > 0)
+    {
+        bitmap = (ub1 *) OcilibArrowAlloc((length + 7) / 8);
+        CHECK_NULL(bitmap)
+
+        for (ub4 i = 0; i < length; i++)
+        {
+            if (OCI_IND_NULL != inds[i])
+            {
+                bitmap[i >> 3] |= (ub1) (1 << (i & 7));
+            }
+        }
+    }
+
+    data->buffers[0]  = bitmap;
+    array->null_count = nulls;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibArrowExportVariable
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean OcilibArrowExportVariable
+(
+    struct ArrowArray *array,
+    OCI_Define        *def,
+    int                type,
+    const ub1         *values,
+    unsigned int       size,
+    const OCIInd      *inds
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DEFINE, def
+    )
+
+    CHECK_PTR(OCI_IPC_DEFINE, def)
+
+    ArrowArrayData *data    = (ArrowArrayData *) array->private_data;
+    const ub4       length  = (ub4) array->length;
+    const ub2      *lens    = ((const ub2 *) def->buf.lens) + def->rs->block_start;
+    int32_t        *offsets = NULL;
+    char           *buffer  = NULL;
+    size_t          total   = 0;
+
+    /* first pass : compute offsets */
+
+    offsets = (int32_t *) OcilibArrowAlloc(sizeof(*offsets) * (length + 1));
+    CHECK_NULL(offsets)
+
+    data->buffers[1] = offsets;
+
+    for (ub4 i = 0; i < length; i++)
+    {
+        if (OCI_IND_NULL != inds[i])
+        {
+            if (ARROW_TYPE_UTF8 == type)
+            {
+                total += OcilibArrowEncodeString((const otext *) (values + (size_t) size * i), NULL);
+            }
+            else
+            {
+                total += lens[i];
+            }
+        }
+
+        /* utf8 and binary arrow formats use 32 bits offsets */
+
+        if (total > INT32_MAX)
+        {
+            THROW(OcilibExceptionDatatypeNotSupported, def->col.sqlcode)
+        }
+
+        offsets[i + 1] = (int32_t) total;
+    }
+
+    /* second pass : copy values */
+
+    buffer = (char *) OcilibArrowAlloc(total);
+    CHECK_NULL(buffer)
+
+    data->buffers[2] = buffer;
+
+    for (ub4 i = 0; i < length; i++)
+    {
+        if (OCI_IND_NULL != inds[i])
+        {
+            const ub1 *value = values + (size_t) size * i;
+
+            if (ARROW_TYPE_UTF8 == type)
+            {
+                OcilibArrowEncodeString((const otext *) value, buffer + offsets[i]);
+            }
+            else
+            {
+                memcpy(buffer + offsets[i], value, lens[i]);
+            }
+        }
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibArrowExportFixed
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean OcilibArrowExportFixed
+(
+    struct ArrowArray *array,
+    OCI_Define        *def,
+    int                type,
+    const ub1         *values,
+    unsigned int       size,
+    const OCIInd      *inds
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DEFINE, def
+    )
+
+    CHECK_PTR(OCI_IPC_DEFINE, def)
+
+    ArrowArrayData *data   = (ArrowArrayData *) array->private_data;
+    OCI_Connection *con    = def->rs->stmt->con;
+    const ub4       length = (ub4) array->length;
+    size_t          width  = 0;
+    ub1            *buffer = NULL;
+
+    switch (type)
+    {
+        case ARROW_TYPE_BOOLEAN:
+        {
+            width = 0;
+            break;
+        }
+        case ARROW_TYPE_DECIMAL:
+        {
+            width = sizeof(big_uint) * 2;
+            break;
+        }
+        case ARROW_TYPE_INT32:
+        case ARROW_TYPE_UINT32:
+        case ARROW_TYPE_FLOAT:
+        {
+            width = sizeof(int32_t);
+            break;
+        }
+        default:
+        {
+            width = sizeof(int64_t);
+            break;
+        }
+    }
+
+    buffer = (ub1 *) OcilibArrowAlloc(width > 0 ? width * length : (length + 7) / 8);
+    CHECK_NULL(buffer)
+
+    data->buffers[1] = buffer;
+
+    if (width == size && ARROW_TYPE_BOOLEAN != type && OCI_CDT_NUMERIC == def->col.datatype &&
+        OCI_NUM_NUMBER != def->col.subtype)
+    {
+        /* native integers and floating point values are stored with the same layout */
+
+        memcpy(buffer, values, width * length);
+    }
+    else
+    {
+        const ub2 endianness    = 1;
+        const int little_endian = (1 == *(const ub1 *) &endianness);
+
+        for (ub4 i = 0; i < length; i++)
+        {
+            const ub1 *value = values + (size_t) size * i;
+            void      *out   = buffer + width * i;
+
+            if (OCI_IND_NULL == inds[i])
+            {
+                continue;
+            }
+
+            switch (type)
+            {
+                case ARROW_TYPE_BOOLEAN:
+                {
+                    if (*(const boolean *) value)
+                    {
+                        buffer[i >> 3] |= (ub1) (1 << (i & 7));
+                    }
+                    break;
+                }
+                case ARROW_TYPE_INT64:
+                {
+                    big_uint high = 0, low = 0;
+
+                    OcilibArrowNumberToDecimal((const OCINumber *) value, 0, &high, &low);
+
+                    *(int64_t *) out = (int64_t) low;
+                    break;
+                }
+                case ARROW_TYPE_DECIMAL:
+                {
+                    big_uint high = 0, low = 0;
+
+                    OcilibArrowNumberToDecimal((const OCINumber *) value, def->col.scale, &high, &low);
+
+                    /* 128 bits integers are stored in native endianness */
+
+                    ((big_uint *) out)[little_endian ? 0 : 1] = low;
+                    ((big_uint *) out)[little_endian ? 1 : 0] = high;
+                    break;
+                }
+                case ARROW_TYPE_NUMBER:
+                {
+                    CHECK(OcilibNumberTranslateValue(con, (void *) value, OCI_NUM_NUMBER, out, OCI_NUM_DOUBLE))
+                    break;
+                }
+                case ARROW_TYPE_DATE:
+                {
+                    const OCIDate *date = (const OCIDate *) value;
+
+                    *(int64_t *) out = (int64_t) OcilibArrowGetSeconds(date->OCIDateYYYY, date->OCIDateMM,
+                                                                       date->OCIDateDD, date->OCIDateTime.OCITimeHH,
+                                                                       date->OCIDateTime.OCITimeMI,
+                                                                       date->OCIDateTime.OCITimeSS);
+                    break;
+                }
+                case ARROW_TYPE_TIMESTAMP:
+                case ARROW_TYPE_TIMESTAMP_TZ:
+                {
+#if OCI_VERSION_COMPILE >= OCI_9_0
+
+                    OCIDateTime *handle = *(OCIDateTime * const *) value;
+
+                    sb2 yr = 0;
+                    ub1 mt = 0, dy = 0, hh = 0, mi = 0, ss = 0;
+                    ub4 fsec = 0;
+                    sb1 tz_hour = 0, tz_min = 0;
+
+                    CHECK_OCI
+                    (
+                        con->err,
+                        OCIDateTimeGetDate,
+                        (dvoid *) con->env, con->err,
+                        handle, &yr, &mt, &dy
+                    )
+
+                    CHECK_OCI
+                    (
+                        con->err,
+                        OCIDateTimeGetTime,
+                        (dvoid *) con->env, con->err,
+                        handle, &hh, &mi, &ss, &fsec
+                    )
+
+                    if (ARROW_TYPE_TIMESTAMP_TZ == type)
+                    {
+                        CHECK_OCI
+                        (
+                            con->err,
+                            OCIDateTimeGetTimeZoneOffset,
+                            (dvoid *) con->env, con->err,
+                            handle, &tz_hour, &tz_min
+                        )
+                    }
+
+                    /* fractional seconds are returned in nanoseconds */
+
+                    *(int64_t *) out = (int64_t) (OcilibArrowGetSeconds(yr, mt, dy, hh, mi, ss) -
+                                                  (big_int) (tz_hour * 3600 + tz_min * 60)) * 1000000 +
+                                       (int64_t) (fsec / 1000);
+#endif
+                    break;
+                }
+            }
+        }
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibArrowExportColumn
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean OcilibArrowExportColumn
+(
+    struct ArrowArray *array,
+    OCI_Define        *def
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DEFINE, def
+    )
+
+    CHECK_PTR(OCI_IPC_DEFINE, def)
+
+    OCI_Resultset *rs     = def->rs;
+    const int      type   = OcilibArrowGetType(&def->col, NULL);
+    const OCIInd  *inds   = def->buf.inds + rs->block_start;
+    unsigned int   size   = 0;
+    const ub1     *values = NULL;
+
+    const boolean variable = (ARROW_TYPE_UTF8 == type || ARROW_TYPE_BINARY == type);
+
+    CHECK(OcilibArrowInitArray(array, rs->block_rows, variable ? 3 : 2, 0))
+
+    values = (const ub1 *) OcilibDefineGetBlockData(def, rs->block_start, &size);
+    CHECK_NULL(values)
+
+    CHECK(OcilibArrowExportValidity(array, inds))
+
+    if (variable)
+    {
+        CHECK(OcilibArrowExportVariable(array, def, type, values, size, inds))
+    }
+    else
+    {
+        CHECK(OcilibArrowExportFixed(array, def, type, values, size, inds))
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibArrowExportResultset
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibArrowExportResultset
+(
+    OCI_Resultset      *rs,
+    struct ArrowSchema *schema,
+    struct ArrowArray  *array
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_RESULTSET, rs
+    )
+
+    /* released structures are identified by a NULL release callback */
+
+    if (NULL != schema)
+    {
+        memset(schema, 0, sizeof(*schema));
+    }
+
+    if (NULL != array)
+    {
+        memset(array, 0, sizeof(*array));
+    }
+
+    CHECK_PTR(OCI_IPC_RESULTSET, rs)
+
+    /* blocks are only available for regular resultsets */
+
+    if (rs->stmt->nb_rbinds > 0)
+    {
+        THROW_NO_ARGS(OcilibExceptionTypeNotCompatible)
+    }
+
+    /* exporting values requires a block fetched with OcilibResultsetFetchBlock() */
+
+    if (NULL != array && 0 == rs->block_rows)
+    {
+        THROW(OcilibExceptionArgInvalidValue, OTEXT("Block row count"), rs->block_rows)
+    }
+
+    for (ub4 i = 0; i < rs->nb_defs; i++)
+    {
+        if (ARROW_TYPE_UNSUPPORTED == OcilibArrowGetType(&rs->defs[i].col, NULL))
+        {
+            THROW(OcilibExceptionDatatypeNotSupported, rs->defs[i].col.sqlcode)
+        }
+    }
+
+    if (NULL != schema)
+    {
+        /* record batches are described as a struct with one child per column */
+
+        CHECK(OcilibArrowInitSchema(schema, NULL, rs->nb_defs))
+
+        strcpy(((ArrowSchemaData *) schema->private_data)->format, "+s");
+
+        for (ub4 i = 0; i < rs->nb_defs; i++)
+        {
+            OCI_Column         *col   = &rs->defs[i].col;
+            struct ArrowSchema *child = NULL;
+
+            child = (struct ArrowSchema *) OcilibArrowAlloc(sizeof(*child));
+            CHECK_NULL(child)
+
+            schema->children[i] = child;
+
+            CHECK(OcilibArrowInitSchema(child, col->name, 0))
+
+            OcilibArrowGetType(col, ((ArrowSchemaData *) child->private_data)->format);
+
+            child->flags = col->nullable ? ARROW_FLAG_NULLABLE : 0;
+        }
+    }
+
+    if (NULL != array)
+    {
+        CHECK(OcilibArrowInitArray(array, rs->block_rows, 1, rs->nb_defs))
+
+        for (ub4 i = 0; i < rs->nb_defs; i++)
+        {
+            struct ArrowArray *child = NULL;
+
+            child = (struct ArrowArray *) OcilibArrowAlloc(sizeof(*child));
+            CHECK_NULL(child)
+
+            array->children[i] = child;
+
+            CHECK(OcilibArrowExportColumn(child, &rs->defs[i]))
+        }
+    }
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (FAILURE)
+        {
+            if (NULL != schema && NULL != schema->release)
+            {
+                schema->release(schema);
+            }
+
+            if (NULL != array && NULL != array->release)
+            {
+                array->release(array);
+            }
+        }
+    )
+}
@@ -391,6 +391,28 @@ static boolean OcilibBindAllocateInternalData
     EXIT_FUNC()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibBindReleaseExternalArrays
+ * --------------------------------------------------------------------------------------------- */
+
+static void OcilibBindReleaseExternalArrays
+(
+    OCI_Bind *bnd
+)
+{
+    if (bnd->ext_arrays & OCI_BIND_EXT_INDICATORS)
+    {
+        bnd->buffer.inds = NULL;
+    }
+
+    if (bnd->ext_arrays & OCI_BIND_EXT_LENGTHS)
+    {
+        bnd->buffer.lens = NULL;
+    }
+
+    bnd->ext_arrays = 0;
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OcilibBindAllocateBuffers
  * --------------------------------------------------------------------------------------------- */
@@ -413,6 +435,13 @@ static boolean OcilibBindAllocateBuffers
 
     CHECK_PTR(OCI_IPC_BIND, bnd)
 
+    /* arrays provided by the user are not kept when rebinding */
+
+    if (reused)
+    {
+        OcilibBindReleaseExternalArrays(bnd);
+    }
+
     /* allocate indicators array */
 
     ALLOC_DATA(OCI_IPC_BIND, bnd->buffer.inds, nballoc)
@@ -827,13 +856,13 @@ OCI_Bind* OcilibBindCreate
 
     if (NULL == stmt->map)
     {
-        stmt->map = OcilibHashCreate(OCI_HASH_DEFAULT_SIZE, OCI_HASH_INTEGER);
+        stmt->map = OcilibHashCreate(OCI_HASH_MIN_SIZE, OCI_HASH_INTEGER);
         CHECK_NULL(stmt->map)
     }
 
     /* allocate bind object */
 
-    ALLOC_DATA(OCI_IPC_BIND, bnd, 1)
+    ARENA_ALLOC_DATA(stmt->con->arena, OCI_IPC_BIND, bnd, 1)
 
     /* initialize bind object */
 
@@ -986,6 +1015,8 @@ boolean OcilibBindFree
 
     OcilibErrorResetSource(NULL, bnd);
 
+    OcilibBindReleaseExternalArrays(bnd);
+
     FREE(bnd->buffer.inds)
     FREE(bnd->buffer.obj_inds)
     FREE(bnd->buffer.lens)
@@ -1024,26 +1055,19 @@ int OcilibBindGetIndex
 
     int index = -1;
 
-    while (NULL != he)
+    if (NULL != he)
     {
-        /* no more entries or key matched => so we got it ! */
-
-        if (NULL == he->next || OcilibStringCaseCompare(he->key, name) == 0)
-        {
-            /* in order to use the same map for user binds and
-               register binds :
-                  - user binds are stored as positive values
-                  - registers binds are stored as negatives values
-            */
-
-            index = he->values->value.num;
+        /* in order to use the same map for user binds and
+           register binds :
+              - user binds are stored as positive values
+              - registers binds are stored as negatives values
+        */
 
-            if (index < 0)
-            {
-                index = -index;
-            }
+        index = he->values->value.num;
 
-            break;
+        if (index < 0)
+        {
+            index = -index;
         }
     }
 
@@ -1200,6 +1224,54 @@ OCI_Statement * OcilibBindGetStatement
     )
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibBindSizeToLength
+ * --------------------------------------------------------------------------------------------- */
+
+static ub2 OcilibBindSizeToLength
+(
+    OCI_Bind    *bnd,
+    unsigned int size
+)
+{
+    if (OCI_CDT_TEXT == bnd->type)
+    {
+        if (bnd->size == (sb4) size)
+        {
+            size += (unsigned int) (size_t) sizeof(dbtext);
+        }
+
+        size *= (unsigned int) sizeof(dbtext);
+    }
+
+    return (ub2) size;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibBindLengthToSize
+ * --------------------------------------------------------------------------------------------- */
+
+static unsigned int OcilibBindLengthToSize
+(
+    OCI_Bind *bnd,
+    ub2       length
+)
+{
+    unsigned int size = (unsigned int) length;
+
+    if (OCI_CDT_TEXT == bnd->type)
+    {
+        if (bnd->size == (sb4)size)
+        {
+            size -= (unsigned int) sizeof(dbtext);
+        }
+
+        size /= (unsigned int) sizeof(dbtext);
+    }
+
+    return size;
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OcilibBindSetDataSize
  * --------------------------------------------------------------------------------------------- */
@@ -1236,17 +1308,42 @@ boolean OcilibBindSetDataSizeAtPos
 
     CHECK_NULL(bnd->buffer.lens)
 
-    if (OCI_CDT_TEXT == bnd->type)
-    {
-        if (bnd->size == (sb4) size)
-        {
-            size += (unsigned int) (size_t) sizeof(dbtext);
-        }
+    ((ub2 *) bnd->buffer.lens)[position-1] = OcilibBindSizeToLength(bnd, size);
 
-        size *= (unsigned int) sizeof(dbtext);
-    }
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
 
-    ((ub2 *) bnd->buffer.lens)[position-1] = (ub2) size;
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibBindSetDataSizes
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibBindSetDataSizes
+(
+    OCI_Bind           *bnd,
+    const unsigned int *sizes,
+    unsigned int        count
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_BIND, bnd
+    )
+
+    CHECK_PTR(OCI_IPC_BIND, bnd)
+    CHECK_PTR(OCI_IPC_VOID, sizes)
+    CHECK_BOUND(count, 1, bnd->buffer.count)
+
+    CHECK_NULL(bnd->buffer.lens)
+
+    ub2 *lens = (ub2 *) bnd->buffer.lens;
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        lens[i] = OcilibBindSizeToLength(bnd, sizes[i]);
+    }
 
     SET_SUCCESS()
 
@@ -1286,19 +1383,42 @@ unsigned int OcilibBindGetDataSizeAtPos
 
     CHECK_NULL(bnd->buffer.lens)
 
-    unsigned int size = (unsigned int)((ub2 *)bnd->buffer.lens)[position - 1];
+    SET_RETVAL(OcilibBindLengthToSize(bnd, ((ub2 *)bnd->buffer.lens)[position - 1]))
 
-    if (OCI_CDT_TEXT == bnd->type)
-    {
-        if (bnd->size == (sb4)size)
-        {
-            size -= (unsigned int) sizeof(dbtext);
-        }
+    EXIT_FUNC()
+}
 
-        size /= (unsigned int) sizeof(dbtext);
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibBindGetDataSizes
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibBindGetDataSizes
+(
+    OCI_Bind     *bnd,
+    unsigned int *sizes,
+    unsigned int  count
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_BIND, bnd
+    )
+
+    CHECK_PTR(OCI_IPC_BIND, bnd)
+    CHECK_PTR(OCI_IPC_VOID, sizes)
+    CHECK_BOUND(count, 1, bnd->buffer.count)
+
+    CHECK_NULL(bnd->buffer.lens)
+
+    const ub2 *lens = (const ub2 *) bnd->buffer.lens;
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        sizes[i] = OcilibBindLengthToSize(bnd, lens[i]);
     }
 
-    SET_RETVAL(size)
+    SET_SUCCESS()
 
     EXIT_FUNC()
 }
@@ -1511,3 +1631,138 @@ unsigned int OcilibBindGetAllocationMode
         /* member */ alloc_mode
     )
 }
+
+/* --------------------------------------------------------------------------------------------- *
+* OcilibBindGetBigIntMode
+* --------------------------------------------------------------------------------------------- */
+
+unsigned int OcilibBindGetBigIntMode
+(
+    OCI_Bind *bnd
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ unsigned int, OCI_UNKNOWN,
+        /* context */ OCI_IPC_BIND, bnd
+    )
+
+    CHECK_PTR(OCI_IPC_BIND, bnd)
+
+    if (OCI_CDT_NUMERIC == bnd->type && (OCI_NUM_BIGINT & bnd->subtype))
+    {
+        SET_RETVAL(SQLT_VNU == bnd->code ? OCI_BIM_NUMBER : OCI_BIM_NATIVE)
+    }
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibBindSetExternalArray
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean OcilibBindSetExternalArray
+(
+    OCI_Bind    *bnd,
+    void        *arr,
+    unsigned int flag
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_BIND, bnd
+    )
+
+    OCI_HashEntry *he = NULL;
+
+    int index = 0;
+
+    CHECK_PTR(OCI_IPC_BIND, bnd)
+    CHECK_PTR(OCI_IPC_VOID, arr)
+
+    /* indicators of OCILIB handles are computed from the handles at execute time and
+       register binds are dynamic binds. Only user binds of scalar types are allowed */
+
+    he = OcilibHashLookup(bnd->stmt->map, bnd->name, FALSE);
+
+    if (IS_OCILIB_OBJECT(bnd->type, bnd->subtype) || (NULL == he) || (he->values->value.num < 0))
+    {
+        THROW_NO_ARGS(OcilibExceptionTypeNotCompatible)
+    }
+
+    if ((OCI_BIND_EXT_LENGTHS == flag) && (OCI_CDT_TEXT != bnd->type) && (OCI_CDT_RAW != bnd->type))
+    {
+        THROW_NO_ARGS(OcilibExceptionTypeNotCompatible)
+    }
+
+    if (OCI_BIND_EXT_INDICATORS == flag)
+    {
+        if (!(bnd->ext_arrays & flag))
+        {
+            FREE(bnd->buffer.inds)
+        }
+
+        bnd->buffer.inds = (sb2 *) arr;
+    }
+    else
+    {
+        if (!(bnd->ext_arrays & flag))
+        {
+            FREE(bnd->buffer.lens)
+        }
+
+        bnd->buffer.lens = arr;
+    }
+
+    bnd->ext_arrays |= (ub1) flag;
+
+    /* OCI keeps the indicators and lengths pointers given at bind time */
+
+    if (OCI_BIND_BY_POS == bnd->stmt->bind_mode)
+    {
+        index = (int) ostrtol(&bnd->name[1], NULL, 10);
+    }
+
+    CHECK(OcilibBindPerformBinding(bnd, OCI_BIND_INPUT, index, OCI_DEFAULT, NULL != bnd->plrcds))
+
+    if (OCI_CSF_NONE != bnd->csfrm)
+    {
+        CHECK_ATTRIB_SET
+        (
+            OCI_HTYPE_BIND, OCI_ATTR_CHARSET_FORM,
+            bnd->buffer.handle, &bnd->csfrm, sizeof(bnd->csfrm),
+            bnd->stmt->con->err
+        )
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibBindSetIndicatorArray
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibBindSetIndicatorArray
+(
+    OCI_Bind *bnd,
+    short    *inds
+)
+{
+    return OcilibBindSetExternalArray(bnd, inds, OCI_BIND_EXT_INDICATORS);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibBindSetLengthArray
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibBindSetLengthArray
+(
+    OCI_Bind       *bnd,
+    unsigned short *lens
+)
+{
+    return OcilibBindSetExternalArray(bnd, lens, OCI_BIND_EXT_LENGTHS);
+}
@@ -109,6 +109,20 @@ OCI_SYM_LOCAL unsigned int OcilibBindGetDataSizeAtPos
     unsigned int position
 );
 
+OCI_SYM_LOCAL boolean OcilibBindSetDataSizes
+(
+    OCI_Bind          * bnd,
+    const unsigned int* sizes,
+    unsigned int        count
+);
+
+OCI_SYM_LOCAL boolean OcilibBindGetDataSizes
+(
+    OCI_Bind    * bnd,
+    unsigned int* sizes,
+    unsigned int  count
+);
+
 OCI_SYM_LOCAL boolean OcilibBindSetNullAtPos
 (
     OCI_Bind   * bnd,
@@ -164,4 +178,21 @@ OCI_SYM_LOCAL unsigned int OcilibBindGetAllocationMode
     OCI_Bind* bnd
 );
 
+OCI_SYM_LOCAL unsigned int OcilibBindGetBigIntMode
+(
+    OCI_Bind* bnd
+);
+
+OCI_SYM_LOCAL boolean OcilibBindSetIndicatorArray
+(
+    OCI_Bind* bnd,
+    short   * inds
+);
+
+OCI_SYM_LOCAL boolean OcilibBindSetLengthArray
+(
+    OCI_Bind      * bnd,
+    unsigned short* lens
+);
+
 #endif /* OCILIB_BIND_H_INCLUDED */
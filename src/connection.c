@@ -26,9 +26,13 @@
 #include "format.h"
 #include "list.h"
 #include "macros.h"
+#include "mutex.h"
+#include "resultset.h"
 #include "statement.h"
 #include "stringutils.h"
 #include "timestamp.h"
+#include "thread.h"
+#include "threadkey.h"
 #include "transaction.h"
 #include "typeinfo.h"
 
@@ -48,6 +52,13 @@ static const unsigned int TimeoutTypeValues[] =
     OCI_NTO_CALL
 };
 
+static const unsigned int PreparedCacheValues[] =
+{
+    OCI_PCV_HITS,
+    OCI_PCV_MISSES,
+    OCI_PCV_SIZE
+};
+
 #define SET_TRACE(prop)                                                 \
                                                                         \
     con->trace->prop[0] = 0;                                            \
@@ -131,6 +142,17 @@ OCI_Connection * OcilibConnectionAllocate
     con->trsns = OcilibListCreate(OCI_IPC_TRANSACTION);
     CHECK_NULL(con->trsns)
 
+    /* create memory arena for internal structures owned by the connection */
+
+    if (LIB_MEMORY_ARENA)
+    {
+        con->arena = OcilibMemoryArenaCreate();
+        CHECK_NULL(con->arena)
+
+        con->stmts->arena = con->arena;
+        con->tinfs->arena = con->arena;
+    }
+
     /* set attributes */
 
     con->mode     = mode;
@@ -966,6 +988,8 @@ static boolean OcilibConnectionLogOff
 
     /* free all child lists */
 
+    OcilibStatementCachePurge(con, 0);
+
     LIST_ATOMIC_REMOVE_ALL(con->stmts, OcilibStatementDispose)
     LIST_ATOMIC_REMOVE_ALL(con->tinfs, OcilibTypeInfoDispose)
     LIST_ATOMIC_REMOVE_ALL(con->trsns, OcilibTransactionDispose)
@@ -1028,6 +1052,10 @@ boolean OcilibConnectionDispose
 
     CHECK_PTR(OCI_IPC_CONNECTION, con)
 
+    /* wait for any pending asynchronous call */
+
+    OcilibConnectionReleaseAsync(con);
+
     /* clear server output resources */
 
     OcilibConnectionDisableServerOutput(con);
@@ -1077,6 +1105,12 @@ boolean OcilibConnectionDispose
     con->trsns = NULL;
     con->tinfs = NULL;
 
+    /* release in bulk all memory allocated from the connection arena */
+
+    OcilibMemoryArenaFree(con->arena);
+
+    con->arena = NULL;
+
     OcilibErrorResetSource(NULL, con);
 
     SET_SUCCESS()
@@ -2799,6 +2833,79 @@ boolean OcilibConnectionSetStatementCacheSize
     EXIT_FUNC()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibConnectionGetPreparedCacheSize
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int OcilibConnectionGetPreparedCacheSize
+(
+    OCI_Connection *con
+)
+{
+    GET_PROP
+    (
+        unsigned int, 0,
+        OCI_IPC_CONNECTION, con,
+        prep_cache.size
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibConnectionSetPreparedCacheSize
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibConnectionSetPreparedCacheSize
+(
+    OCI_Connection *con,
+    unsigned int    value
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    con->prep_cache.size = value;
+
+    /* evict parked statements exceeding the new size */
+
+    OcilibStatementCachePurge(con, value);
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibConnectionGetPreparedCacheValue
+ * --------------------------------------------------------------------------------------------- */
+
+big_uint OcilibConnectionGetPreparedCacheValue
+(
+    OCI_Connection *con,
+    unsigned int    value
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ big_uint, 0,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+    CHECK_ENUM_VALUE(value, PreparedCacheValues, OTEXT("Prepared statement cache value"))
+
+    OCI_StatementCache *cache = &con->prep_cache;
+
+    SET_RETVAL((OCI_PCV_HITS   == value) ? cache->hits   :
+               (OCI_PCV_MISSES == value) ? cache->misses : (big_uint) cache->count)
+
+    EXIT_FUNC()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OcilibConnectionGetDefaultLobPrefetchSize
  * --------------------------------------------------------------------------------------------- */
@@ -3046,3 +3153,378 @@ boolean OcilibConnectionExecuteImmediateFmt
         FREE(sql_fmt)
     )
 }
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibConnectionIsAsyncWorker
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean OcilibConnectionIsAsyncWorker
+(
+    OCI_AsyncCall *call
+)
+{
+    void *value = NULL;
+
+    OcilibThreadKeyGet(Env.key_async, &value);
+
+    return (NULL != call && value == call);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibConnectionAsyncFree
+ * --------------------------------------------------------------------------------------------- */
+
+static void OcilibConnectionAsyncFree
+(
+    OCI_AsyncCall *call
+)
+{
+    /* discard calls not run yet */
+
+    while (NULL != call->head)
+    {
+        OCI_AsyncJob *job = call->head;
+
+        call->head = job->next;
+
+        OcilibMemoryFree(job);
+    }
+
+    if (NULL != call->thread)
+    {
+        OcilibThreadFree(call->thread);
+    }
+
+    if (NULL != call->cond)
+    {
+        OcilibConditionFree(call->cond);
+    }
+
+    OcilibMemoryFree(call);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibConnectionAsyncProc
+ * --------------------------------------------------------------------------------------------- */
+
+static void OcilibConnectionAsyncProc
+(
+    OCI_Thread *thread,
+    void       *arg
+)
+{
+    OCI_AsyncCall *call = (OCI_AsyncCall *) arg;
+
+    OCI_NOT_USED(thread)
+
+    OcilibThreadKeySet(Env.key_async, call);
+
+    OcilibConditionAcquire(call->cond);
+
+    while (!call->detached)
+    {
+        /* wait for a queued call, the thread exits once stopped with an empty queue */
+
+        while (NULL == call->head && !call->stop)
+        {
+            OcilibConditionWait(call->cond);
+        }
+
+        OCI_AsyncJob *job = call->head;
+
+        if (NULL == job)
+        {
+            break;
+        }
+
+        call->head = job->next;
+
+        if (NULL == call->head)
+        {
+            call->tail = NULL;
+        }
+
+        call->running = TRUE;
+
+        OcilibConditionRelease(call->cond);
+
+        /* errors of a previous call run by this thread must not be reported */
+
+        if (Env.env_mode & OCI_ENV_CONTEXT)
+        {
+            OcilibErrorGet(TRUE, TRUE);
+        }
+
+        boolean result = FALSE;
+
+        if (OCI_ACT_FETCH == job->type)
+        {
+            result = OcilibResultsetFetchNext(job->rs);
+        }
+        else
+        {
+            result = OcilibStatementExecute(job->stmt);
+        }
+
+        OcilibConditionAcquire(call->cond);
+
+        call->result = result;
+
+        OcilibConditionRelease(call->cond);
+
+        /* the completion handler can queue new calls or free the connection */
+
+        if (NULL != job->handler)
+        {
+            job->handler(job->stmt, job->type, result, job->ctx);
+        }
+
+        OcilibMemoryFree(job);
+
+        OcilibConditionAcquire(call->cond);
+
+        call->running = FALSE;
+
+        if (NULL == call->head)
+        {
+            call->status = OCI_ACS_COMPLETED;
+        }
+
+        OcilibConditionBroadcast(call->cond);
+    }
+
+    OcilibConditionRelease(call->cond);
+
+    OcilibThreadKeySet(Env.key_async, NULL);
+
+    /* the connection was freed from a completion handler and cannot join this
+       thread: the call is not referenced anymore and is freed here */
+
+    if (call->detached)
+    {
+        OcilibConnectionAsyncFree(call);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibConnectionRunAsync
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibConnectionRunAsync
+(
+    OCI_Connection    *con,
+    unsigned int       type,
+    OCI_Statement     *stmt,
+    OCI_Resultset     *rs,
+    POCI_ASYNC_HANDLER handler,
+    void              *ctx
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    OCI_AsyncCall *call = NULL;
+    OCI_AsyncJob  *job  = NULL;
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+    CHECK_PTR(OCI_IPC_STATEMENT,  stmt)
+    CHECK_THREAD_ENABLED()
+
+    call = con->async;
+
+    if (NULL == call)
+    {
+        /* start the worker thread of the connection */
+
+        ALLOC_DATA(OCI_IPC_ASYNC_CALL, call, 1)
+
+        call->cond = OcilibConditionCreate();
+        CHECK_NULL(call->cond)
+
+        call->thread = OcilibThreadCreate();
+        CHECK_NULL(call->thread)
+
+        CHECK(OcilibThreadRun(call->thread, OcilibConnectionAsyncProc, call))
+
+        con->async = call;
+    }
+
+    /* only one call at a time can run on a connection */
+
+    if (!OcilibConnectionIsAsyncWorker(call))
+    {
+        CHECK(OcilibConnectionWaitAsync(con, NULL))
+    }
+
+    ALLOC_DATA(OCI_IPC_ASYNC_JOB, job, 1)
+
+    job->type    = type;
+    job->stmt    = stmt;
+    job->rs      = rs;
+    job->handler = handler;
+    job->ctx     = ctx;
+
+    /* queue the call for the worker thread. Calls started from a completion
+       handler are run once the handler returns */
+
+    OcilibConditionAcquire(call->cond);
+
+    if (NULL != call->tail)
+    {
+        call->tail->next = job;
+    }
+    else
+    {
+        call->head = job;
+    }
+
+    call->tail   = job;
+    call->stmt   = stmt;
+    call->status = OCI_ACS_PENDING;
+    call->result = FALSE;
+
+    OcilibConditionBroadcast(call->cond);
+    OcilibConditionRelease(call->cond);
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (FAILURE && NULL != call && call != con->async)
+        {
+            OcilibConnectionAsyncFree(call);
+        }
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibConnectionWaitAsync
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibConnectionWaitAsync
+(
+    OCI_Connection *con,
+    OCI_Statement  *stmt
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    OCI_AsyncCall *call = con->async;
+
+    /* nothing to wait for if no call was started for the given statement or if
+       called from the completion handler running on the worker thread */
+
+    if (NULL != call && !OcilibConnectionIsAsyncWorker(call))
+    {
+        CHECK(OcilibConditionAcquire(call->cond))
+
+        if (NULL == stmt || stmt == call->stmt)
+        {
+            while (NULL != call->head || call->running)
+            {
+                OcilibConditionWait(call->cond);
+            }
+        }
+
+        CHECK(OcilibConditionRelease(call->cond))
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibConnectionGetAsyncStatus
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int OcilibConnectionGetAsyncStatus
+(
+    OCI_Connection *con,
+    OCI_Statement  *stmt
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ unsigned int, OCI_ACS_NONE,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    OCI_AsyncCall *call = con->async;
+
+    if (NULL != call)
+    {
+        CHECK(OcilibConditionAcquire(call->cond))
+
+        if (NULL == stmt || stmt == call->stmt)
+        {
+            SET_RETVAL(call->status)
+        }
+
+        CHECK(OcilibConditionRelease(call->cond))
+    }
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibConnectionReleaseAsync
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibConnectionReleaseAsync
+(
+    OCI_Connection *con
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    OCI_AsyncCall *call = con->async;
+
+    if (NULL != call)
+    {
+        const boolean worker = OcilibConnectionIsAsyncWorker(call);
+
+        CHECK(OcilibConditionAcquire(call->cond))
+
+        /* when the connection is freed from a completion handler, the worker
+           thread discards the calls not run yet and frees the call once the
+           handler returns. Otherwise, it runs the queued calls and exits */
+
+        call->stop     = TRUE;
+        call->detached = worker;
+
+        OcilibConditionBroadcast(call->cond);
+
+        CHECK(OcilibConditionRelease(call->cond))
+
+        if (!worker)
+        {
+            OcilibThreadJoin(call->thread);
+
+            OcilibConnectionAsyncFree(call);
+        }
+
+        con->async = NULL;
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
@@ -299,6 +299,23 @@ OCI_SYM_LOCAL boolean OcilibConnectionSetStatementCacheSize
     unsigned int    value
 );
 
+OCI_SYM_LOCAL unsigned int OcilibConnectionGetPreparedCacheSize
+(
+    OCI_Connection* con
+);
+
+OCI_SYM_LOCAL boolean OcilibConnectionSetPreparedCacheSize
+(
+    OCI_Connection* con,
+    unsigned int    value
+);
+
+OCI_SYM_LOCAL big_uint OcilibConnectionGetPreparedCacheValue
+(
+    OCI_Connection* con,
+    unsigned int    value
+);
+
 OCI_SYM_LOCAL unsigned int OcilibConnectionGetDefaultLobPrefetchSize
 (
     OCI_Connection* con
@@ -329,4 +346,31 @@ OCI_SYM_LOCAL boolean OcilibConnectionExecuteImmediateFmt
     va_list         args
 );
 
+OCI_SYM_LOCAL boolean OcilibConnectionRunAsync
+(
+    OCI_Connection   * con,
+    unsigned int       type,
+    OCI_Statement    * stmt,
+    OCI_Resultset    * rs,
+    POCI_ASYNC_HANDLER handler,
+    void             * ctx
+);
+
+OCI_SYM_LOCAL boolean OcilibConnectionWaitAsync
+(
+    OCI_Connection* con,
+    OCI_Statement * stmt
+);
+
+OCI_SYM_LOCAL unsigned int OcilibConnectionGetAsyncStatus
+(
+    OCI_Connection* con,
+    OCI_Statement * stmt
+);
+
+OCI_SYM_LOCAL boolean OcilibConnectionReleaseAsync
+(
+    OCI_Connection* con
+);
+
 #endif /* OCILIB_CONNECTION_H_INCLUDED */
\ No newline at end of file
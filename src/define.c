@@ -79,7 +79,7 @@ int OcilibDefineGetIndex
     {
         /* create the map at the first call to save time and memory when it's not needed */
 
-        rs->map = OcilibHashCreate(OCI_HASH_DEFAULT_SIZE, OCI_HASH_INTEGER);
+        rs->map = OcilibHashCreate(rs->nb_defs, OCI_HASH_INTEGER);
         CHECK_NULL(rs->map)
 
         for (ub4 i = 0; i < rs->nb_defs; i++)
@@ -94,17 +94,9 @@ int OcilibDefineGetIndex
 
     OCI_HashEntry *he = OcilibHashLookup(rs->map, name, FALSE);
 
-    while (NULL != he)
+    if (NULL != he)
     {
-        /* no more entries or key matched => so we got it ! */
-
-        if (NULL == he->next || 0 == OcilibStringCaseCompare(he->key, name))
-        {
-            index = he->values->value.num;
-            break;
-        }
-
-        he = he->next;
+        index = he->values->value.num;
     }
 
     if (index < 0)
@@ -118,24 +110,14 @@ int OcilibDefineGetIndex
 }
 
 /* --------------------------------------------------------------------------------------------- *
- * OcilibDefineGetData
+ * OcilibDefineIsHandleBased
  * --------------------------------------------------------------------------------------------- */
 
-void * OcilibDefineGetData
+static boolean OcilibDefineIsHandleBased
 (
     OCI_Define *def
 )
 {
-    ENTER_FUNC
-    (
-        /* returns */ void*, NULL,
-        /* context */ OCI_IPC_DEFINE, def
-    )
-
-    CHECK_PTR(OCI_IPC_DEFINE, def)
-
-    void* data = NULL;
-
     switch (def->col.datatype)
     {
         case OCI_CDT_LONG:
@@ -149,28 +131,89 @@ void * OcilibDefineGetData
         case OCI_CDT_REF:
         case OCI_CDT_XMLTYPE:
         case OCI_CDT_VECTOR:
-       {
-            /* handle based types */
-
-            data =  def->buf.data[def->rs->row_cur-1];
-            break;
+        {
+            return TRUE;
         }
         default:
         {
             /* special case for ROWIDs exposed as strings but internally handled as rowid descriptors */
 
-            if (IS_ROWID_COL(&def->col))
-            {
-                data = def->buf.data[def->rs->row_cur - 1];
-            }
-            else
-            {
-                /* scalar types */
-
-                data = (((ub1 *) (def->buf.data)) + (size_t) (def->col.bufsize * (def->rs->row_cur-1)));
-            }
+            return IS_ROWID_COL(&def->col);
         }
     }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibDefineGetData
+ * --------------------------------------------------------------------------------------------- */
+
+void * OcilibDefineGetData
+(
+    OCI_Define *def
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ void*, NULL,
+        /* context */ OCI_IPC_DEFINE, def
+    )
+
+    CHECK_PTR(OCI_IPC_DEFINE, def)
+
+    void* data = NULL;
+
+    if (OcilibDefineIsHandleBased(def))
+    {
+        /* handle based types */
+
+        data = def->buf.data[def->rs->row_cur - 1];
+    }
+    else
+    {
+        /* scalar types */
+
+        data = (((ub1 *) (def->buf.data)) + (size_t) (def->col.bufsize * (def->rs->row_cur-1)));
+    }
+
+    SET_RETVAL(data)
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibDefineGetBlockData
+ * --------------------------------------------------------------------------------------------- */
+
+void * OcilibDefineGetBlockData
+(
+    OCI_Define   *def,
+    ub4           row,
+    unsigned int *size
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ void*, NULL,
+        /* context */ OCI_IPC_DEFINE, def
+    )
+
+    CHECK_PTR(OCI_IPC_DEFINE, def)
+
+    void* data = NULL;
+
+    /* handle based types are arrays of handles while scalar types are
+       arrays of values of the column buffer size */
+
+    if (OcilibDefineIsHandleBased(def))
+    {
+        data  = &def->buf.data[row];
+        *size = (unsigned int) sizeof(void *);
+    }
+    else
+    {
+        data  = (((ub1 *) (def->buf.data)) + (size_t) (def->col.bufsize * row));
+        *size = (unsigned int) def->col.bufsize;
+    }
 
     SET_RETVAL(data)
 
@@ -365,6 +408,30 @@ boolean OcilibDefineAlloc
     EXIT_FUNC()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibDefineSwapBuffers
+ * --------------------------------------------------------------------------------------------- */
+
+void OcilibDefineSwapBuffers
+(
+    OCI_Define *def
+)
+{
+    OCI_Buffer tmp = def->buf;
+
+    /* the define handle and the buffer layout are shared by both placeholders */
+
+    def->buf.data     = def->ahead.data;
+    def->buf.lens     = def->ahead.lens;
+    def->buf.inds     = def->ahead.inds;
+    def->buf.obj_inds = def->ahead.obj_inds;
+
+    def->ahead.data     = tmp.data;
+    def->ahead.lens     = tmp.lens;
+    def->ahead.inds     = tmp.inds;
+    def->ahead.obj_inds = tmp.obj_inds;
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OcilibDefineDef
  * --------------------------------------------------------------------------------------------- */
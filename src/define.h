@@ -40,6 +40,13 @@ OCI_SYM_LOCAL void* OcilibDefineGetData
     OCI_Define* def
 );
 
+OCI_SYM_LOCAL void* OcilibDefineGetBlockData
+(
+    OCI_Define  * def,
+    ub4           row,
+    unsigned int* size
+);
+
 OCI_SYM_LOCAL boolean OcilibDefineIsDataNotNull
 (
     OCI_Define* def
@@ -58,6 +65,11 @@ OCI_SYM_LOCAL boolean OcilibDefineAlloc
     OCI_Define* def
 );
 
+OCI_SYM_LOCAL void OcilibDefineSwapBuffers
+(
+    OCI_Define *def
+);
+
 OCI_SYM_LOCAL boolean OcilibDefineDef
 (
     OCI_Define* def,
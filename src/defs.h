@@ -210,8 +210,14 @@ typedef unsigned short dbtext;
 #define OCI_IPC_DP_COL_ARRAY     63
 #define OCI_IPC_BATCH_ERRORS     64
 #define OCI_IPC_STATEMENT_ARRAY  65
+#define OCI_IPC_MEMORY_ARENA     66
+#define OCI_IPC_DESCRIPTOR_POOL  67
+#define OCI_IPC_ASYNC_CALL       68
+#define OCI_IPC_SQL_STATS        69
+#define OCI_IPC_PARALLEL_WORKER  70
+#define OCI_IPC_ASYNC_JOB        71
 
-#define OCI_IPC_COUNT            (OCI_IPC_STATEMENT_ARRAY + 2)
+#define OCI_IPC_COUNT            (OCI_IPC_ASYNC_JOB + 2)
 
 /* --------------------------------------------------------------------------------------------- *
  * Oracle conditional features
@@ -280,6 +286,13 @@ typedef unsigned short dbtext;
 #define OCI_BIND_INPUT                  1
 #define OCI_BIND_OUTPUT                 2
 
+/* --------------------------------------------------------------------------------------------- *
+ * bind arrays provided by the user
+ * --------------------------------------------------------------------------------------------- */
+
+#define OCI_BIND_EXT_INDICATORS         1
+#define OCI_BIND_EXT_LENGTHS            2
+
 /* --------------------------------------------------------------------------------------------- *
  * Type of schema describing
  * --------------------------------------------------------------------------------------------- */
@@ -347,6 +360,22 @@ typedef unsigned short dbtext;
 #define OCI_UTF8_BYTES_PER_CHAR 4
 #define OCI_SIZE_TMP_CVT        128
 
+/* memory arenas : slab size and size classes (from 32 to 4096 bytes, headers included) */
+
+#define OCI_SIZE_ARENA_SLAB     (64*1024)
+#define OCI_SIZE_ARENA_MIN      32
+#define OCI_ARENA_CLASS_COUNT   8
+#define OCI_SIZE_ARENA_MAX      (OCI_SIZE_ARENA_MIN << (OCI_ARENA_CLASS_COUNT - 1))
+
+/* hash tables : minimum number of slots and maximum load factor (percentage of used slots) */
+
+#define OCI_HASH_MIN_SIZE       16
+#define OCI_HASH_MAX_LOAD       75
+
+/* maximum number of descriptor arrays kept by the descriptor pool */
+
+#define OCI_DESCRIPTOR_POOL_MAX 64
+
 #ifdef _WINDOWS
 
 #define OCI_CVT_CHAR                  1
@@ -361,6 +390,8 @@ typedef unsigned short dbtext;
 
 #define OCI_FMT_COUNT                   6
 
+#define OCI_SSV_COUNT                   OCI_SSV_DEFINE_BYTES
+
 #define OCI_BIND_ARRAY_GROWTH_FACTOR    128
 
 #define OCI_DEF_ALIGN                   sizeof(void *)
@@ -416,12 +447,51 @@ typedef unsigned short dbtext;
 
 #define LIB_THREADED                    ((Env.env_mode & OCI_ENV_THREADED) && (Env.version_runtime> OCI_8_0))
 
+#define LIB_MEMORY_STATS                (!(Env.env_mode & OCI_ENV_NO_MEMORY_STATS))
+
+#define LIB_MEMORY_ARENA                (Env.env_mode & OCI_ENV_MEMORY_ARENA)
+
+#define LIB_MEMORY_PROFILING            (Env.env_mode & OCI_ENV_MEMORY_PROFILING)
+
+#define LIB_DESCRIPTOR_POOL             (Env.env_mode & OCI_ENV_DESCRIPTOR_POOL)
+#define LIB_TYPEINFO_CACHE              (Env.env_mode & OCI_ENV_TYPEINFO_CACHE)
+#define LIB_STATEMENT_STATS             (Env.env_mode & OCI_ENV_STATEMENT_STATS)
+
+/* lock free counters */
+
+#if defined(_MSC_VER)
+
+  #define OCI_ATOMIC_SUPPORTED
+
+  #define ATOMIC_ADD_BIG(ptr, val)      InterlockedExchangeAdd64((volatile LONG64 *) (ptr), (LONG64) (val))
+  #define ATOMIC_ADD_INT(ptr, val)      InterlockedExchangeAdd((volatile LONG *) (ptr), (LONG) (val))
+  #define ATOMIC_GET_BIG(ptr)           ((big_uint) InterlockedCompareExchange64((volatile LONG64 *) (ptr), 0, 0))
+  #define ATOMIC_CAS_BIG(ptr, cmp, val) (InterlockedCompareExchange64((volatile LONG64 *) (ptr), (LONG64) (val), (LONG64) (cmp)) == (LONG64) (cmp))
+
+#elif defined(__clang__) || (defined(__GNUC__) && ((__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 7))))
+
+  #define OCI_ATOMIC_SUPPORTED
+
+  #define ATOMIC_ADD_BIG(ptr, val)      __atomic_fetch_add((ptr), (big_uint) (val), __ATOMIC_RELAXED)
+  #define ATOMIC_ADD_INT(ptr, val)      __atomic_fetch_add((ptr), (unsigned int) (val), __ATOMIC_RELAXED)
+  #define ATOMIC_GET_BIG(ptr)           __atomic_load_n((ptr), __ATOMIC_RELAXED)
+  #define ATOMIC_CAS_BIG(ptr, cmp, val) __atomic_compare_exchange_n((ptr), &(cmp), (big_uint) (val), FALSE, __ATOMIC_RELAXED, __ATOMIC_RELAXED)
+
+#endif
+
 #define IS_PLSQL_STMT(type)         \
                                     \
     ((OCI_CST_BEGIN   == (type)) || \
      (OCI_CST_DECLARE == (type)) || \
      (OCI_CST_CALL    == (type)))
 
+#define IS_DML_STMT(type)           \
+                                    \
+    ((OCI_CST_INSERT  == (type)) || \
+     (OCI_CST_UPDATE  == (type)) || \
+     (OCI_CST_DELETE  == (type)) || \
+     (OCI_CST_MERGE   == (type)))
+
 #define IS_OCI_NUMBER(type, subtype) \
                                      \
     (OCI_CDT_NUMERIC == (type) && OCI_NUM_NUMBER == (subtype))
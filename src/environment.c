@@ -29,9 +29,11 @@
 #include "macros.h"
 #include "mutex.h"
 #include "pool.h"
+#include "statement.h"
 #include "stringutils.h"
 #include "subscription.h"
 #include "threadkey.h"
+#include "typeinfo.h"
 
 WARNING_DISABLE_CAST_FUNC_TYPE
 
@@ -297,6 +299,34 @@ static const unsigned int FormatTypeValues[] =
     OCI_FMT_TIMESTAMP_TZ
 };
 
+static const unsigned int MemoryProfileValues[] =
+{
+    OCI_MPV_BYTES,
+    OCI_MPV_COUNT,
+    OCI_MPV_PEAK
+};
+
+static const unsigned int DescriptorPoolValues[] =
+{
+    OCI_DPV_HITS,
+    OCI_DPV_MISSES,
+    OCI_DPV_SIZE
+};
+
+static const unsigned int SqlStatsValues[] =
+{
+    OCI_SSV_PREPARE_COUNT,
+    OCI_SSV_PREPARE_TIME,
+    OCI_SSV_EXECUTE_COUNT,
+    OCI_SSV_EXECUTE_TIME,
+    OCI_SSV_FETCH_COUNT,
+    OCI_SSV_FETCH_TIME,
+    OCI_SSV_ROWS_FETCHED,
+    OCI_SSV_ROUND_TRIPS,
+    OCI_SSV_BIND_BYTES,
+    OCI_SSV_DEFINE_BYTES
+};
+
 static const otext * FormatDefaultValues[OCI_FMT_COUNT] =
 {
     OCI_STRING_FORMAT_DATE,
@@ -1662,8 +1692,38 @@ boolean OcilibEnvironmentInitialize
             OCIThreadInit, Env.env, Env.err
         )
 
+#ifndef OCI_ATOMIC_SUPPORTED
+
+        /* memory counters are protected by a mutex if lock free counters are not available */
+
         Env.mem_mutex= OcilibMutexCreateInternal();
         CHECK_NULL(Env.mem_mutex)
+
+#endif
+
+        /* the descriptor pool is shared by all threads */
+
+        if (LIB_DESCRIPTOR_POOL)
+        {
+            Env.desc_pool.mutex = OcilibMutexCreateInternal();
+            CHECK_NULL(Env.desc_pool.mutex)
+        }
+
+        /* the type info cache is shared by all connections */
+
+        if (LIB_TYPEINFO_CACHE)
+        {
+            Env.tinf_cache.mutex = OcilibMutexCreateInternal();
+            CHECK_NULL(Env.tinf_cache.mutex)
+        }
+
+        /* statement statistics are aggregated by all threads */
+
+        if (LIB_STATEMENT_STATS)
+        {
+            Env.sql_stats.mutex = OcilibMutexCreateInternal();
+            CHECK_NULL(Env.sql_stats.mutex)
+        }
     }
 
     /* create thread key for thread errors */
@@ -1674,6 +1734,9 @@ boolean OcilibEnvironmentInitialize
     {
         Env.key_errs = OcilibThreadKeyCreateInternal((POCI_THREADKEYDEST)OcilibEnvironmentFreeError);
         CHECK_NULL(Env.key_errs)
+
+        Env.key_async = OcilibThreadKeyCreateInternal(NULL);
+        CHECK_NULL(Env.key_async)
     }
 
     WARNING_RESTORE_UNSAFE_CONVERT
@@ -1702,6 +1765,22 @@ boolean OcilibEnvironmentInitialize
 
 #endif
 
+    /* allocate the shared type info cache */
+
+    if (LIB_TYPEINFO_CACHE)
+    {
+        Env.tinf_cache.map = OcilibHashCreate(OCI_HASH_MIN_SIZE, OCI_HASH_POINTER);
+        CHECK_NULL(Env.tinf_cache.map)
+    }
+
+    /* allocate the statement statistics table */
+
+    if (LIB_STATEMENT_STATS)
+    {
+        Env.sql_stats.map = OcilibHashCreate(OCI_HASH_MIN_SIZE, OCI_HASH_POINTER);
+        CHECK_NULL(Env.sql_stats.map)
+    }
+
     Env.loaded = TRUE;
 
     /* test for XA support */
@@ -1779,6 +1858,18 @@ boolean OcilibEnvironmentCleanup
         FREE(LocaleStrings[i].str)
     }
 
+    /* free pooled OCI descriptors */
+
+    OcilibMemoryDescriptorPoolRelease();
+
+    /* free shared type info descriptions */
+
+    OcilibTypeInfoCacheRelease();
+
+    /* free statement statistics */
+
+    OcilibStatementStatsRelease();
+
     /* finalize OCIThread object support */
 
     if (LIB_THREADED)
@@ -1812,6 +1903,15 @@ boolean OcilibEnvironmentCleanup
             OcilibThreadKeySet(key, NULL);
             OcilibThreadKeyFree(key);
         }
+
+        /* free asynchronous call thread key */
+
+        if (NULL != Env.key_async)
+        {
+            OcilibThreadKeyFree(Env.key_async);
+
+            Env.key_async = NULL;
+        }
     }
 
     /* set unloaded flag */
@@ -1975,6 +2075,20 @@ big_uint OcilibEnvironmentGetAllocatedBytes
 
     CHECK_INITIALIZED()
 
+#ifdef OCI_ATOMIC_SUPPORTED
+
+    if (mem_type & OCI_MEM_ORACLE)
+    {
+        bytes_count += ATOMIC_GET_BIG(&Env.mem_bytes_oci);
+    }
+
+    if (mem_type & OCI_MEM_OCILIB)
+    {
+        bytes_count += ATOMIC_GET_BIG(&Env.mem_bytes_lib);
+    }
+
+#else
+
     if (mem_type & OCI_MEM_ORACLE)
     {
         bytes_count += Env.mem_bytes_oci;
@@ -1985,6 +2099,8 @@ big_uint OcilibEnvironmentGetAllocatedBytes
         bytes_count += Env.mem_bytes_lib;
     }
 
+#endif
+
     SET_RETVAL(bytes_count)
 
     EXIT_FUNC()
@@ -2015,6 +2131,249 @@ OCI_Error * OcilibEnvironmentGetLastError
     return err;
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibEnvironmentGetMemoryProfileSize
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int OcilibEnvironmentGetMemoryProfileSize
+(
+    void
+)
+{
+    GET_LIB_PROP
+    (
+        /* result */ unsigned int, 0,
+        /* value  */ OCI_IPC_COUNT
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibEnvironmentGetMemoryProfileName
+ * --------------------------------------------------------------------------------------------- */
+
+const otext * OcilibEnvironmentGetMemoryProfileName
+(
+    unsigned int index
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ const otext *, NULL,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    CHECK_INITIALIZED()
+    CHECK_BOUND(index, 1, OCI_IPC_COUNT)
+
+    SET_RETVAL(OcilibExceptionGetTypeName((int) index - 2))
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibEnvironmentGetMemoryProfileValue
+ * --------------------------------------------------------------------------------------------- */
+
+big_uint OcilibEnvironmentGetMemoryProfileValue
+(
+    unsigned int index,
+    unsigned int value
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ big_uint, 0,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    CHECK_INITIALIZED()
+    CHECK_BOUND(index, 1, OCI_IPC_COUNT)
+    CHECK_ENUM_VALUE(value, MemoryProfileValues, OTEXT("Memory profile value"))
+
+    OCI_MemoryProfile *profile = &Env.mem_profile[index - 1];
+
+    big_uint *counter = (OCI_MPV_BYTES == value) ? &profile->bytes :
+                        (OCI_MPV_COUNT == value) ? &profile->count : &profile->peak;
+
+#ifdef OCI_ATOMIC_SUPPORTED
+
+    SET_RETVAL(ATOMIC_GET_BIG(counter))
+
+#else
+
+    SET_RETVAL(*counter)
+
+#endif
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibEnvironmentGetDescriptorPoolValue
+ * --------------------------------------------------------------------------------------------- */
+
+big_uint OcilibEnvironmentGetDescriptorPoolValue
+(
+    unsigned int value
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ big_uint, 0,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    CHECK_INITIALIZED()
+    CHECK_ENUM_VALUE(value, DescriptorPoolValues, OTEXT("Descriptor pool value"))
+
+    OCI_DescriptorPool *pool = &Env.desc_pool;
+
+    if (NULL != pool->mutex)
+    {
+        OcilibMutexAcquire(pool->mutex);
+    }
+
+    SET_RETVAL((OCI_DPV_HITS   == value) ? pool->hits   :
+               (OCI_DPV_MISSES == value) ? pool->misses : (big_uint) pool->count)
+
+    if (NULL != pool->mutex)
+    {
+        OcilibMutexRelease(pool->mutex);
+    }
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibEnvironmentGetSqlStatsSize
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int OcilibEnvironmentGetSqlStatsSize
+(
+    void
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ unsigned int, 0,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    CHECK_INITIALIZED()
+
+    OCI_SqlStatsTable *table = &Env.sql_stats;
+
+    if (NULL != table->mutex)
+    {
+        OcilibMutexAcquire(table->mutex);
+    }
+
+    SET_RETVAL(table->count)
+
+    if (NULL != table->mutex)
+    {
+        OcilibMutexRelease(table->mutex);
+    }
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibEnvironmentGetSqlStatsName
+ * --------------------------------------------------------------------------------------------- */
+
+const otext * OcilibEnvironmentGetSqlStatsName
+(
+    unsigned int index
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ const otext *, NULL,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    CHECK_INITIALIZED()
+
+    OCI_SqlStatsTable *table = &Env.sql_stats;
+
+    const otext *key   = NULL;
+    unsigned int count = 0;
+
+    if (NULL != table->mutex)
+    {
+        OcilibMutexAcquire(table->mutex);
+    }
+
+    /* entries and their keys are never released before OCI_Cleanup() */
+
+    count = table->count;
+
+    if (index >= 1 && index <= count)
+    {
+        key = table->entries[index - 1]->key;
+    }
+
+    if (NULL != table->mutex)
+    {
+        OcilibMutexRelease(table->mutex);
+    }
+
+    CHECK_BOUND(index, 1, count)
+
+    SET_RETVAL(key)
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibEnvironmentGetSqlStatsValue
+ * --------------------------------------------------------------------------------------------- */
+
+big_uint OcilibEnvironmentGetSqlStatsValue
+(
+    unsigned int index,
+    unsigned int value
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ big_uint, 0,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    CHECK_INITIALIZED()
+    CHECK_ENUM_VALUE(value, SqlStatsValues, OTEXT("Statement statistics value"))
+
+    OCI_SqlStatsTable *table = &Env.sql_stats;
+
+    big_uint     result = 0;
+    unsigned int count  = 0;
+
+    if (NULL != table->mutex)
+    {
+        OcilibMutexAcquire(table->mutex);
+    }
+
+    count = table->count;
+
+    if (index >= 1 && index <= count)
+    {
+        result = table->entries[index - 1]->values[value - 1];
+    }
+
+    if (NULL != table->mutex)
+    {
+        OcilibMutexRelease(table->mutex);
+    }
+
+    CHECK_BOUND(index, 1, count)
+
+    SET_RETVAL(result)
+
+    EXIT_FUNC()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OcilibEnvironmentEnableWarnings
  * --------------------------------------------------------------------------------------------- */
@@ -70,6 +70,43 @@ OCI_SYM_LOCAL big_uint OcilibEnvironmentGetAllocatedBytes
     unsigned int mem_type
 );
 
+OCI_SYM_LOCAL unsigned int OcilibEnvironmentGetMemoryProfileSize
+(
+    void
+);
+
+OCI_SYM_LOCAL const otext * OcilibEnvironmentGetMemoryProfileName
+(
+    unsigned int index
+);
+
+OCI_SYM_LOCAL big_uint OcilibEnvironmentGetMemoryProfileValue
+(
+    unsigned int index,
+    unsigned int value
+);
+
+OCI_SYM_LOCAL big_uint OcilibEnvironmentGetDescriptorPoolValue
+(
+    unsigned int value
+);
+
+OCI_SYM_LOCAL unsigned int OcilibEnvironmentGetSqlStatsSize
+(
+    void
+);
+
+OCI_SYM_LOCAL const otext * OcilibEnvironmentGetSqlStatsName
+(
+    unsigned int index
+);
+
+OCI_SYM_LOCAL big_uint OcilibEnvironmentGetSqlStatsValue
+(
+    unsigned int index,
+    unsigned int value
+);
+
 OCI_SYM_LOCAL boolean OcilibEnvironmentEnableWarnings
 (
     boolean value
@@ -93,7 +93,13 @@ static const otext * TypeNames[OCI_IPC_COUNT] =
     OTEXT("Internal Long handle data buffer"),
     OTEXT("Internal trace info structure"),
     OTEXT("Internal array of direct path columns"),
-    OTEXT("Internal array of batch error objects")
+    OTEXT("Internal array of batch error objects"),
+    OTEXT("Internal array of statement handles"),
+    OTEXT("Internal memory arena"),
+    OTEXT("Internal descriptor pool entry"),
+    OTEXT("Internal asynchronous call"),
+    OTEXT("Internal SQL statistics entry"),
+    OTEXT("Internal parallel query worker")
 };
 
 #if defined(OCI_CHARSET_WIDE) && !defined(_MSC_VER)
@@ -131,7 +137,9 @@ static const otext * ErrorMessages[OCI_ERR_COUNT] =
     OTEXT("Cannot retrieve OCI environment from XA connection string '%ls'"),
     OTEXT("Cannot connect to database using XA connection string '%ls'"),
     OTEXT("Binding '%ls': Passing non NULL host variable is not allowed when bind allocation mode is internal"),
-    OTEXT("Found %d non freed allocated bytes")
+    OTEXT("Found %d non freed allocated bytes"),
+    OTEXT("OCILIB has already been initialized"),
+    OTEXT("Partition %d of the parallel query failed: %ls")
 };
 
 #else
@@ -169,7 +177,9 @@ static const otext * ErrorMessages[OCI_ERR_COUNT] =
     OTEXT("Cannot retrieve OCI environment from XA connection string '%s'"),
     OTEXT("Cannot connect to database using XA connection string '%s'"),
     OTEXT("Binding '%s': Passing non NULL host variable is not allowed when bind allocation mode is internal"),
-    OTEXT("Found %d non freed allocated bytes")
+    OTEXT("Found %d non freed allocated bytes"),
+    OTEXT("OCILIB has already been initialized"),
+    OTEXT("Partition %d of the parallel query failed: %s")
 };
 
 #endif
@@ -401,6 +411,30 @@ void OcilibExceptionNotInitialized
     EXCEPTION_IMPL_NO_ARGS(OCI_ERR_NOT_INITIALIZED)
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibExceptionGetTypeName
+ * --------------------------------------------------------------------------------------------- */
+
+const otext * OcilibExceptionGetTypeName
+(
+    int type
+)
+{
+    return (type >= OCI_IPC_ORACLE && type < OCI_IPC_COUNT - 1) ? TypeNames[type + 1] : NULL;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibExceptionAlreadyInitialized
+ * --------------------------------------------------------------------------------------------- */
+
+void OcilibExceptionAlreadyInitialized
+(
+    OCI_Context* ctx
+)
+{
+    EXCEPTION_IMPL_NO_ARGS(OCI_ERR_ALREADY_INITIALIZED)
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OcilibExceptionLoadingShareLib
  * --------------------------------------------------------------------------------------------- */
@@ -807,4 +841,18 @@ void OcilibExceptionExternalBindingNotAllowed
 )
 {
     EXCEPTION_IMPL(OCI_ERR_BIND_EXTERNAL_NOT_ALLOWED, bind)
-}
\ No newline at end of file
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibExceptionParallelQuery
+ * --------------------------------------------------------------------------------------------- */
+
+void OcilibExceptionParallelQuery
+(
+    OCI_Context * ctx,
+    unsigned int  partition,
+    const otext * error_msg
+)
+{
+    EXCEPTION_IMPL(OCI_ERR_PARALLEL_QUERY, (int) partition, error_msg)
+}
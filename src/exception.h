@@ -77,6 +77,16 @@ OCI_SYM_LOCAL void OcilibExceptionNotInitialized
     OCI_Context* ctx
 );
 
+OCI_SYM_LOCAL const otext * OcilibExceptionGetTypeName
+(
+    int type
+);
+
+OCI_SYM_LOCAL void OcilibExceptionAlreadyInitialized
+(
+    OCI_Context* ctx
+);
+
 OCI_SYM_LOCAL void OcilibExceptionLoadingSharedLib
 (
     OCI_Context* ctx
@@ -220,4 +230,11 @@ OCI_SYM_LOCAL void OcilibExceptionExternalBindingNotAllowed
     const otext * bind
 );
 
+OCI_SYM_LOCAL void OcilibExceptionParallelQuery
+(
+    OCI_Context * ctx,
+    unsigned int  partition,
+    const otext * error_msg
+);
+
 #endif /* OCILIB_EXCEPTION_H_INCLUDED */
@@ -20,14 +20,473 @@
 
 #include "format.h"
 
+#include "bind.h"
 #include "exception.h"
 #include "interval.h"
 #include "macros.h"
 #include "number.h"
 #include "reference.h"
+#include "statement.h"
 #include "stringutils.h"
 #include "timestamp.h"
 
+#define FORMAT_BIND_TEXT_SIZE   128
+#define FORMAT_BIND_ALIGN(size) (((size) + sizeof(big_int) - 1) & ~(sizeof(big_int) - 1))
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibFormatIsBindToken
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean OcilibFormatIsBindToken
+(
+    const otext *pf
+)
+{
+    switch (*pf)
+    {
+        case OTEXT('s'):
+        case OTEXT('t'):
+        case OTEXT('p'):
+        case OTEXT('v'):
+        case OTEXT('i'):
+        case OTEXT('u'):
+        case OTEXT('g'):
+        case OTEXT('n'):
+        {
+            return TRUE;
+        }
+        case OTEXT('l'):
+        case OTEXT('h'):
+        {
+            return (OTEXT('i') == pf[1]) || (OTEXT('u') == pf[1]);
+        }
+    }
+
+    return FALSE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibFormatGetBindName
+ * --------------------------------------------------------------------------------------------- */
+
+static void OcilibFormatGetBindName
+(
+    OCI_Statement *stmt,
+    unsigned int   index,
+    otext         *name,
+    int            size
+)
+{
+    /* binding by position requires numeric names while SQL placeholders can be any names */
+
+    if (OCI_BIND_BY_POS == stmt->bind_mode)
+    {
+        OcilibStringFormat(name, size, OTEXT(":%u"), index);
+    }
+    else
+    {
+        OcilibStringFormat(name, size, OTEXT(":p%u"), index);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibFormatGetBindExpression
+ * --------------------------------------------------------------------------------------------- */
+
+static int OcilibFormatGetBindExpression
+(
+    const otext **ppf,
+    va_list      *pargs,
+    unsigned int  index,
+    otext        *buf,
+    int           size
+)
+{
+    const otext *fmt = OTEXT(":p%u");
+
+    switch (**ppf)
+    {
+        case OTEXT('s'):
+        {
+            (void) va_arg(*pargs, const otext *);
+            break;
+        }
+        case OTEXT('t'):
+        {
+            (void) va_arg(*pargs, OCI_Date *);
+
+            fmt = OTEXT("to_date(:p%u, 'DDMMYYYYHH24MISS')");
+            break;
+        }
+        case OTEXT('p'):
+        {
+            (void) va_arg(*pargs, OCI_Timestamp *);
+
+            fmt = OTEXT("to_timestamp(:p%u, 'DDMMYYYYHH24MISSFF9')");
+            break;
+        }
+        case OTEXT('v'):
+        {
+            const OCI_Interval *itv = (OCI_Interval *) va_arg(*pargs, OCI_Interval *);
+
+            /* a NULL interval has no type and is bound as a plain NULL value */
+
+            if (NULL != itv)
+            {
+                fmt = (OCI_INTERVAL_YM == itv->type) ? OTEXT("to_yminterval(:p%u)")
+                                                     : OTEXT("to_dsinterval(:p%u)");
+            }
+            break;
+        }
+        case OTEXT('n'):
+        {
+            (void) va_arg(*pargs, OCI_Number *);
+
+            fmt = OTEXT("to_number(:p%u, '") OCI_STRING_FORMAT_NUM OTEXT("')");
+            break;
+        }
+        case OTEXT('i'):
+        {
+            (void) va_arg(*pargs, int);
+            break;
+        }
+        case OTEXT('u'):
+        {
+            (void) va_arg(*pargs, unsigned int);
+            break;
+        }
+        case OTEXT('g'):
+        {
+            (void) va_arg(*pargs, double);
+            break;
+        }
+        case OTEXT('l'):
+        {
+            if (OTEXT('i') == *(++(*ppf)))
+            {
+                (void) va_arg(*pargs, big_int);
+            }
+            else
+            {
+                (void) va_arg(*pargs, big_uint);
+            }
+            break;
+        }
+        case OTEXT('h'):
+        {
+            /* short int must be passed as int to va_args */
+
+            if (OTEXT('i') == *(++(*ppf)))
+            {
+                (void) va_arg(*pargs, int);
+            }
+            else
+            {
+                (void) va_arg(*pargs, unsigned int);
+            }
+            break;
+        }
+    }
+
+    return OcilibStringFormat(buf, size, fmt, index);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibFormatBindValues
+ * --------------------------------------------------------------------------------------------- */
+
+static size_t OcilibFormatBindValues
+(
+    OCI_Statement *stmt,
+    ub1           *data,
+    const otext   *format,
+    va_list       *pargs
+)
+{
+    ENTER_FUNC_NO_CONTEXT
+    (
+        /* returns */ size_t, 0
+    )
+
+    size_t       size  = 0;
+    unsigned int index = 0;
+
+    for (const otext *pf = format; *pf; pf++)
+    {
+        otext    name[32];
+        otext   *str   = NULL;
+        void    *value = NULL;
+        boolean  null  = FALSE;
+        size_t   len   = 0;
+
+        if (OTEXT('%') != *pf)
+        {
+            continue;
+        }
+
+        if (OTEXT('%') == *(++pf))
+        {
+            continue;
+        }
+
+        if (OTEXT('\0') == *pf)
+        {
+            break;
+        }
+
+        if (!OcilibFormatIsBindToken(pf))
+        {
+            /* consume arguments of tokens still formatted as SQL literals */
+
+            if (OTEXT('s') == *pf || OTEXT('m') == *pf)
+            {
+                (void) va_arg(*pargs, const otext *);
+            }
+            else if (OTEXT('r') == *pf)
+            {
+                (void) va_arg(*pargs, OCI_Ref *);
+            }
+
+            continue;
+        }
+
+        if (data)
+        {
+            value = data + size;
+            str   = (otext *) value;
+
+            OcilibFormatGetBindName(stmt, ++index, name, (int) osizeof(name) - 1);
+        }
+
+        switch (*pf)
+        {
+            case OTEXT('s'):
+            {
+                const otext *src = (const otext *) va_arg(*pargs, const otext *);
+
+                null = !IS_STRING_VALID(src);
+                len  = (null ? 0 : ostrlen(src) + 1) * sizeof(otext);
+
+                if (data)
+                {
+                    if (!null)
+                    {
+                        ostrcpy(str, src);
+                    }
+
+                    CHECK(OcilibStatementBindString(stmt, name, str, 0))
+                }
+
+                len = max(len, sizeof(otext));
+                break;
+            }
+            case OTEXT('t'):
+            {
+                OCI_Date *date = (OCI_Date *) va_arg(*pargs, OCI_Date *);
+
+                null = (NULL == date);
+                len  = FORMAT_BIND_TEXT_SIZE * sizeof(otext);
+
+                if (data)
+                {
+                    if (!null)
+                    {
+                        OcilibStringFormat
+                        (
+                            str, FORMAT_BIND_TEXT_SIZE - 1,
+                            OTEXT("%02i%02i%04i%02i%02i%02i"),
+                            date->handle->OCIDateDD,
+                            date->handle->OCIDateMM,
+                            date->handle->OCIDateYYYY,
+                            date->handle->OCIDateTime.OCITimeHH,
+                            date->handle->OCIDateTime.OCITimeMI,
+                            date->handle->OCIDateTime.OCITimeSS
+                        );
+                    }
+
+                    CHECK(OcilibStatementBindString(stmt, name, str, FORMAT_BIND_TEXT_SIZE - 1))
+                }
+                break;
+            }
+            case OTEXT('p'):
+            {
+                OCI_Timestamp *tmsp = (OCI_Timestamp *) va_arg(*pargs, OCI_Timestamp *);
+
+                null = (NULL == tmsp);
+                len  = FORMAT_BIND_TEXT_SIZE * sizeof(otext);
+
+                if (data)
+                {
+                    if (!null)
+                    {
+                        int yy = 0, mm = 0, dd = 0, hh = 0, mi = 0, ss = 0, ff = 0;
+
+                        CHECK(OcilibTimestampGetDateTime(tmsp, &yy, &mm, &dd, &hh, &mi, &ss, &ff))
+
+                        OcilibStringFormat
+                        (
+                            str, FORMAT_BIND_TEXT_SIZE - 1,
+                            OTEXT("%02i%02i%04i%02i%02i%02i%09i"),
+                            dd, mm, yy, hh, mi, ss, ff
+                        );
+                    }
+
+                    CHECK(OcilibStatementBindString(stmt, name, str, FORMAT_BIND_TEXT_SIZE - 1))
+                }
+                break;
+            }
+            case OTEXT('v'):
+            {
+                OCI_Interval *itv = (OCI_Interval *) va_arg(*pargs, OCI_Interval *);
+
+                null = (NULL == itv);
+                len  = FORMAT_BIND_TEXT_SIZE * sizeof(otext);
+
+                if (data)
+                {
+                    if (!null)
+                    {
+                        CHECK(OcilibIntervalToString(itv, 9, 9, FORMAT_BIND_TEXT_SIZE - 1, str))
+                    }
+
+                    CHECK(OcilibStatementBindString(stmt, name, str, FORMAT_BIND_TEXT_SIZE - 1))
+                }
+                break;
+            }
+            case OTEXT('n'):
+            {
+                OCI_Number *number = (OCI_Number *) va_arg(*pargs, OCI_Number *);
+
+                null = (NULL == number);
+                len  = FORMAT_BIND_TEXT_SIZE * sizeof(otext);
+
+                if (data)
+                {
+                    if (!null)
+                    {
+                        CHECK(OcilibNumberToString(number, OCI_STRING_FORMAT_NUM,
+                                                   FORMAT_BIND_TEXT_SIZE - 1, str))
+                    }
+
+                    CHECK(OcilibStatementBindString(stmt, name, str, FORMAT_BIND_TEXT_SIZE - 1))
+                }
+                break;
+            }
+            case OTEXT('i'):
+            {
+                const int src = va_arg(*pargs, int);
+
+                len = sizeof(int);
+
+                if (data)
+                {
+                    *((int *) value) = src;
+
+                    CHECK(OcilibStatementBindInt(stmt, name, (int *) value))
+                }
+                break;
+            }
+            case OTEXT('u'):
+            {
+                const unsigned int src = va_arg(*pargs, unsigned int);
+
+                len = sizeof(unsigned int);
+
+                if (data)
+                {
+                    *((unsigned int *) value) = src;
+
+                    CHECK(OcilibStatementBindUnsignedInt(stmt, name, (unsigned int *) value))
+                }
+                break;
+            }
+            case OTEXT('g'):
+            {
+                const double src = va_arg(*pargs, double);
+
+                len = sizeof(double);
+
+                if (data)
+                {
+                    *((double *) value) = src;
+
+                    CHECK(OcilibStatementBindDouble(stmt, name, (double *) value))
+                }
+                break;
+            }
+            case OTEXT('l'):
+            {
+                len = sizeof(big_int);
+
+                if (OTEXT('i') == *(++pf))
+                {
+                    const big_int src = va_arg(*pargs, big_int);
+
+                    if (data)
+                    {
+                        *((big_int *) value) = src;
+
+                        CHECK(OcilibStatementBindBigInt(stmt, name, (big_int *) value))
+                    }
+                }
+                else
+                {
+                    const big_uint src = va_arg(*pargs, big_uint);
+
+                    if (data)
+                    {
+                        *((big_uint *) value) = src;
+
+                        CHECK(OcilibStatementBindUnsignedBigInt(stmt, name, (big_uint *) value))
+                    }
+                }
+                break;
+            }
+            case OTEXT('h'):
+            {
+                len = sizeof(short);
+
+                /* short int must be passed as int to va_args */
+
+                if (OTEXT('i') == *(++pf))
+                {
+                    const short src = (short) va_arg(*pargs, int);
+
+                    if (data)
+                    {
+                        *((short *) value) = src;
+
+                        CHECK(OcilibStatementBindShort(stmt, name, (short *) value))
+                    }
+                }
+                else
+                {
+                    const unsigned short src = (unsigned short) va_arg(*pargs, unsigned int);
+
+                    if (data)
+                    {
+                        *((unsigned short *) value) = src;
+
+                        CHECK(OcilibStatementBindUnsignedShort(stmt, name, (unsigned short *) value))
+                    }
+                }
+                break;
+            }
+        }
+
+        if (data && null)
+        {
+            CHECK(OcilibBindSetNull(OcilibStatementGetBind2(stmt, name)))
+        }
+
+        size += FORMAT_BIND_ALIGN(len);
+    }
+
+    SET_RETVAL(size)
+
+    EXIT_FUNC()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OcilibParseSqlFmt
  * --------------------------------------------------------------------------------------------- */
@@ -49,12 +508,16 @@ int OcilibFormatParseSql
     int size = 0;
     int          len   = 0;
     boolean      quote = FALSE;
+    boolean      binds = FALSE;
+    unsigned int index = 0;
     otext       *pb    = buf;
     const otext *pf    = format;
 
     CHECK_PTR(OCI_IPC_STATEMENT, stmt)
     CHECK_PTR(OCI_IPC_STRING,    format)
 
+    binds = (OCI_FPM_BIND == stmt->fmt_param_mode);
+
     for (; *pf; pf++)
     {
         if (*pf != OTEXT('%'))
@@ -84,6 +547,24 @@ int OcilibFormatParseSql
             }
         }
 
+        /* in bind mode, values are replaced by bind variables bound by OcilibFormatBindSql() */
+
+        if (binds && OcilibFormatIsBindToken(pf))
+        {
+            otext temp[128];
+
+            len = OcilibFormatGetBindExpression(&pf, pargs, ++index, temp, (int) osizeof(temp) - 1);
+
+            if (buf && (len > 0))
+            {
+                ostrcpy(pb, temp);
+                pb += (size_t) len;
+            }
+
+            size += len;
+            continue;
+        }
+
         switch (*pf)
         {
             case OTEXT('s'):
@@ -421,3 +902,64 @@ int OcilibFormatParseSql
 
     EXIT_FUNC()
 }
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibFormatBindSql
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibFormatBindSql
+(
+    OCI_Statement *stmt,
+    const otext   *format,
+    va_list       *pargs
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    va_list size_args;
+
+    unsigned int alloc_mode = OCI_BAM_EXTERNAL;
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+    CHECK_PTR(OCI_IPC_STRING,    format)
+
+    alloc_mode = stmt->bind_alloc_mode;
+
+    va_copy(size_args, *pargs);
+
+    if (OCI_FPM_BIND == stmt->fmt_param_mode)
+    {
+        /* first, get the size required to store values */
+
+        const size_t size = OcilibFormatBindValues(stmt, NULL, format, &size_args);
+
+        if (size > 0)
+        {
+            /* values are owned by the statement until it is prepared again or freed */
+
+            ALLOC_BUFFER(OCI_IPC_VOID, stmt->fmt_data, size, 1)
+
+            /* store and bind values */
+
+            stmt->bind_alloc_mode = OCI_BAM_EXTERNAL;
+
+            CHECK(OcilibFormatBindValues(stmt, (ub1 *) stmt->fmt_data, format, pargs) == size)
+        }
+    }
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        va_end(size_args);
+
+        if (NULL != stmt)
+        {
+            stmt->bind_alloc_mode = alloc_mode;
+        }
+    )
+}
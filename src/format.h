@@ -31,4 +31,11 @@ OCI_SYM_LOCAL int OcilibFormatParseSql
     va_list      * pargs
 );
 
+OCI_SYM_LOCAL boolean OcilibFormatBindSql
+(
+    OCI_Statement* stmt,
+    const otext  * format,
+    va_list      * pargs
+);
+
 #endif /* OCILIB_FORMAT_H_INCLUDED */
@@ -36,24 +36,118 @@ static const unsigned int HashTypeValues[] =
  * --------------------------------------------------------------------------------------------- */
 
 static unsigned int OcilibHashCompute
+(
+    const otext *str
+)
+{
+    /* case insensitive FNV-1a hash */
+
+    unsigned int h = 2166136261U;
+
+    for (const otext *p = str; (*p) != 0; p++)
+    {
+        h ^= (unsigned int) otoupper(*p);
+        h *= 16777619U;
+    }
+
+    /* 0 is reserved for empty slots */
+
+    return (0 != h) ? h : 1;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibHashFindSlot
+ * --------------------------------------------------------------------------------------------- */
+
+static unsigned int OcilibHashFindSlot
 (
     OCI_HashTable *table,
-    const otext   *str
+    const otext   *key,
+    unsigned int   hash
 )
 {
-    unsigned int h;
+    const unsigned int mask = table->size - 1;
 
-    otext *p;
+    unsigned int i = hash & mask;
 
-    CHECK_FALSE(NULL == table, 0);
-    CHECK_FALSE(NULL == str,   0);
+    /* the load factor guarantees that empty slots are always available */
 
-    for(h = 0, p = (otext *) str; (*p) != 0; p++)
+    while (0 != table->hashes[i])
     {
-        h = 31 * h + otoupper(*p);
+        if (hash == table->hashes[i] && 0 == OcilibStringCaseCompare(table->slots[i].entry.key, key))
+        {
+            break;
+        }
+
+        i = (i + 1) & mask;
     }
 
-    return (h % table->size);
+    return i;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibHashResize
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean OcilibHashResize
+(
+    OCI_HashTable *table,
+    unsigned int   size
+)
+{
+    ENTER_FUNC_NO_CONTEXT
+    (
+        /* returns */ boolean, FALSE
+    )
+
+    OCI_HashSlot *slots  = NULL;
+    unsigned int *hashes = NULL;
+
+    ALLOC_DATA(OCI_IPC_HASHENTRY_ARRAY, slots,  size)
+    ALLOC_DATA(OCI_IPC_HASHENTRY_ARRAY, hashes, size)
+
+    /* move existing entries, keys are unique so no comparison is needed */
+
+    for (unsigned int i = 0; i < table->size; i++)
+    {
+        if (0 != table->hashes[i])
+        {
+            unsigned int j = table->hashes[i] & (size - 1);
+
+            while (0 != hashes[j])
+            {
+                j = (j + 1) & (size - 1);
+            }
+
+            hashes[j] = table->hashes[i];
+            slots[j]  = table->slots[i];
+
+            /* the first value is stored inline */
+
+            if (NULL != slots[j].entry.values)
+            {
+                slots[j].entry.values = &slots[j].value;
+            }
+        }
+    }
+
+    FREE(table->slots)
+    FREE(table->hashes)
+
+    table->slots  = slots;
+    table->hashes = hashes;
+    table->size   = size;
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (FAILURE)
+        {
+            FREE(slots)
+            FREE(hashes)
+        }
+    )
 }
 
 /* --------------------------------------------------------------------------------------------- *
@@ -74,59 +168,58 @@ static boolean OcilibHashAdd
         /* context */ OCI_IPC_HASHTABLE, table
     )
 
-    OCI_HashEntry * e = NULL;
-    OCI_HashValue * v = NULL, *v1 = NULL, *v2 = NULL;
+    OCI_HashValue *v = NULL;
 
     CHECK_PTR(OCI_IPC_HASHTABLE, table)
     CHECK_PTR(OCI_IPC_STRING,      key)
     CHECK_COMPAT(table->type == type)
 
-    boolean success = FALSE;
-
-    e = OcilibHashLookup(table, key, TRUE);
+    OCI_HashEntry *e = OcilibHashLookup(table, key, TRUE);
+    CHECK_NULL(e)
 
-    if (NULL != e)
+    if (NULL == e->values)
     {
-        v = (OCI_HashValue *)OcilibMemoryAlloc(OCI_IPC_HASHVALUE, sizeof(*v),
-                                               (size_t)1, TRUE);
+        /* first value of the entry is stored in its slot */
 
-        if (NULL != v)
-        {
-            if (OCI_HASH_STRING == table->type && value.p_text)
-            {
-                v->value.p_text = OcilibStringDuplicate(value.p_text);
-            }
-            else if (OCI_HASH_INTEGER == table->type)
-            {
-                v->value.num = value.num;
-            }
-            else
-            {
-                v->value.p_void = value.p_void;
-            }
+        v = &((OCI_HashSlot *) e)->value;
 
-            v1 = v2 = e->values;
+        memset(v, 0, sizeof(*v));
+    }
+    else
+    {
+        ALLOC_DATA(OCI_IPC_HASHVALUE, v, 1)
+    }
 
-            while (NULL != v1)
-            {
-                v2 = v1;
-                v1 = v1->next;
-            }
+    if (OCI_HASH_STRING == table->type && value.p_text)
+    {
+        v->value.p_text = OcilibStringDuplicate(value.p_text);
+    }
+    else if (OCI_HASH_INTEGER == table->type)
+    {
+        v->value.num = value.num;
+    }
+    else
+    {
+        v->value.p_void = value.p_void;
+    }
 
-            if (NULL != v2)
-            {
-                v2->next = v;
-            }
-            else
-            {
-                e->values = v;
-            }
+    if (NULL != e->values)
+    {
+        OCI_HashValue *last = e->values;
 
-            success = TRUE;
+        while (NULL != last->next)
+        {
+            last = last->next;
         }
+
+        last->next = v;
+    }
+    else
+    {
+        e->values = v;
     }
 
-    SET_RETVAL(success)
+    SET_SUCCESS()
 
     EXIT_FUNC()
 }
@@ -158,18 +251,21 @@ OCI_HashTable * OcilibHashCreate
                                                (size_t) 1, TRUE);
     CHECK_NULL(table)
 
-    /* set up attributes and allocate internal array of hash entry pointers */
+    /* set up attributes and allocate internal arrays of slots and hashes.
+       The number of slots is a power of 2 in order to compute indexes with a mask */
+
+    unsigned int slots = OCI_HASH_MIN_SIZE;
+
+    while (slots < size && slots < (UINT_MAX >> 1))
+    {
+        slots <<= 1;
+    }
 
     table->type  = type;
     table->size  = 0;
     table->count = 0;
 
-    table->items = (OCI_HashEntry **)OcilibMemoryAlloc(OCI_IPC_HASHENTRY_ARRAY,
-                                                       sizeof(*table->items),
-                                                       (size_t) size, TRUE);
-    CHECK_NULL(table->items);
-
-    table->size = size;
+    CHECK(OcilibHashResize(table, slots))
 
     CLEANUP_AND_EXIT_FUNC
     (
@@ -198,49 +294,46 @@ boolean OcilibHashFree
         /* context */ OCI_IPC_HASHTABLE, table
     )
 
-    OCI_HashEntry *e1 = NULL, *e2 = NULL;
-    OCI_HashValue *v1 = NULL, *v2 = NULL;
-
     CHECK_PTR(OCI_IPC_HASHTABLE, table)
 
-    if (NULL != table->items)
+    if (NULL != table->slots && NULL != table->hashes)
     {
         for (unsigned int i = 0; i < table->size; i++)
         {
-            e1 = table->items[i];
-
-            while (NULL != e1)
+            if (0 == table->hashes[i])
             {
-                e2 = e1;
-                e1 = e1->next;
+                continue;
+            }
 
-                v1 = e2->values;
+            OCI_HashSlot  *slot = &table->slots[i];
+            OCI_HashValue *v1   = slot->entry.values;
 
-                while (NULL != v1)
-                {
-                    v2 = v1;
-                    v1 = v1->next;
+            while (NULL != v1)
+            {
+                OCI_HashValue *v2 = v1;
 
-                    if (OCI_HASH_STRING == table->type)
-                    {
-                        FREE(v2->value.p_text)
-                    }
+                v1 = v1->next;
 
-                    FREE(v2)
+                if (OCI_HASH_STRING == table->type)
+                {
+                    FREE(v2->value.p_text)
                 }
 
-                if (NULL != e2->key)
+                /* the first value is stored in the slot */
+
+                if (v2 != &slot->value)
                 {
-                    FREE(e2->key)
+                    FREE(v2)
                 }
-
-                FREE(e2)
             }
-        }
 
-        FREE(table->items)
+            FREE(slot->entry.key)
+        }
     }
 
+    FREE(table->slots)
+    FREE(table->hashes)
+
     OcilibErrorResetSource(NULL, table);
 
     FREE(table)
@@ -340,7 +433,7 @@ OCI_HashEntry * OcilibHashGetEntry
 
     CHECK(index < table->size)
 
-    SET_RETVAL(table->items[index])
+    SET_RETVAL((0 != table->hashes[index]) ? &table->slots[index].entry : NULL)
 
     EXIT_FUNC()
 }
@@ -536,59 +629,45 @@ OCI_HashEntry * OcilibHashLookup
         /* context */ OCI_IPC_HASHTABLE, table
     )
 
-    OCI_HashEntry *e = NULL, *e1 = NULL, *e2 = NULL;
+    OCI_HashEntry *e = NULL;
 
     CHECK_PTR(OCI_IPC_HASHTABLE, table)
     CHECK_PTR(OCI_IPC_STRING,      key)
 
-    const unsigned int i = OcilibHashCompute(table, key);
+    const unsigned int hash = OcilibHashCompute(key);
+
+    unsigned int i = OcilibHashFindSlot(table, key, hash);
 
-    if (i < table->size)
+    if (0 != table->hashes[i])
     {
-        for(e = table->items[i]; e; e = e->next)
+        e = &table->slots[i].entry;
+    }
+    else if (create)
+    {
+        /* grow the table before it gets too crowded */
+
+        if ((table->count + 1) * (size_t) 100 > table->size * (size_t) OCI_HASH_MAX_LOAD)
         {
-            if (OcilibStringCaseCompare(e->key, key) == 0)
-            {
-                break;
-            }
+            CHECK(OcilibHashResize(table, table->size << 1))
+
+            i = OcilibHashFindSlot(table, key, hash);
         }
 
-        if (NULL == e && create)
-        {
-            e = (OCI_HashEntry *)OcilibMemoryAlloc(OCI_IPC_HASHENTRY,
-                                                   sizeof(*e),
-                                                   (size_t) 1,
-                                                   TRUE);
-            CHECK_NULL(e)
+        OCI_HashSlot *slot = &table->slots[i];
 
-            e->key = OcilibStringDuplicate(key);
+        slot->entry.key = OcilibStringDuplicate(key);
+        CHECK_NULL(slot->entry.key)
 
-            e1 = e2 = table->items[i];
+        slot->entry.values = NULL;
+        slot->entry.next   = NULL;
 
-            while (NULL != e1)
-            {
-                e2 = e1;
-                e1 = e1->next;
-            }
+        table->hashes[i] = hash;
+        table->count++;
 
-            if (NULL != e2)
-            {
-                e2->next = e;
-            }
-            else
-            {
-                table->items[i] = e;
-            }
-        }
+        e = &slot->entry;
     }
 
-    CLEANUP_AND_EXIT_FUNC
-    (
-        if (FAILURE && create)
-        {
-            FREE(e)
-        }
+    SET_RETVAL(e)
 
-        SET_RETVAL(e)
-    )
+    EXIT_FUNC()
 }
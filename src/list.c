@@ -24,26 +24,37 @@
 #include "memory.h"
 #include "mutex.h"
 
-#define LIST_FOR_EACH(exp)     \
+/* list entries are stored right after the item data, aligned on a pointer boundary */
+
+#define LIST_ITEM_OFFSET(size) \
                                \
-    if (list)                  \
-    {                          \
-        OCI_Item *item = NULL; \
-        item = list->head;     \
-        while (item)           \
-        {                      \
-            exp;               \
-            item = item->next; \
-        }                      \
+    (((size_t) (size) + sizeof(void *) - 1) & ~(sizeof(void *) - 1))
+
+#define LIST_ITEM_FROM_DATA(list, data) \
+                                        \
+    ((OCI_Item *) (((unsigned char *) (data)) + (list)->offset))
+
+#define LIST_FOR_EACH(exp)               \
+                                         \
+    if (list)                            \
+    {                                    \
+        OCI_Item *item = list->head;     \
+        while (item)                     \
+        {                                \
+            OCI_Item *next = item->next; \
+            exp;                         \
+            item = next;                 \
+        }                                \
     }
+
 /* --------------------------------------------------------------------------------------------- *
  * OcilibListCreateItem
  * --------------------------------------------------------------------------------------------- */
 
 static OCI_Item * OcilibListCreateItem
 (
-    int type,
-    int size
+    OCI_List *list,
+    int       size
 )
 {
     ENTER_FUNC
@@ -52,42 +63,35 @@ static OCI_Item * OcilibListCreateItem
         /* context */ OCI_IPC_VOID, &Env
     )
 
-    OCI_Item* item = NULL;
-
     CHECK_BOUND(size, 0, INT_MAX)
 
-    /* allocate list item entry */
+    /* all items of a given list have the same size, set by the first appended item */
 
-    item =  (OCI_Item *)OcilibMemoryAlloc(OCI_IPC_LIST_ITEM,
-                                          sizeof(*item),
-                                          (size_t) 1, TRUE);
+    if (0 == list->offset)
+    {
+        list->offset = LIST_ITEM_OFFSET(size);
+    }
+    else if (LIST_ITEM_OFFSET(size) > list->offset)
+    {
+        THROW_NO_ARGS(OcilibExceptionTypeNotCompatible)
+    }
 
-    CHECK_NULL(item)
+    /* allocate item data buffer and list entry at once */
 
-    /* allocate item data buffer */
+    unsigned char *data = (unsigned char *)OcilibMemoryArenaAlloc(list->arena, list->type,
+                                                                  list->offset + sizeof(OCI_Item),
+                                                                  (size_t) 1, TRUE);
 
-    item->data = (void *)OcilibMemoryAlloc(type, (size_t) size,
-                                           (size_t) 1, TRUE);
+    CHECK_NULL(data)
 
-    CHECK_NULL(item->data)
+    OCI_Item *item = LIST_ITEM_FROM_DATA(list, data);
 
-    CLEANUP_AND_EXIT_FUNC
-    (
-        if (FAILURE)
-        {
-            if (NULL != item)
-            {
-                if (NULL != item->data)
-                {
-                    FREE(item->data)
-                }
-
-                FREE(item)
-            }
-        }
+    item->data = data;
+    item->list = list;
 
-        SET_RETVAL(item)
-    )
+    SET_RETVAL(item)
+
+    EXIT_FUNC()
 }
 
 /* --------------------------------------------------------------------------------------------- *
@@ -182,30 +186,24 @@ void * OcilibListAppend
         /* context */ OCI_IPC_LIST, list
     )
 
-    OCI_Item *item = NULL;
-    OCI_Item *temp = NULL;
-
     CHECK_PTR(OCI_IPC_LIST, list)
 
-    item = OcilibListCreateItem(list->type, size);
+    OCI_Item *item = OcilibListCreateItem(list, size);
     CHECK_NULL(item)
 
-    temp = list->head;
+    item->prev = list->tail;
 
-    while (NULL != temp && NULL != temp->next)
+    if (NULL != list->tail)
     {
-        temp = temp->next;
-    }
-
-    if (NULL != temp)
-    {
-        temp->next = item;
+        list->tail->next = item;
     }
     else
     {
         list->head = item;
     }
 
+    list->tail = item;
+
     list->count++;
 
     SET_RETVAL(item->data)
@@ -228,27 +226,14 @@ boolean OcilibListClear
         /* context */ OCI_IPC_LIST, list
     )
 
-    OCI_Item *item = NULL;
-
     CHECK_PTR(OCI_IPC_LIST, list)
 
-    /* walk along the list to free item's buffer */
-
-    item = list->head;
+    /* walk along the list to free item's buffer (list entries are freed with it) */
 
-    while (NULL != item)
-    {
-        OCI_Item *temp = item;
-
-        item = item->next;
-
-        /* free data */
-
-        FREE(temp->data)
-        FREE(temp)
-    }
+    LIST_FOR_EACH(OcilibMemoryFree(item->data))
 
     list->head  = NULL;
+    list->tail  = NULL;
     list->count = 0;
 
     SET_SUCCESS()
@@ -325,46 +310,46 @@ boolean OcilibListRemove
         /* context */ OCI_IPC_LIST, list
     )
 
-    OCI_Item *item = NULL;
-    OCI_Item *temp = NULL;
-
     CHECK_PTR(OCI_IPC_LIST, list)
     CHECK_PTR(OCI_IPC_VOID, data)
 
-    item = list->head;
+    /* the list entry is located from the item data without any lookup, once checked that
+       the data is a block large enough to hold an entry of this list */
 
-    boolean found = FALSE;
+    OCI_Item *item  = NULL;
+    boolean   found = FALSE;
 
-    while (NULL != item)
+    if (list->count > 0 && OcilibMemoryIsBlockOfType(data, list->type, list->offset + sizeof(OCI_Item)))
     {
-        if (item->data == data)
-        {
-            found = TRUE;
-
-            if (NULL != temp)
-            {
-                temp->next = item->next;
-            }
-
-            /* if item was the first entry, readjust the first list
-               entry to next element */
-
-            if (item == list->head)
-            {
-                list->head = item->next;
-            }
+        item  = LIST_ITEM_FROM_DATA(list, data);
+        found = (item->list == list && item->data == data);
+    }
 
-            FREE(item)
+    if (found)
+    {
+        if (NULL != item->prev)
+        {
+            item->prev->next = item->next;
+        }
+        else
+        {
+            list->head = item->next;
+        }
 
-            break;
+        if (NULL != item->next)
+        {
+            item->next->prev = item->prev;
+        }
+        else
+        {
+            list->tail = item->prev;
         }
 
-        temp = item;
-        item = item->next;
-    }
+        item->prev = NULL;
+        item->next = NULL;
+        item->data = NULL;
+        item->list = NULL;
 
-    if (found)
-    {
         list->count--;
     }
 
@@ -447,6 +447,15 @@ ExitLabel:                          \
                                      \
     ALLOC_BUFFER(type, ptr, sizeof(*(ptr)), count)
 
+#define ARENA_ALLOC_DATA(arena, type, ptr, count)                                               \
+                                                                                                \
+    if (!(ptr))                                                                                 \
+    {                                                                                           \
+        (ptr) = OcilibMemoryArenaAlloc(arena, type, sizeof(*(ptr)), (size_t) (count), TRUE);    \
+                                                                                                \
+        CHECK_NULL((ptr))                                                                       \
+    }                                                                                           \
+
 #define REALLOC_DATA(type, ptr, cur, alloc, inc) \
                                                  \
     REALLOC_BUFFER(type, ptr, sizeof(*(ptr)), cur, alloc, inc)
@@ -39,6 +39,49 @@
         OcilibMutexRelease(Env.mem_mutex);  \
     }                                       \
 
+#ifdef OCI_ATOMIC_SUPPORTED
+
+  #define COUNTER_ADD_BIG(var, val) ATOMIC_ADD_BIG(&(var), val);
+  #define COUNTER_ADD_INT(var, val) ATOMIC_ADD_INT(&(var), val);
+
+#else
+
+  #define COUNTER_ADD_BIG(var, val) MUTEXED_CALL((var) += (val))
+  #define COUNTER_ADD_INT(var, val) MUTEXED_CALL((var) += (val))
+
+#endif
+
+/* memory blocks headers are padded to keep user data 16 bytes aligned */
+
+#define MEMORY_BLOCK_HEADER_SIZE \
+                                 \
+    ((sizeof(OCI_MemoryBlock) + (size_t) 15) & ~((size_t) 15))
+
+#define MEMORY_BLOCK_DATA(block) \
+                                 \
+    (((unsigned char *) (block)) + MEMORY_BLOCK_HEADER_SIZE)
+
+#define MEMORY_BLOCK_FROM_DATA(ptr) \
+                                    \
+    ((OCI_MemoryBlock *) (((unsigned char *) (ptr)) - MEMORY_BLOCK_HEADER_SIZE))
+
+/* LOB and file locators are never pooled as they may still reference temporary LOBs */
+
+#define IS_POOLED_DESCRIPTOR_TYPE(type)                                                      \
+                                                                                             \
+    (LIB_DESCRIPTOR_POOL && OCI_DTYPE_LOB != (type) && OCI_DTYPE_FILE != (type))
+
+static void OcilibMemoryArenaRelease
+(
+    OCI_MemoryArena *arena,
+    OCI_MemoryBlock *block
+);
+
+/* memory routines used for all allocations, installed with OcilibMemorySetHandlers() */
+
+static POCI_MEM_ALLOC   MemoryAlloc   = malloc;
+static POCI_MEM_REALLOC MemoryRealloc = realloc;
+static POCI_MEM_FREE    MemoryFree    = free;
 
 /* --------------------------------------------------------------------------------------------- *
  * OcilibMemoryUpdateBytes
@@ -50,16 +93,80 @@ static void OcilibMemoryUpdateBytes
     big_int size
 )
 {
+    if (!LIB_MEMORY_STATS)
+    {
+        return;
+    }
+
     if (OCI_IPC_ORACLE == type)
     {
-        MUTEXED_CALL(Env.mem_bytes_oci += size)
+        COUNTER_ADD_BIG(Env.mem_bytes_oci, size)
     }
     else
     {
-        MUTEXED_CALL(Env.mem_bytes_lib += size)
+        COUNTER_ADD_BIG(Env.mem_bytes_lib, size)
     }
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibMemoryUpdateProfile
+ * --------------------------------------------------------------------------------------------- */
+
+static void OcilibMemoryUpdateProfile
+(
+    int     type,
+    big_int size,
+    int     count
+)
+{
+    OCI_MemoryProfile *profile = NULL;
+
+    if (!LIB_MEMORY_PROFILING || type < OCI_IPC_ORACLE || type >= OCI_IPC_COUNT - 1)
+    {
+        return;
+    }
+
+    profile = &Env.mem_profile[type + 1];
+
+#ifdef OCI_ATOMIC_SUPPORTED
+
+    {
+        const big_uint bytes = ATOMIC_ADD_BIG(&profile->bytes, size) + (big_uint) size;
+
+        big_uint peak = ATOMIC_GET_BIG(&profile->peak);
+
+        ATOMIC_ADD_BIG(&profile->count, count);
+
+        while (bytes > peak && !ATOMIC_CAS_BIG(&profile->peak, peak, bytes))
+        {
+            peak = ATOMIC_GET_BIG(&profile->peak);
+        }
+    }
+
+#else
+
+    if (Env.mem_mutex)
+    {
+        OcilibMutexAcquire(Env.mem_mutex);
+    }
+
+    profile->bytes += size;
+    profile->count += count;
+
+    if (profile->bytes > profile->peak)
+    {
+        profile->peak = profile->bytes;
+    }
+
+    if (Env.mem_mutex)
+    {
+        OcilibMutexRelease(Env.mem_mutex);
+    }
+
+#endif
+
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OcilibMemoryAlloc
  * --------------------------------------------------------------------------------------------- */
@@ -78,9 +185,9 @@ void * OcilibMemoryAlloc
         /* context */ OCI_IPC_VOID, &Env
     )
 
-    const size_t size = sizeof(OCI_MemoryBlock) + (block_size * block_count);
+    const size_t size = MEMORY_BLOCK_HEADER_SIZE + (block_size * block_count);
 
-    OCI_MemoryBlock* block = (OCI_MemoryBlock *)malloc(size);
+    OCI_MemoryBlock* block = (OCI_MemoryBlock *)MemoryAlloc(size);
 
     if (NULL == block)
     {
@@ -92,12 +199,14 @@ void * OcilibMemoryAlloc
         memset(block, 0, size);
     }
 
-    block->type = ptr_type;
-    block->size = (unsigned int) size;
+    block->type  = ptr_type;
+    block->size  = (unsigned int) size;
+    block->arena = NULL;
 
     OcilibMemoryUpdateBytes(block->type, block->size);
+    OcilibMemoryUpdateProfile(block->type, block->size, 1);
 
-    SET_RETVAL(((unsigned char*)block) + sizeof(*block))
+    SET_RETVAL(MEMORY_BLOCK_DATA(block))
 
     EXIT_FUNC()
 }
@@ -123,13 +232,31 @@ void * OcilibMemoryRealloc
 
     if (ptr_mem != NULL)
     {
-        OCI_MemoryBlock* block = (OCI_MemoryBlock*)(((unsigned char*)ptr_mem) - sizeof(*block));
+        OCI_MemoryBlock* block = MEMORY_BLOCK_FROM_DATA(ptr_mem);
+
+        const size_t size = MEMORY_BLOCK_HEADER_SIZE + (block_size * block_count);
+
+        if (block->size < size && NULL != block->arena)
+        {
+            /* arena blocks cannot grow beyond their size class, move data to a heap block */
+
+            void *ptr_new = OcilibMemoryAlloc(ptr_type, block_size, block_count, zero_fill);
+
+            if (NULL == ptr_new)
+            {
+                OcilibMemoryFree(ptr_mem);
+                THROW(OcilibExceptionMemory, ptr_type, size);
+            }
+
+            memcpy(ptr_new, ptr_mem, block->size - MEMORY_BLOCK_HEADER_SIZE);
 
-        const size_t size = sizeof(OCI_MemoryBlock) + (block_size * block_count);
+            OcilibMemoryFree(ptr_mem);
 
-        if (block->size < size)
+            ptr_mem = ptr_new;
+        }
+        else if (block->size < size)
         {
-            void* ptr_new = realloc(block, size);
+            void* ptr_new = MemoryRealloc(block, size);
 
             if (NULL == ptr_new)
             {
@@ -141,6 +268,9 @@ void * OcilibMemoryRealloc
 
             const size_t size_diff = (big_int)size - block->size;
 
+            OcilibMemoryUpdateProfile(block->type, (big_int) 0 - block->size, -1);
+            OcilibMemoryUpdateProfile(ptr_type, (big_int) size, 1);
+
             block->type = ptr_type;
             block->size = (unsigned int)size;
 
@@ -150,9 +280,9 @@ void * OcilibMemoryRealloc
             }
 
             OcilibMemoryUpdateBytes(block->type, size_diff);
-        }
 
-        ptr_mem = ((unsigned char*)block) + sizeof(*block);
+            ptr_mem = MEMORY_BLOCK_DATA(block);
+        }
     }
     else
     {
@@ -175,15 +305,284 @@ void OcilibMemoryFree
 {
     if (ptr_mem)
     {
-        OCI_MemoryBlock *block = (OCI_MemoryBlock *)(((unsigned char*)ptr_mem) - sizeof(*block));
+        OCI_MemoryBlock *block = MEMORY_BLOCK_FROM_DATA(ptr_mem);
 
-        if (block)
+        if (NULL != block->arena)
+        {
+            OcilibMemoryArenaRelease(block->arena, block);
+        }
+        else
         {
+            OcilibMemoryUpdateProfile(block->type, (big_int) 0 - block->size, -1);
             OcilibMemoryUpdateBytes(block->type, (big_int) 0 - block->size);
 
-            free(block);
+            MemoryFree(block);
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibMemoryIsBlockOfType
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibMemoryIsBlockOfType
+(
+    void  * ptr_mem,
+    int     ptr_type,
+    size_t  block_size
+)
+{
+    if (NULL == ptr_mem)
+    {
+        return FALSE;
+    }
+
+    const OCI_MemoryBlock *block = MEMORY_BLOCK_FROM_DATA(ptr_mem);
+
+    return (ptr_type == block->type && block->size >= MEMORY_BLOCK_HEADER_SIZE + block_size);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibMemorySetHandlers
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibMemorySetHandlers
+(
+    POCI_MEM_ALLOC   alloc_func,
+    POCI_MEM_REALLOC realloc_func,
+    POCI_MEM_FREE    free_func
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    /* memory blocks must be released with the routines that allocated them */
+
+    if (Env.loaded)
+    {
+        THROW_NO_ARGS(OcilibExceptionAlreadyInitialized)
+    }
+
+    MemoryAlloc   = alloc_func   ? alloc_func   : malloc;
+    MemoryRealloc = realloc_func ? realloc_func : realloc;
+    MemoryFree    = free_func    ? free_func    : free;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibMemoryArenaCreate
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_MemoryArena * OcilibMemoryArenaCreate
+(
+    void
+)
+{
+    ENTER_FUNC_NO_CONTEXT
+    (
+        /* returns */ OCI_MemoryArena*, NULL
+    )
+
+    OCI_MemoryArena *arena = NULL;
+
+    ALLOC_DATA(OCI_IPC_MEMORY_ARENA, arena, 1)
+
+    if (LIB_THREADED)
+    {
+        arena->mutex = OcilibMutexCreateInternal();
+        CHECK_NULL(arena->mutex)
+    }
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (FAILURE)
+        {
+            OcilibMemoryArenaFree(arena);
+            arena = NULL;
+        }
+
+        SET_RETVAL(arena)
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibMemoryArenaFree
+ * --------------------------------------------------------------------------------------------- */
+
+void OcilibMemoryArenaFree
+(
+    OCI_MemoryArena *arena
+)
+{
+    if (NULL != arena)
+    {
+        void *slab = arena->slabs;
+
+        /* release all slabs at once, whatever the state of their blocks */
+
+        while (NULL != slab)
+        {
+            void *next = *(void **) slab;
+
+            OcilibMemoryFree(slab);
+
+            slab = next;
+        }
+
+        if (NULL != arena->mutex)
+        {
+            OcilibMutexFree(arena->mutex);
+        }
+
+        OcilibMemoryFree(arena);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibMemoryArenaAlloc
+ * --------------------------------------------------------------------------------------------- */
+
+void * OcilibMemoryArenaAlloc
+(
+    OCI_MemoryArena *arena,
+    int              ptr_type,
+    size_t           block_size,
+    size_t           block_count,
+    boolean          zero_fill
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ void*, NULL,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    const size_t size = MEMORY_BLOCK_HEADER_SIZE + (block_size * block_count);
+
+    OCI_MemoryBlock *block = NULL;
+
+    size_t class_size  = OCI_SIZE_ARENA_MIN;
+    int    class_index = 0;
+
+    /* no arena or block too large: fall back to the default allocator */
+
+    if (NULL == arena || size > OCI_SIZE_ARENA_MAX)
+    {
+        SET_RETVAL(OcilibMemoryAlloc(ptr_type, block_size, block_count, zero_fill))
+        JUMP_EXIT()
+    }
+
+    while (class_size < size)
+    {
+        class_size <<= 1;
+        class_index++;
+    }
+
+    if (NULL != arena->mutex)
+    {
+        OcilibMutexAcquire(arena->mutex);
+    }
+
+    block = arena->free_blocks[class_index];
+
+    if (NULL != block)
+    {
+        /* free blocks are chained through their first data bytes */
+
+        arena->free_blocks[class_index] = *(OCI_MemoryBlock **) MEMORY_BLOCK_DATA(block);
+    }
+    else
+    {
+        if (arena->cursor + class_size > arena->limit)
+        {
+            unsigned char *slab = (unsigned char *) OcilibMemoryAlloc(OCI_IPC_MEMORY_ARENA,
+                                                                     OCI_SIZE_ARENA_SLAB,
+                                                                     (size_t) 1, FALSE);
+
+            if (NULL != slab)
+            {
+                /* slabs are chained through their first bytes */
+
+                *(void **) slab = arena->slabs;
+                arena->slabs    = slab;
+
+                arena->cursor = slab + MEMORY_BLOCK_HEADER_SIZE;
+                arena->limit  = slab + OCI_SIZE_ARENA_SLAB;
+            }
+        }
+
+        if (arena->cursor + class_size <= arena->limit)
+        {
+            block = (OCI_MemoryBlock *) arena->cursor;
+
+            arena->cursor += class_size;
         }
     }
+
+    if (NULL != arena->mutex)
+    {
+        OcilibMutexRelease(arena->mutex);
+    }
+
+    if (NULL == block)
+    {
+        THROW(OcilibExceptionMemory, ptr_type, size)
+    }
+
+    if (zero_fill)
+    {
+        memset(block, 0, class_size);
+    }
+
+    block->type  = ptr_type;
+    block->size  = (unsigned int) class_size;
+    block->arena = arena;
+
+    /* arena blocks are not profiled as their slab is already profiled as a whole */
+
+    SET_RETVAL(MEMORY_BLOCK_DATA(block))
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibMemoryArenaRelease
+ * --------------------------------------------------------------------------------------------- */
+
+static void OcilibMemoryArenaRelease
+(
+    OCI_MemoryArena *arena,
+    OCI_MemoryBlock *block
+)
+{
+    size_t class_size  = OCI_SIZE_ARENA_MIN;
+    int    class_index = 0;
+
+    while (class_size < block->size)
+    {
+        class_size <<= 1;
+        class_index++;
+    }
+
+    if (NULL != arena->mutex)
+    {
+        OcilibMutexAcquire(arena->mutex);
+    }
+
+    *(OCI_MemoryBlock **) MEMORY_BLOCK_DATA(block) = arena->free_blocks[class_index];
+
+    arena->free_blocks[class_index] = block;
+
+    if (NULL != arena->mutex)
+    {
+        OcilibMutexRelease(arena->mutex);
+    }
 }
 
 /* --------------------------------------------------------------------------------------------- *
@@ -208,7 +607,7 @@ boolean OcilibMemoryAllocHandle
 
     if (OCI_SUCCESSFUL(ret))
     {
-        MUTEXED_CALL(Env.nb_hndlp++)
+        COUNTER_ADD_INT(Env.nb_hndlp, 1)
         SET_SUCCESS()
     }
 
@@ -235,7 +634,7 @@ boolean OcilibMemoryFreeHandle
 
     if (OCI_SUCCESSFUL(ret))
     {
-        MUTEXED_CALL(Env.nb_hndlp--)
+        COUNTER_ADD_INT(Env.nb_hndlp, -1)
         SET_SUCCESS()
     }
 
@@ -264,13 +663,178 @@ boolean OcilibMemoryAllocDescriptor
 
     if (OCI_SUCCESSFUL(ret))
     {
-        MUTEXED_CALL(Env.nb_descp++)
+        COUNTER_ADD_INT(Env.nb_descp, 1)
         SET_SUCCESS()
     }
 
     EXIT_FUNC()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibMemoryReleaseDescriptorArray
+ * --------------------------------------------------------------------------------------------- */
+
+static sword OcilibMemoryReleaseDescriptorArray
+(
+    dvoid **descp,
+    ub4     type,
+    ub4     nb_elem
+)
+{
+    sword ret = OCI_SUCCESS;
+
+#if OCI_VERSION_COMPILE >= OCI_11_1
+
+    if (Env.version_runtime >= OCI_11_1)
+    {
+        ret = OCIArrayDescriptorFree(descp, type);
+    }
+    else
+
+#endif
+
+    {
+        for (ub4 i = 0; (i < nb_elem) && (OCI_SUCCESS == ret); i++)
+        {
+            ret = OCIDescriptorFree(descp[i], type);
+        }
+    }
+
+    if (OCI_SUCCESSFUL(ret))
+    {
+        COUNTER_ADD_INT(Env.nb_descp, 0 - nb_elem)
+    }
+
+    return ret;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibMemoryDescriptorPoolGet
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean OcilibMemoryDescriptorPoolGet
+(
+    CONST dvoid *parenth,
+    dvoid      **descpp,
+    ub4          type,
+    ub4          nb_elem
+)
+{
+    OCI_DescriptorPool    *pool  = &Env.desc_pool;
+    OCI_PooledDescriptors *prev  = NULL;
+    OCI_PooledDescriptors *entry = NULL;
+
+    if (NULL != pool->mutex)
+    {
+        OcilibMutexAcquire(pool->mutex);
+    }
+
+    for (entry = pool->head; NULL != entry; prev = entry, entry = entry->next)
+    {
+        if (entry->parenth == parenth && entry->type == type && entry->nb_elem == nb_elem)
+        {
+            if (NULL != prev)
+            {
+                prev->next = entry->next;
+            }
+            else
+            {
+                pool->head = entry->next;
+            }
+
+            pool->count--;
+            break;
+        }
+    }
+
+    if (NULL != entry)
+    {
+        pool->hits++;
+    }
+    else
+    {
+        pool->misses++;
+    }
+
+    if (NULL != pool->mutex)
+    {
+        OcilibMutexRelease(pool->mutex);
+    }
+
+    if (NULL == entry)
+    {
+        return FALSE;
+    }
+
+    memcpy(descpp, entry->descs, nb_elem * sizeof(dvoid *));
+
+    OcilibMemoryFree(entry);
+
+    return TRUE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibMemoryDescriptorPoolPut
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean OcilibMemoryDescriptorPoolPut
+(
+    CONST dvoid *parenth,
+    dvoid      **descp,
+    ub4          type,
+    ub4          nb_elem
+)
+{
+    OCI_DescriptorPool    *pool   = &Env.desc_pool;
+    OCI_PooledDescriptors *entry  = NULL;
+    boolean                pooled = FALSE;
+
+    if (pool->count >= OCI_DESCRIPTOR_POOL_MAX)
+    {
+        return FALSE;
+    }
+
+    entry = (OCI_PooledDescriptors *) OcilibMemoryAlloc(OCI_IPC_DESCRIPTOR_POOL, sizeof(*entry) +
+                                                        nb_elem * sizeof(dvoid *), (size_t) 1, FALSE);
+
+    if (NULL == entry)
+    {
+        return FALSE;
+    }
+
+    entry->parenth = parenth;
+    entry->descs   = (dvoid **) (entry + 1);
+    entry->type    = type;
+    entry->nb_elem = nb_elem;
+
+    memcpy(entry->descs, descp, nb_elem * sizeof(dvoid *));
+
+    if (NULL != pool->mutex)
+    {
+        OcilibMutexAcquire(pool->mutex);
+    }
+
+    if (pool->count < OCI_DESCRIPTOR_POOL_MAX)
+    {
+        entry->next = pool->head;
+        pool->head  = entry;
+        pool->count++;
+        pooled = TRUE;
+    }
+
+    if (NULL != pool->mutex)
+    {
+        OcilibMutexRelease(pool->mutex);
+    }
+
+    if (!pooled)
+    {
+        OcilibMemoryFree(entry);
+    }
+
+    return pooled;
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OcilibMemoryAllocDescriptorArray
  * --------------------------------------------------------------------------------------------- */
@@ -292,6 +856,12 @@ boolean OcilibMemoryAllocDescriptorArray
 
     sword ret = OCI_SUCCESS;
 
+    if (IS_POOLED_DESCRIPTOR_TYPE(type) && OcilibMemoryDescriptorPoolGet(parenth, descpp, type, nb_elem))
+    {
+        SET_SUCCESS()
+        JUMP_EXIT()
+    }
+
 #if OCI_VERSION_COMPILE >= OCI_11_1
 
     if (Env.version_runtime >= OCI_11_1)
@@ -312,7 +882,7 @@ boolean OcilibMemoryAllocDescriptorArray
 
     if (OCI_SUCCESSFUL(ret))
     {
-        MUTEXED_CALL(Env.nb_descp += nb_elem)
+        COUNTER_ADD_INT(Env.nb_descp, nb_elem)
         SET_SUCCESS()
     }
 
@@ -340,7 +910,7 @@ boolean OcilibMemoryFreeDescriptor
 
     if (OCI_SUCCESSFUL(ret))
     {
-        MUTEXED_CALL(Env.nb_descp--)
+        COUNTER_ADD_INT(Env.nb_descp, -1)
         SET_SUCCESS()
     }
 
@@ -348,14 +918,15 @@ boolean OcilibMemoryFreeDescriptor
 }
 
 /* --------------------------------------------------------------------------------------------- *
- * OcilibMemoryFreeDescriptor
+ * OcilibMemoryFreeDescriptorArray
  * --------------------------------------------------------------------------------------------- */
 
 boolean OcilibMemoryFreeDescriptorArray
 (
-    dvoid **descp,
-    ub4     type,
-    ub4     nb_elem
+    CONST dvoid *parenth,
+    dvoid      **descp,
+    ub4          type,
+    ub4          nb_elem
 )
 {
     ENTER_FUNC_NO_CONTEXT
@@ -365,36 +936,53 @@ boolean OcilibMemoryFreeDescriptorArray
 
     CHECK_NULL(descp)
 
-    sword ret = OCI_SUCCESS;
+    if (IS_POOLED_DESCRIPTOR_TYPE(type) && OcilibMemoryDescriptorPoolPut(parenth, descp, type, nb_elem))
+    {
+        SET_SUCCESS()
+        JUMP_EXIT()
+    }
 
-    if (descp)
+    if (OCI_SUCCESSFUL(OcilibMemoryReleaseDescriptorArray(descp, type, nb_elem)))
     {
+        SET_SUCCESS()
+    }
 
-#if OCI_VERSION_COMPILE >= OCI_11_1
+    EXIT_FUNC()
+}
 
-        if (Env.version_runtime >= OCI_11_1)
-        {
-            ret = OCIArrayDescriptorFree(descp, type);
-        }
-        else
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibMemoryDescriptorPoolRelease
+ * --------------------------------------------------------------------------------------------- */
 
-#endif
+void OcilibMemoryDescriptorPoolRelease
+(
+    void
+)
+{
+    OCI_DescriptorPool    *pool  = &Env.desc_pool;
+    OCI_PooledDescriptors *entry = pool->head;
+    OCI_Mutex             *mutex = pool->mutex;
 
-        {
-            for (ub4 i = 0; (i < nb_elem) && (OCI_SUCCESS == ret); i++)
-            {
-                ret = OCIDescriptorFree(descp[i], type);
-            }
-        }
-    }
+    /* the pool is detached first so that the descriptors freed below are not pooled again */
 
-    if (OCI_SUCCESSFUL(ret))
+    pool->head  = NULL;
+    pool->mutex = NULL;
+    pool->count = 0;
+
+    while (NULL != entry)
     {
-        MUTEXED_CALL(Env.nb_descp -= nb_elem)
-        SET_SUCCESS()
+        OCI_PooledDescriptors *next = entry->next;
+
+        OcilibMemoryReleaseDescriptorArray(entry->descs, entry->type, entry->nb_elem);
+        OcilibMemoryFree(entry);
+
+        entry = next;
     }
 
-    EXIT_FUNC()
+    if (NULL != mutex)
+    {
+        OcilibMutexFree(mutex);
+    }
 }
 
 /* --------------------------------------------------------------------------------------------- *
@@ -430,7 +1018,7 @@ boolean OcilibMemoryAllocateObject
 
     SET_SUCCESS()
 
-    MUTEXED_CALL(Env.nb_objinst++)
+    COUNTER_ADD_INT(Env.nb_objinst, 1)
 
     EXIT_FUNC()
 }
@@ -464,7 +1052,7 @@ boolean OcilibMemoryFreeObject
 
     SET_SUCCESS()
 
-    MUTEXED_CALL(Env.nb_objinst--)
+    COUNTER_ADD_INT(Env.nb_objinst, -1)
 
     EXIT_FUNC()
 }
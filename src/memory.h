@@ -45,6 +45,39 @@ OCI_SYM_LOCAL void OcilibMemoryFree
     void * ptr_mem
 );
 
+OCI_SYM_LOCAL boolean OcilibMemoryIsBlockOfType
+(
+    void  * ptr_mem,
+    int     ptr_type,
+    size_t  block_size
+);
+
+OCI_SYM_LOCAL boolean OcilibMemorySetHandlers
+(
+    POCI_MEM_ALLOC   alloc_func,
+    POCI_MEM_REALLOC realloc_func,
+    POCI_MEM_FREE    free_func
+);
+
+OCI_SYM_LOCAL OCI_MemoryArena * OcilibMemoryArenaCreate
+(
+    void
+);
+
+OCI_SYM_LOCAL void OcilibMemoryArenaFree
+(
+    OCI_MemoryArena *arena
+);
+
+OCI_SYM_LOCAL void * OcilibMemoryArenaAlloc
+(
+    OCI_MemoryArena *arena,
+    int              ptr_type,
+    size_t           block_size,
+    size_t           block_count,
+    boolean          zero_fill
+);
+
 OCI_SYM_LOCAL boolean OcilibMemoryAllocHandle
 (
     CONST dvoid *parenth,
@@ -81,9 +114,15 @@ OCI_SYM_LOCAL boolean OcilibMemoryFreeDescriptor
 
 OCI_SYM_LOCAL boolean OcilibMemoryFreeDescriptorArray
 (
-    dvoid **descp,
-    ub4     type,
-    ub4     nb_elem
+    CONST dvoid *parenth,
+    dvoid      **descp,
+    ub4          type,
+    ub4          nb_elem
+);
+
+OCI_SYM_LOCAL void OcilibMemoryDescriptorPoolRelease
+(
+    void
 );
 
 OCI_SYM_LOCAL sword OcilibMemoryAllocateObject
@@ -23,6 +23,24 @@
 #include "macros.h"
 #include "memory.h"
 
+#if defined(_WINDOWS)
+  #include <Windows.h>
+#else
+  #include <pthread.h>
+#endif
+
+struct OCI_Condition
+{
+#if defined(_WINDOWS)
+    CRITICAL_SECTION   lock;   /* native lock */
+    CONDITION_VARIABLE var;    /* native condition variable */
+#else
+    pthread_mutex_t    lock;   /* native lock */
+    pthread_cond_t     var;    /* native condition variable */
+#endif
+    boolean            init;   /* native objects initialized */
+};
+
 /* --------------------------------------------------------------------------------------------- *
   * OcilibMutexCreateInternal
   * --------------------------------------------------------------------------------------------- */
@@ -196,3 +214,224 @@ boolean OcilibMutexRelease
 
     EXIT_FUNC()
 }
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibConditionCreate
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_Condition * OcilibConditionCreate
+(
+    void
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ OCI_Condition*, NULL,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    OCI_Condition *cond = NULL;
+
+    CHECK_THREAD_ENABLED()
+
+    ALLOC_DATA(OCI_IPC_MUTEX, cond, 1)
+
+#if defined(_WINDOWS)
+
+    InitializeCriticalSection(&cond->lock);
+    InitializeConditionVariable(&cond->var);
+
+#else
+
+    CHECK(0 == pthread_mutex_init(&cond->lock, NULL))
+
+    if (0 != pthread_cond_init(&cond->var, NULL))
+    {
+        pthread_mutex_destroy(&cond->lock);
+
+        CHECK(FALSE)
+    }
+
+#endif
+
+    cond->init = TRUE;
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (FAILURE)
+        {
+            OcilibConditionFree(cond);
+            cond = NULL;
+        }
+
+        SET_RETVAL(cond)
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibConditionFree
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibConditionFree
+(
+    OCI_Condition *cond
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    CHECK_PTR(OCI_IPC_MUTEX, cond)
+
+    if (cond->init)
+    {
+    #if defined(_WINDOWS)
+
+        DeleteCriticalSection(&cond->lock);
+
+    #else
+
+        pthread_cond_destroy(&cond->var);
+        pthread_mutex_destroy(&cond->lock);
+
+    #endif
+    }
+
+    FREE(cond)
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibConditionAcquire
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibConditionAcquire
+(
+    OCI_Condition *cond
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    CHECK_PTR(OCI_IPC_MUTEX, cond)
+
+#if defined(_WINDOWS)
+
+    EnterCriticalSection(&cond->lock);
+
+#else
+
+    CHECK(0 == pthread_mutex_lock(&cond->lock))
+
+#endif
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibConditionRelease
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibConditionRelease
+(
+    OCI_Condition *cond
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    CHECK_PTR(OCI_IPC_MUTEX, cond)
+
+#if defined(_WINDOWS)
+
+    LeaveCriticalSection(&cond->lock);
+
+#else
+
+    CHECK(0 == pthread_mutex_unlock(&cond->lock))
+
+#endif
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibConditionWait
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibConditionWait
+(
+    OCI_Condition *cond
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    CHECK_PTR(OCI_IPC_MUTEX, cond)
+
+    /* the lock must be held by the caller, it is released while waiting */
+
+#if defined(_WINDOWS)
+
+    CHECK(SleepConditionVariableCS(&cond->var, &cond->lock, INFINITE))
+
+#else
+
+    CHECK(0 == pthread_cond_wait(&cond->var, &cond->lock))
+
+#endif
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibConditionBroadcast
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibConditionBroadcast
+(
+    OCI_Condition *cond
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    CHECK_PTR(OCI_IPC_MUTEX, cond)
+
+#if defined(_WINDOWS)
+
+    WakeAllConditionVariable(&cond->var);
+
+#else
+
+    CHECK(0 == pthread_cond_broadcast(&cond->var))
+
+#endif
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
@@ -48,4 +48,34 @@ OCI_SYM_LOCAL boolean OcilibMutexRelease
     OCI_Mutex *mutex
 );
 
+OCI_SYM_LOCAL OCI_Condition * OcilibConditionCreate
+(
+    void
+);
+
+OCI_SYM_LOCAL boolean OcilibConditionFree
+(
+    OCI_Condition *cond
+);
+
+OCI_SYM_LOCAL boolean OcilibConditionAcquire
+(
+    OCI_Condition *cond
+);
+
+OCI_SYM_LOCAL boolean OcilibConditionRelease
+(
+    OCI_Condition *cond
+);
+
+OCI_SYM_LOCAL boolean OcilibConditionWait
+(
+    OCI_Condition *cond
+);
+
+OCI_SYM_LOCAL boolean OcilibConditionBroadcast
+(
+    OCI_Condition *cond
+);
+
 #endif /* OCILIB_MUTEX_H_INCLUDED */
@@ -22,6 +22,7 @@
 
 #include "agent.h"
 #include "array.h"
+#include "arrow.h"
 #include "bind.h"
 #include "collection.h"
 #include "column.h"
@@ -42,6 +43,7 @@
 #include "environment.h"
 #include "lob.h"
 #include "long.h"
+#include "memory.h"
 #include "message.h"
 #include "mutex.h"
 #include "number.h"
@@ -224,6 +226,26 @@ unsigned int OCI_API OCI_BindGetDataSizeAtPos
     CALL_IMPL(OcilibBindGetDataSizeAtPos, bnd, position)
 }
 
+boolean OCI_API OCI_BindSetDataSizes
+(
+    OCI_Bind          * bnd,
+    const unsigned int* sizes,
+    unsigned int        count
+)
+{
+    CALL_IMPL(OcilibBindSetDataSizes, bnd, sizes, count)
+}
+
+boolean OCI_API OCI_BindGetDataSizes
+(
+    OCI_Bind    * bnd,
+    unsigned int* sizes,
+    unsigned int  count
+)
+{
+    CALL_IMPL(OcilibBindGetDataSizes, bnd, sizes, count)
+}
+
 boolean OCI_API OCI_BindSetNullAtPos
 (
     OCI_Bind   * bnd,
@@ -309,6 +331,32 @@ unsigned int OCI_API OCI_BindGetAllocationMode
     CALL_IMPL(OcilibBindGetAllocationMode, bnd)
 }
 
+unsigned int OCI_API OCI_BindGetBigIntMode
+(
+    OCI_Bind* bnd
+)
+{
+    CALL_IMPL(OcilibBindGetBigIntMode, bnd)
+}
+
+boolean OCI_API OCI_BindSetIndicatorArray
+(
+    OCI_Bind* bnd,
+    short   * inds
+)
+{
+    CALL_IMPL(OcilibBindSetIndicatorArray, bnd, inds)
+}
+
+boolean OCI_API OCI_BindSetLengthArray
+(
+    OCI_Bind      * bnd,
+    unsigned short* lens
+)
+{
+    CALL_IMPL(OcilibBindSetLengthArray, bnd, lens)
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * collection
  * --------------------------------------------------------------------------------------------- */
@@ -971,6 +1019,32 @@ boolean OCI_API OCI_SetStatementCacheSize
     CALL_IMPL(OcilibConnectionSetStatementCacheSize, con, value)
 }
 
+unsigned int OCI_API OCI_GetPreparedCacheSize
+(
+    OCI_Connection *con
+)
+{
+    CALL_IMPL(OcilibConnectionGetPreparedCacheSize, con)
+}
+
+boolean OCI_API OCI_SetPreparedCacheSize
+(
+    OCI_Connection *con,
+    unsigned int    value
+)
+{
+    CALL_IMPL(OcilibConnectionSetPreparedCacheSize, con, value)
+}
+
+big_uint OCI_API OCI_GetPreparedCacheValue
+(
+    OCI_Connection *con,
+    unsigned int    value
+)
+{
+    CALL_IMPL(OcilibConnectionGetPreparedCacheValue, con, value)
+}
+
 unsigned int OCI_API OCI_GetDefaultLobPrefetchSize
 (
     OCI_Connection *con
@@ -2965,6 +3039,16 @@ boolean OCI_API OCI_Initialize
     CALL_IMPL(OcilibEnvironmentInitialize, err_handler, lib_path, mode)
 }
 
+boolean OCI_API OCI_SetMemoryHandlers
+(
+    POCI_MEM_ALLOC   alloc_func,
+    POCI_MEM_REALLOC realloc_func,
+    POCI_MEM_FREE    free_func
+)
+{
+    CALL_IMPL(OcilibMemorySetHandlers, alloc_func, realloc_func, free_func)
+}
+
 boolean OCI_API OCI_Cleanup
 (
     void
@@ -3013,6 +3097,64 @@ big_uint OCI_API OCI_GetAllocatedBytes
     CALL_IMPL(OcilibEnvironmentGetAllocatedBytes, mem_type)
 }
 
+unsigned int OCI_API OCI_GetMemoryProfileSize
+(
+    void
+)
+{
+    CALL_IMPL_NO_ARGS(OcilibEnvironmentGetMemoryProfileSize)
+}
+
+const otext * OCI_API OCI_GetMemoryProfileName
+(
+    unsigned int index
+)
+{
+    CALL_IMPL(OcilibEnvironmentGetMemoryProfileName, index)
+}
+
+big_uint OCI_API OCI_GetMemoryProfileValue
+(
+    unsigned int index,
+    unsigned int value
+)
+{
+    CALL_IMPL(OcilibEnvironmentGetMemoryProfileValue, index, value)
+}
+
+big_uint OCI_API OCI_GetDescriptorPoolValue
+(
+    unsigned int value
+)
+{
+    CALL_IMPL(OcilibEnvironmentGetDescriptorPoolValue, value)
+}
+
+unsigned int OCI_API OCI_GetSqlStatsSize
+(
+    void
+)
+{
+    CALL_IMPL_NO_ARGS(OcilibEnvironmentGetSqlStatsSize)
+}
+
+const otext * OCI_API OCI_GetSqlStatsName
+(
+    unsigned int index
+)
+{
+    CALL_IMPL(OcilibEnvironmentGetSqlStatsName, index)
+}
+
+big_uint OCI_API OCI_GetSqlStatsValue
+(
+    unsigned int index,
+    unsigned int value
+)
+{
+    CALL_IMPL(OcilibEnvironmentGetSqlStatsValue, index, value)
+}
+
 OCI_Error* OCI_API OCI_GetLastError
 (
     void
@@ -4504,6 +4646,21 @@ boolean OCI_API OCI_PoolSetStatementCacheSize
     CALL_IMPL(OcilibPoolSetStatementCacheSize, pool, value);
 }
 
+boolean OCI_API OCI_ParallelQuery
+(
+    OCI_Pool            *pool,
+    const otext         *sql,
+    unsigned int         mode,
+    unsigned int         nb_partitions,
+    const otext * const *args,
+    unsigned int         fetch_size,
+    POCI_PARALLEL_FETCH  handler,
+    void                *ctx
+)
+{
+    CALL_IMPL(OcilibPoolParallelQuery, pool, sql, mode, nb_partitions, args, fetch_size, handler, ctx);
+}
+
 /* --------------------------------------------------------------------------------------------- *
  *  queue
  * --------------------------------------------------------------------------------------------- */
@@ -4877,6 +5034,56 @@ boolean OCI_API OCI_FetchNext
     CALL_IMPL(OcilibResultsetFetchNext, rs);
 }
 
+boolean OCI_API OCI_FetchNextAsync
+(
+    OCI_Resultset    * rs,
+    POCI_ASYNC_HANDLER handler,
+    void             * ctx
+)
+{
+    CALL_IMPL(OcilibResultsetFetchNextAsync, rs, handler, ctx);
+}
+
+boolean OCI_API OCI_FetchBlock
+(
+    OCI_Resultset* rs,
+    unsigned int * nrows
+)
+{
+    CALL_IMPL(OcilibResultsetFetchBlock, rs, nrows);
+}
+
+unsigned int OCI_API OCI_GetBlockRowCount
+(
+    OCI_Resultset* rs
+)
+{
+    CALL_IMPL(OcilibResultsetGetBlockRowCount, rs);
+}
+
+boolean OCI_API OCI_GetColumnBlock
+(
+    OCI_Resultset         * rs,
+    unsigned int            index,
+    const void           ** data,
+    unsigned int          * size,
+    const short          ** inds,
+    const unsigned short ** lens
+)
+{
+    CALL_IMPL(OcilibResultsetGetColumnBlock, rs, index, data, size, inds, lens);
+}
+
+boolean OCI_API OCI_ResultsetToArrow
+(
+    OCI_Resultset      * rs,
+    struct ArrowSchema * schema,
+    struct ArrowArray  * array
+)
+{
+    CALL_IMPL(OcilibArrowExportResultset, rs, schema, array);
+}
+
 boolean OCI_API OCI_FetchFirst
 (
     OCI_Resultset* rs
@@ -5509,6 +5716,53 @@ boolean OCI_API OCI_ExecuteStmt
     CALL_IMPL(OcilibStatementExecuteStmt, stmt, sql);
 }
 
+boolean OCI_API OCI_ExecuteAsync
+(
+    OCI_Statement    * stmt,
+    POCI_ASYNC_HANDLER handler,
+    void             * ctx
+)
+{
+    CALL_IMPL(OcilibStatementExecuteAsync, stmt, handler, ctx);
+}
+
+unsigned int OCI_API OCI_GetAsyncStatus
+(
+    OCI_Statement* stmt
+)
+{
+    CALL_IMPL(OcilibStatementGetAsyncStatus, stmt);
+}
+
+boolean OCI_API OCI_WaitAsync
+(
+    OCI_Statement* stmt
+)
+{
+    CALL_IMPL(OcilibStatementWaitAsync, stmt);
+}
+
+boolean OCI_API OCI_ExecuteBatch
+(
+    OCI_Connection *con,
+    OCI_Statement **stmts,
+    unsigned int    count,
+    unsigned int   *rows
+)
+{
+    CALL_IMPL(OcilibStatementExecuteBatch, con, stmts, count, rows);
+}
+
+boolean OCI_API OCI_ExecuteArrayStream
+(
+    OCI_Statement  *stmt,
+    POCI_ARRAY_FILL fill,
+    void           *ctx
+)
+{
+    CALL_IMPL(OcilibStatementExecuteArrayStream, stmt, fill, ctx);
+}
+
 boolean OCI_API OCI_Parse
 (
     OCI_Statement* stmt,
@@ -5595,6 +5849,23 @@ boolean OCI_DescribeFmt
     return res;
 }
 
+boolean OCI_API OCI_SetFormatParameterMode
+(
+    OCI_Statement* stmt,
+    unsigned int   mode
+)
+{
+    CALL_IMPL(OcilibStatementSetFormatParameterMode, stmt, mode);
+}
+
+unsigned int OCI_API OCI_GetFormatParameterMode
+(
+    OCI_Statement* stmt
+)
+{
+    CALL_IMPL(OcilibStatementGetFormatParameterMode, stmt);
+}
+
 boolean OCI_API OCI_BindArraySetSize
 (
     OCI_Statement* stmt,
@@ -6329,6 +6600,23 @@ unsigned int OCI_API OCI_GetBindAllocation
     CALL_IMPL(OcilibStatementGetBindAllocation, stmt);
 }
 
+boolean OCI_API OCI_SetBindBigIntMode
+(
+    OCI_Statement* stmt,
+    unsigned int   mode
+)
+{
+    CALL_IMPL(OcilibStatementSetBindBigIntMode, stmt, mode);
+}
+
+unsigned int OCI_API OCI_GetBindBigIntMode
+(
+    OCI_Statement* stmt
+)
+{
+    CALL_IMPL(OcilibStatementGetBindBigIntMode, stmt);
+}
+
 boolean OCI_API OCI_SetFetchSize
 (
     OCI_Statement* stmt,
@@ -6380,6 +6668,40 @@ unsigned int OCI_API OCI_GetPrefetchMemory
     CALL_IMPL(OcilibStatementGetPrefetchMemory, stmt);
 }
 
+boolean OCI_API OCI_SetFetchMemory
+(
+    OCI_Statement* stmt,
+    unsigned int   size
+)
+{
+    CALL_IMPL(OcilibStatementSetFetchMemory, stmt, size);
+}
+
+unsigned int OCI_API OCI_GetFetchMemory
+(
+    OCI_Statement* stmt
+)
+{
+    CALL_IMPL(OcilibStatementGetFetchMemory, stmt);
+}
+
+boolean OCI_API OCI_SetReadAhead
+(
+    OCI_Statement* stmt,
+    boolean        value
+)
+{
+    CALL_IMPL(OcilibStatementSetReadAhead, stmt, value);
+}
+
+boolean OCI_API OCI_GetReadAhead
+(
+    OCI_Statement* stmt
+)
+{
+    CALL_IMPL(OcilibStatementGetReadAhead, stmt);
+}
+
 boolean OCI_API OCI_SetPieceSize
 (
     OCI_Statement* stmt,
@@ -6521,6 +6843,15 @@ unsigned int OCI_API OCI_GetBatchErrorCount
     CALL_IMPL(OcilibStatementGetBatchErrorCount, stmt);
 }
 
+big_uint OCI_API OCI_GetStatementStats
+(
+    OCI_Statement* stmt,
+    unsigned int   value
+)
+{
+    CALL_IMPL(OcilibStatementGetStats, stmt, value);
+}
+
 /* --------------------------------------------------------------------------------------------- *
  *  subscription
  * --------------------------------------------------------------------------------------------- */
@@ -7006,6 +7337,14 @@ boolean OCI_API OCI_TypeInfoFree
     CALL_IMPL(OcilibTypeInfoFree, typinf);
 }
 
+boolean OCI_API OCI_TypeInfoInvalidate
+(
+    const otext* name
+)
+{
+    CALL_IMPL(OcilibTypeInfoInvalidate, name);
+}
+
 unsigned int OCI_API OCI_TypeInfoGetColumnCount
 (
     OCI_TypeInfo* typinf
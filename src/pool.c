@@ -23,13 +23,22 @@
 #include "connection.h"
 #include "list.h"
 #include "macros.h"
+#include "mutex.h"
+#include "resultset.h"
+#include "statement.h"
 #include "stringutils.h"
+#include "thread.h"
 
 static unsigned int PoolTypeValues[] =
 {
     OCI_POOL_CONNECTION, OCI_POOL_SESSION
 };
 
+static unsigned int ParallelQueryModeValues[] =
+{
+    OCI_PQM_ROWID, OCI_PQM_HASH, OCI_PQM_RANGE
+};
+
 /* --------------------------------------------------------------------------------------------- *
  * OcilibPoolDispose
  * --------------------------------------------------------------------------------------------- */
@@ -908,3 +917,452 @@ unsigned int OcilibPoolGetStatementCacheSize
 
     EXIT_FUNC()
 }
+
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibPoolParallelQueryFetchRanges
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean OcilibPoolParallelQueryFetchRanges
+(
+    OCI_PartitionedQuery *query,
+    OCI_Connection       *con,
+    const otext          *sql,
+    const otext          *table,
+    unsigned int         *count
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    OCI_Statement *stmt = NULL;
+    OCI_Resultset *rs   = NULL;
+    unsigned int   n    = query->nb_parts;
+
+    CHECK_PTR(OCI_IPC_STRING, sql)
+    CHECK_PTR(OCI_IPC_VOID,   count)
+
+    *count = 0;
+
+    stmt = OcilibStatementCreate(con);
+    CHECK_NULL(stmt)
+
+    CHECK(OcilibStatementPrepare(stmt, sql))
+    CHECK(OcilibStatementBindUnsignedInt(stmt, OTEXT(":n"), &n))
+
+    if (NULL != table)
+    {
+        CHECK(OcilibStatementBindString(stmt, OTEXT(":t"), (otext *) table, 0))
+    }
+
+    CHECK(OcilibStatementExecute(stmt))
+
+    rs = OcilibStatementGetResultset(stmt);
+    CHECK_NULL(rs)
+
+    while (*count < query->nb_parts && OcilibResultsetFetchNext(rs))
+    {
+        query->bounds[*count * 2]     = OcilibStringDuplicate(OcilibResultsetGetString(rs, 1));
+        query->bounds[*count * 2 + 1] = OcilibStringDuplicate(OcilibResultsetGetString(rs, 2));
+
+        CHECK_NULL(query->bounds[*count * 2])
+        CHECK_NULL(query->bounds[*count * 2 + 1])
+
+        (*count)++;
+    }
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (NULL != stmt)
+        {
+            OcilibStatementFree(stmt);
+        }
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibPoolParallelQueryRowidRanges
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean OcilibPoolParallelQueryRowidRanges
+(
+    OCI_PartitionedQuery *query,
+    OCI_Connection       *con,
+    const otext          *table
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    /* the table extents, ordered as their rowids, are split in ranges holding the same
+       number of blocks. They are read from the data dictionary without scanning the table */
+
+    const otext *extents = OTEXT("select rowidtochar(min(lo)), rowidtochar(max(hi)) from ")
+                           OTEXT("(select dbms_rowid.rowid_create(1, o.data_object_id, e.relative_fno, ")
+                           OTEXT("e.block_id, 0) lo, ")
+                           OTEXT("dbms_rowid.rowid_create(1, o.data_object_id, e.relative_fno, ")
+                           OTEXT("e.block_id + e.blocks - 1, 32767) hi, ")
+                           OTEXT("trunc((sum(e.blocks) over (order by o.data_object_id, e.relative_fno, ")
+                           OTEXT("e.block_id) - e.blocks) * :n / sum(e.blocks) over ()) grp ")
+                           OTEXT("from user_extents e, user_objects o ")
+                           OTEXT("where e.segment_name = upper(:t) and e.segment_type like 'TABLE%' ")
+                           OTEXT("and o.object_name = e.segment_name and o.object_type like 'TABLE%' ")
+                           OTEXT("and nvl(o.subobject_name, ' ') = nvl(e.partition_name, ' ')) ")
+                           OTEXT("group by grp order by grp");
+
+    /* otherwise rows are split in ranges of contiguous rowids holding the same number of rows */
+
+    const otext *head = OTEXT("select rowidtochar(min(rid)), rowidtochar(max(rid)) from ")
+                        OTEXT("(select rowid rid, ntile(:n) over (order by rowid) grp from ");
+
+    const otext *tail = OTEXT(") group by grp");
+
+    otext        *sql   = NULL;
+    unsigned int  count = 0;
+
+    CHECK_PTR(OCI_IPC_STRING, table)
+
+    CHECK(OcilibPoolParallelQueryFetchRanges(query, con, extents, table, &count))
+
+    /* tables of other schemas or without allocated extents */
+
+    if (0 == count)
+    {
+        ALLOC_DATA(OCI_IPC_STRING, sql, ostrlen(head) + ostrlen(table) + ostrlen(tail) + 1)
+
+        ostrcpy(sql, head);
+        ostrcat(sql, table);
+        ostrcat(sql, tail);
+
+        CHECK(OcilibPoolParallelQueryFetchRanges(query, con, sql, NULL, &count))
+    }
+
+    /* small tables may produce less ranges than requested */
+
+    query->nb_parts = count;
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        FREE(sql)
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibPoolParallelQueryRun
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean OcilibPoolParallelQueryRun
+(
+    OCI_ParallelWorker *worker,
+    unsigned int        index
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_CONNECTION, worker->con
+    )
+
+    OCI_PartitionedQuery *query = worker->query;
+    OCI_Statement        *stmt  = NULL;
+    OCI_Resultset        *rs    = NULL;
+
+    CHECK_PTR(OCI_IPC_CONNECTION, worker->con)
+
+    unsigned int bucket     = index;
+    unsigned int max_bucket = query->nb_parts - 1;
+    boolean      next       = TRUE;
+
+    stmt = OcilibStatementCreate(worker->con);
+    CHECK_NULL(stmt)
+
+    if (query->fetch_size > 0)
+    {
+        CHECK(OcilibStatementSetFetchSize(stmt, query->fetch_size))
+    }
+
+    CHECK(OcilibStatementPrepare(stmt, query->sql))
+
+    if (OCI_PQM_HASH == query->mode)
+    {
+        CHECK(OcilibStatementBindUnsignedInt(stmt, OTEXT(":pq_bucket"), &bucket))
+        CHECK(OcilibStatementBindUnsignedInt(stmt, OTEXT(":pq_max_bucket"), &max_bucket))
+    }
+    else
+    {
+        CHECK(OcilibStatementBindString(stmt, OTEXT(":pq_low"),  query->bounds[index * 2],     0))
+        CHECK(OcilibStatementBindString(stmt, OTEXT(":pq_high"), query->bounds[index * 2 + 1], 0))
+    }
+
+    CHECK(OcilibStatementExecute(stmt))
+
+    rs = OcilibStatementGetResultset(stmt);
+    CHECK_NULL(rs)
+
+    /* rows are fetched concurrently by all workers while the consumer is called by one worker at a time */
+
+    while (next && OcilibResultsetFetchNext(rs))
+    {
+        OcilibMutexAcquire(query->mutex);
+
+        next = !query->stop && 0 == query->failed;
+
+        if (next)
+        {
+            next = query->handler(rs, index + 1, query->ctx);
+
+            query->stop = !next;
+        }
+
+        OcilibMutexRelease(query->mutex);
+    }
+
+    /* OcilibResultsetFetchNext() returns FALSE for both the end of the resultset and errors */
+
+    if (next)
+    {
+        CHECK(rs->eof)
+    }
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (NULL != stmt)
+        {
+            OcilibStatementFree(stmt);
+        }
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibPoolParallelQueryProc
+ * --------------------------------------------------------------------------------------------- */
+
+static void OcilibPoolParallelQueryProc
+(
+    OCI_Thread *thread,
+    void       *arg
+)
+{
+    OCI_ParallelWorker   *worker = (OCI_ParallelWorker *) arg;
+    OCI_PartitionedQuery *query  = worker->query;
+
+    OCI_NOT_USED(thread)
+
+    boolean run = TRUE;
+
+    while (run)
+    {
+        unsigned int index = 0;
+
+        /* pick the next partition */
+
+        OcilibMutexAcquire(query->mutex);
+
+        run = !query->stop && 0 == query->failed && query->next < query->nb_parts;
+
+        if (run)
+        {
+            index = query->next++;
+        }
+
+        OcilibMutexRelease(query->mutex);
+
+        if (run && !OcilibPoolParallelQueryRun(worker, index))
+        {
+            /* keep the error of the first failed partition to report it to the caller thread */
+
+            OCI_Error *err = OcilibErrorGet(FALSE, FALSE);
+
+            OcilibMutexAcquire(query->mutex);
+
+            if (0 == query->failed)
+            {
+                query->failed = index + 1;
+                query->error  = OcilibStringDuplicate((NULL != err && NULL != err->message) ? err->message : OTEXT(""));
+            }
+
+            OcilibMutexRelease(query->mutex);
+
+            run = FALSE;
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibPoolParallelQuery
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibPoolParallelQuery
+(
+    OCI_Pool            *pool,
+    const otext         *sql,
+    unsigned int         mode,
+    unsigned int         nb_parts,
+    const otext * const *args,
+    unsigned int         fetch_size,
+    POCI_PARALLEL_FETCH  handler,
+    void                *ctx
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_POOL, pool
+    )
+
+    OCI_PartitionedQuery query;
+    OCI_ParallelWorker  *workers    = NULL;
+    unsigned int         nb_workers = 0;
+    unsigned int         nb_bounds  = 0;
+
+    memset(&query, 0, sizeof(query));
+
+    CHECK_PTR(OCI_IPC_POOL,   pool)
+    CHECK_PTR(OCI_IPC_STRING, sql)
+    CHECK_PTR(OCI_IPC_PROC,   handler)
+    CHECK_ENUM_VALUE(mode, ParallelQueryModeValues, OTEXT("Parallel query mode"))
+    CHECK_MIN(nb_parts, 1)
+    CHECK_THREAD_ENABLED()
+
+    if (OCI_PQM_HASH != mode)
+    {
+        CHECK_PTR(OCI_IPC_STRING, args)
+    }
+
+    query.sql        = sql;
+    query.mode       = mode;
+    query.nb_parts   = nb_parts;
+    query.fetch_size = fetch_size;
+    query.handler    = handler;
+    query.ctx        = ctx;
+
+    query.mutex = OcilibMutexCreateInternal();
+    CHECK_NULL(query.mutex)
+
+    /* one worker per partition within the limit of the pool size */
+
+    nb_workers = (pool->max > 0 && pool->max < nb_parts) ? pool->max : nb_parts;
+
+    ALLOC_DATA(OCI_IPC_PARALLEL_WORKER, workers, nb_workers)
+
+    for (unsigned int i = 0; i < nb_workers; i++)
+    {
+        workers[i].query = &query;
+        workers[i].con   = OcilibPoolGetConnection(pool, NULL);
+        CHECK_NULL(workers[i].con)
+    }
+
+    /* compute partitions bounds */
+
+    if (OCI_PQM_HASH != mode)
+    {
+        nb_bounds = nb_parts * 2;
+
+        ALLOC_DATA(OCI_IPC_STRING, query.bounds, nb_bounds)
+
+        if (OCI_PQM_ROWID == mode)
+        {
+            CHECK(OcilibPoolParallelQueryRowidRanges(&query, workers[0].con, args[0]))
+        }
+        else
+        {
+            for (unsigned int i = 0; i < nb_bounds; i++)
+            {
+                CHECK_PTR(OCI_IPC_STRING, args[i])
+
+                query.bounds[i] = OcilibStringDuplicate(args[i]);
+                CHECK_NULL(query.bounds[i])
+            }
+        }
+    }
+
+    /* run partitions */
+
+    for (unsigned int i = 0; i < nb_workers; i++)
+    {
+        workers[i].thread = OcilibThreadCreate();
+        CHECK_NULL(workers[i].thread)
+
+        CHECK(OcilibThreadRun(workers[i].thread, OcilibPoolParallelQueryProc, &workers[i]))
+
+        workers[i].running = TRUE;
+    }
+
+    for (unsigned int i = 0; i < nb_workers; i++)
+    {
+        OcilibThreadJoin(workers[i].thread);
+
+        workers[i].running = FALSE;
+    }
+
+    if (0 != query.failed)
+    {
+        THROW(OcilibExceptionParallelQuery, query.failed, (NULL != query.error) ? query.error : OTEXT(""))
+    }
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (NULL != workers)
+        {
+            /* stop and wait for workers already started when an error occurred */
+
+            if (NULL != query.mutex)
+            {
+                OcilibMutexAcquire(query.mutex);
+                query.stop = TRUE;
+                OcilibMutexRelease(query.mutex);
+            }
+
+            for (unsigned int i = 0; i < nb_workers; i++)
+            {
+                if (workers[i].running)
+                {
+                    OcilibThreadJoin(workers[i].thread);
+                }
+
+                if (NULL != workers[i].thread)
+                {
+                    OcilibThreadFree(workers[i].thread);
+                }
+
+                if (NULL != workers[i].con)
+                {
+                    OcilibConnectionFree(workers[i].con);
+                }
+            }
+
+            FREE(workers)
+        }
+
+        if (NULL != query.bounds)
+        {
+            for (unsigned int i = 0; i < nb_bounds; i++)
+            {
+                FREE(query.bounds[i])
+            }
+
+            FREE(query.bounds)
+        }
+
+        FREE(query.error)
+
+        if (NULL != query.mutex)
+        {
+            OcilibMutexFree(query.mutex);
+        }
+    )
+}
@@ -109,4 +109,16 @@ OCI_SYM_LOCAL unsigned int OcilibPoolGetStatementCacheSize
     OCI_Pool *pool
 );
 
+OCI_SYM_LOCAL boolean OcilibPoolParallelQuery
+(
+    OCI_Pool            *pool,
+    const otext         *sql,
+    unsigned int         mode,
+    unsigned int         nb_parts,
+    const otext * const *args,
+    unsigned int         fetch_size,
+    POCI_PARALLEL_FETCH  handler,
+    void                *ctx
+);
+
 #endif /* OCILIB_POOL_H_INCLUDED */
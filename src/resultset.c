@@ -22,6 +22,7 @@
 
 #include "collection.h"
 #include "column.h"
+#include "connection.h"
 #include "date.h"
 #include "define.h"
 #include "error.h"
@@ -34,11 +35,13 @@
 #include "long.h"
 #include "macros.h"
 #include "memory.h"
+#include "mutex.h"
 #include "number.h"
 #include "object.h"
 #include "reference.h"
 #include "statement.h"
 #include "stringutils.h"
+#include "thread.h"
 #include "timestamp.h"
 #include "vector.h"
 #include "xmltype.h"
@@ -113,6 +116,300 @@ static unsigned int SeekModeValues[] =
                                                          \
     EXIT_FUNC()
 
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibResultsetGetRowWidth
+ * --------------------------------------------------------------------------------------------- */
+
+static ub4 OcilibResultsetGetRowWidth
+(
+    OCI_Resultset *rs
+)
+{
+    ub4 width = 0;
+
+    /* memory allocated per row : data buffer, indicator and length */
+
+    for (ub4 i = 0; i < rs->nb_defs; i++)
+    {
+        const OCI_Define *def = &rs->defs[i];
+
+        width += IS_DYNAMIC_FETCH_COLUMN(&def->col) ? (ub4) sizeof(void *) : (ub4) def->col.bufsize;
+        width += (ub4) (sizeof(OCIInd) + def->buf.sizelen);
+
+        if (SQLT_NTY == def->col.sqlcode)
+        {
+            width += (ub4) sizeof(void *);
+        }
+    }
+
+    return width > 0 ? width : 1;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibResultsetAdaptFetchSize
+ * --------------------------------------------------------------------------------------------- */
+
+static void OcilibResultsetAdaptFetchSize
+(
+    OCI_Resultset *rs,
+    ub4            row_fetched,
+    big_uint       elapsed
+)
+{
+    /* a partial array means the end of the resultset has been reached and the first
+       fetch is partly served from the rows pre-fetched at execute time */
+
+    if (row_fetched < rs->fetch_size || row_fetched == rs->row_count)
+    {
+        return;
+    }
+
+    /* the fetch size is doubled as long as the throughput improves by at least 10%.
+       Otherwise the previous size is restored and kept for the remaining fetches */
+
+    if (rs->fetch_sample > 0 && (big_uint) row_fetched * rs->fetch_time * 10 <=
+                                (big_uint) rs->fetch_sample * elapsed * 11)
+    {
+        rs->fetch_size  = rs->fetch_sample;
+        rs->fetch_adapt = FALSE;
+    }
+    else if (rs->fetch_size >= rs->fetch_max)
+    {
+        rs->fetch_adapt = FALSE;
+    }
+    else
+    {
+        rs->fetch_sample = row_fetched;
+        rs->fetch_time   = elapsed;
+        rs->fetch_size   = rs->fetch_size * 2 < rs->fetch_max ? rs->fetch_size * 2 : rs->fetch_max;
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibResultsetIsReadAheadAllowed
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean OcilibResultsetIsReadAheadAllowed
+(
+    OCI_Resultset *rs
+)
+{
+    /* only forward only resultsets with columns fetched into plain buffers or descriptors
+       that do not depend on the rows being held can be read ahead */
+
+    if (!rs->stmt->read_ahead || !LIB_THREADED || (OCI_SFM_SCROLLABLE == rs->stmt->exec_mode) ||
+        (rs->stmt->exec_mode & OCI_DESCRIBE_ONLY) || (rs->stmt->exec_mode & OCI_PARSE_ONLY))
+    {
+        return FALSE;
+    }
+
+    for (ub4 i = 0; i < rs->nb_defs; i++)
+    {
+        const OCI_Column *col = &rs->defs[i].col;
+
+        if (IS_DYNAMIC_FETCH_COLUMN(col))
+        {
+            return FALSE;
+        }
+
+        switch (col->datatype)
+        {
+            case OCI_CDT_NUMERIC:
+            case OCI_CDT_DATETIME:
+            case OCI_CDT_TEXT:
+            case OCI_CDT_TIMESTAMP:
+            case OCI_CDT_INTERVAL:
+            case OCI_CDT_RAW:
+            case OCI_CDT_BOOLEAN:
+            {
+                break;
+            }
+            default:
+            {
+                return FALSE;
+            }
+        }
+    }
+
+    return TRUE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibResultsetReadAheadProc
+ * --------------------------------------------------------------------------------------------- */
+
+static void OcilibResultsetReadAheadProc
+(
+    OCI_Thread *thread,
+    void       *arg
+)
+{
+    OCI_Resultset *rs = (OCI_Resultset *) arg;
+
+    OCI_NOT_USED(thread)
+
+    /* the helper thread lives as long as the resultset and fetches a block of rows
+       each time it is requested. Errors are stored per thread, thus fetch errors
+       are checked by the consumer thread once the fetch is completed */
+
+    OcilibConditionAcquire(rs->ahead_cond);
+
+    while (TRUE)
+    {
+        while (!rs->ahead_request && !rs->ahead_stop)
+        {
+            OcilibConditionWait(rs->ahead_cond);
+        }
+
+        if (!rs->ahead_request)
+        {
+            break;
+        }
+
+        OcilibConditionRelease(rs->ahead_cond);
+
+        const big_uint start = OcilibStatementStatsGetTime();
+
+#if defined(OCI_STMT_SCROLLABLE_READONLY)
+
+        if (Env.use_scrollable_cursors)
+        {
+            rs->ahead_status = OCIStmtFetch2(rs->stmt->stmt, rs->ahead_err,
+                                             rs->fetch_size, (ub2) OCI_FETCH_NEXT, (sb4) 0,
+                                             (ub4) OCI_DEFAULT);
+        }
+        else
+
+#endif
+
+        {
+            rs->ahead_status = OCIStmtFetch(rs->stmt->stmt, rs->ahead_err,
+                                            rs->fetch_size, (ub2) OCI_FETCH_NEXT,
+                                            (ub4) OCI_DEFAULT);
+        }
+
+        rs->ahead_time = OcilibStatementStatsGetTime() - start;
+
+        OcilibConditionAcquire(rs->ahead_cond);
+
+        rs->ahead_request = FALSE;
+
+        OcilibConditionBroadcast(rs->ahead_cond);
+    }
+
+    OcilibConditionRelease(rs->ahead_cond);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibResultsetReadAheadStart
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean OcilibResultsetReadAheadStart
+(
+    OCI_Resultset *rs
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_RESULTSET, rs
+    )
+
+    CHECK_PTR(OCI_IPC_RESULTSET, rs)
+
+    /* rows are fetched into the placeholder not being read by the application */
+
+    for (ub4 i = 0; i < rs->nb_defs; i++)
+    {
+        OCI_Define *def = &rs->defs[i];
+
+        OcilibDefineSwapBuffers(def);
+
+        const boolean res = OcilibDefineDef(def, i + 1);
+
+        OcilibDefineSwapBuffers(def);
+
+        CHECK(res)
+    }
+
+    /* the helper thread is started by the first read-ahead fetch */
+
+    if (NULL == rs->ahead_thread)
+    {
+        if (NULL == rs->ahead_cond)
+        {
+            rs->ahead_cond = OcilibConditionCreate();
+            CHECK_NULL(rs->ahead_cond)
+        }
+
+        rs->ahead_thread = OcilibThreadCreate();
+        CHECK_NULL(rs->ahead_thread)
+
+        if (!OcilibThreadRun(rs->ahead_thread, OcilibResultsetReadAheadProc, rs))
+        {
+            OcilibThreadFree(rs->ahead_thread);
+            rs->ahead_thread = NULL;
+
+            CHECK(FALSE)
+        }
+    }
+
+    CHECK(OcilibConditionAcquire(rs->ahead_cond))
+
+    rs->ahead_request = TRUE;
+    rs->ahead_started = TRUE;
+
+    OcilibConditionBroadcast(rs->ahead_cond);
+
+    CHECK(OcilibConditionRelease(rs->ahead_cond))
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibResultsetReadAheadWait
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean OcilibResultsetReadAheadWait
+(
+    OCI_Resultset *rs
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_RESULTSET, rs
+    )
+
+    CHECK_PTR(OCI_IPC_RESULTSET, rs)
+
+    rs->ahead_started = FALSE;
+
+    boolean res = OcilibConditionAcquire(rs->ahead_cond);
+
+    while (res && rs->ahead_request)
+    {
+        res = OcilibConditionWait(rs->ahead_cond);
+    }
+
+    res = OcilibConditionRelease(rs->ahead_cond) && res;
+
+    /* the placeholder filled in background becomes the one read by the application */
+
+    for (ub4 i = 0; i < rs->nb_defs; i++)
+    {
+        OcilibDefineSwapBuffers(&rs->defs[i]);
+    }
+
+    CHECK(res)
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OcilibResultsetCreate
  * --------------------------------------------------------------------------------------------- */
@@ -135,7 +432,7 @@ OCI_Resultset * OcilibResultsetCreate
 
     /* allocate resultset structure */
 
-    ALLOC_DATA(OCI_IPC_RESULTSET, rs, 1)
+    ARENA_ALLOC_DATA(stmt->con->arena, OCI_IPC_RESULTSET, rs, 1)
 
     /* set attributes */
 
@@ -146,6 +443,7 @@ OCI_Resultset * OcilibResultsetCreate
     rs->bof          = TRUE;
     rs->eof          = FALSE;
     rs->fetch_size   = size;
+    rs->fetch_max    = size;
     rs->fetch_status = OCI_SUCCESS;
     rs->row_count    = 0;
     rs->row_cur      = 0;
@@ -169,7 +467,7 @@ OCI_Resultset * OcilibResultsetCreate
 
     /* allocate columns array */
 
-    ALLOC_DATA(OCI_IPC_DEFINE, rs->defs, nb)
+    ARENA_ALLOC_DATA(stmt->con->arena, OCI_IPC_DEFINE, rs->defs, nb)
 
     /* describe select list */
 
@@ -212,6 +510,32 @@ OCI_Resultset * OcilibResultsetCreate
 
         }
 
+        /* with a fetch memory budget, the fetch array is sized from the described row width.
+           Forward only fetches start with the statement fetch size and grow up to it */
+
+        if (stmt->fetch_mem > 0)
+        {
+            const ub4 rows = stmt->fetch_mem / OcilibResultsetGetRowWidth(rs);
+
+            rs->fetch_mem = stmt->fetch_mem;
+            rs->fetch_max = rows > 0 ? rows : 1;
+
+            if (OCI_SFM_SCROLLABLE == rs->stmt->exec_mode)
+            {
+                rs->fetch_size = rs->fetch_size > 1 ? rs->fetch_max : 1;
+            }
+            else
+            {
+                rs->fetch_size  = rs->fetch_size < rs->fetch_max ? rs->fetch_size : rs->fetch_max;
+                rs->fetch_adapt = rs->fetch_size < rs->fetch_max;
+            }
+
+            for (i = 0; i < nb; i++)
+            {
+                rs->defs[i].buf.count = rs->fetch_max;
+            }
+        }
+
         /* allocation internal buffers if needed */
 
         if (!(rs->stmt->exec_mode & OCI_DESCRIBE_ONLY) && !(rs->stmt->exec_mode & OCI_PARSE_ONLY))
@@ -228,6 +552,31 @@ OCI_Resultset * OcilibResultsetCreate
                 CHECK(OcilibDefineAlloc( def))
                 CHECK(OcilibDefineDef(def, i + 1))
             }
+
+            /* read-ahead fetches need a second placeholder per column and their own error handle */
+
+            if (OcilibResultsetIsReadAheadAllowed(rs))
+            {
+                for (i = 0; i < nb; i++)
+                {
+                    OCI_Define *def = &rs->defs[i];
+
+                    OcilibDefineSwapBuffers(def);
+
+                    const boolean res = OcilibDefineAlloc(def);
+
+                    OcilibDefineSwapBuffers(def);
+
+                    CHECK(res)
+                }
+
+                CHECK(OcilibMemoryAllocHandle((dvoid *)rs->stmt->con->env,
+                                              (dvoid **)(void *)&rs->ahead_err,
+                                              OCI_HTYPE_ERROR))
+
+                rs->ahead       = TRUE;
+                rs->fetch_adapt = FALSE;
+            }
         }
     }
     else if (NULL != rs->defs)
@@ -312,6 +661,181 @@ OCI_Resultset * OcilibResultsetCreate
     )
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibResultsetRedefine
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibResultsetRedefine
+(
+    OCI_Resultset *rs,
+    boolean       *p_valid
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_RESULTSET, rs
+    )
+
+    ub4 nb = 0;
+
+    CHECK_PTR(OCI_IPC_RESULTSET, rs)
+    CHECK_PTR(OCI_IPC_VOID,      p_valid)
+
+    *p_valid = FALSE;
+
+    /* the select list may have been altered by DDL since the resultset was described.
+       Columns are checked against their description and what their buffers have been sized for */
+
+    CHECK_ATTRIB_GET
+    (
+        OCI_HTYPE_STMT, OCI_ATTR_PARAM_COUNT,
+        rs->stmt->stmt, &nb, NULL,
+        rs->stmt->con->err
+    )
+
+    if (nb != rs->nb_defs)
+    {
+        SET_SUCCESS()
+        JUMP_EXIT()
+    }
+
+    for (ub4 i = 0; i < rs->nb_defs; i++)
+    {
+        const OCI_Column *col = &rs->defs[i].col;
+
+        void   *param   = NULL;
+        dbtext *dbstr   = NULL;
+        otext  *name    = NULL;
+        int     dbsize  = 0;
+        ub2     sqlcode = 0;
+        ub2     size    = 0;
+        sb2     prec    = 0;
+        sb2     prec2   = 0;
+        sb1     scale   = 0;
+        ub1     csfrm   = 0;
+
+        CHECK_OCI
+        (
+            rs->stmt->con->err,
+            OCIParamGet,
+            (dvoid *) rs->stmt->stmt, OCI_HTYPE_STMT, rs->stmt->con->err,
+            (void**) &param, (ub4) (i + 1)
+        )
+
+        CHECK_ATTRIB_GET
+        (
+            OCI_DTYPE_PARAM, OCI_ATTR_DATA_TYPE,
+            param, &sqlcode, NULL,
+            rs->stmt->con->err
+        )
+
+        CHECK_ATTRIB_GET
+        (
+            OCI_DTYPE_PARAM, OCI_ATTR_DATA_SIZE,
+            param, &size, NULL,
+            rs->stmt->con->err
+        )
+
+        CHECK_ATTRIB_GET
+        (
+            OCI_DTYPE_PARAM, OCI_ATTR_SCALE,
+            param, &scale, NULL,
+            rs->stmt->con->err
+        )
+
+        CHECK_ATTRIB_GET
+        (
+            OCI_DTYPE_PARAM, OCI_ATTR_CHARSET_FORM,
+            param, &csfrm, NULL,
+            rs->stmt->con->err
+        )
+
+        /* precisions are retrieved as when columns are described */
+
+        if (SQLT_TIMESTAMP == sqlcode || SQLT_TIMESTAMP_TZ == sqlcode || SQLT_TIMESTAMP_LTZ == sqlcode)
+        {
+            CHECK_ATTRIB_GET
+            (
+                OCI_DTYPE_PARAM, OCI_ATTR_FSPRECISION,
+                param, &prec, NULL,
+                rs->stmt->con->err
+            )
+        }
+        else if (SQLT_INTERVAL_DS == sqlcode || SQLT_INTERVAL_YM == sqlcode)
+        {
+            CHECK_ATTRIB_GET
+            (
+                OCI_DTYPE_PARAM, OCI_ATTR_LFPRECISION,
+                param, &prec, NULL,
+                rs->stmt->con->err
+            )
+
+            CHECK_ATTRIB_GET
+            (
+                OCI_DTYPE_PARAM, OCI_ATTR_FSPRECISION,
+                param, &prec2, NULL,
+                rs->stmt->con->err
+            )
+        }
+        else
+        {
+            CHECK_ATTRIB_GET
+            (
+                OCI_DTYPE_PARAM, OCI_ATTR_PRECISION,
+                param, &prec, NULL,
+                rs->stmt->con->err
+            )
+
+            prec2 = col->prec2;
+        }
+
+        CHECK_ATTRIB_GET
+        (
+            OCI_DTYPE_PARAM, OCI_ATTR_NAME,
+            param, &dbstr, &dbsize,
+            rs->stmt->con->err
+        )
+
+        if (NULL != dbstr)
+        {
+            name = OcilibStringDuplicateFromDBString(dbstr, dbcharcount(dbsize));
+            CHECK_NULL(name)
+        }
+
+        const boolean same_name = (NULL == name || NULL == col->name) ? (name == col->name) :
+                                  (0 == ostrcmp(name, col->name));
+
+        FREE(name)
+
+        if ((sqlcode != col->sqlcode) || (size > col->size) || (scale != col->scale) ||
+            (prec != col->prec) || (prec2 != col->prec2) || (csfrm != col->csfrm) || !same_name)
+        {
+            SET_SUCCESS()
+            JUMP_EXIT()
+        }
+    }
+
+    /* define handles belonged to the previous statement handle */
+
+    for (ub4 i = 0; i < rs->nb_defs; i++)
+    {
+        OCI_Define *def = &rs->defs[i];
+
+        def->buf.handle = NULL;
+
+        CHECK(OcilibDefineDef(def, i + 1))
+    }
+
+    rs->redefine = FALSE;
+
+    *p_valid = TRUE;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OcilibResultsetExpandStrings
  * --------------------------------------------------------------------------------------------- */
@@ -460,34 +984,59 @@ static boolean OcilibResultsetFetchData
 
     CHECK(OcilibResultsetClearFetchedObjectInstances(rs))
 
+    /* arrays of the previous block are about to be overwritten */
+
+    rs->block_rows = 0;
+
     /* internal fetch */
 
-#if defined(OCI_STMT_SCROLLABLE_READONLY)
+    OCIError *err     = rs->stmt->con->err;
+    big_uint  elapsed = 0;
 
-    if (Env.use_scrollable_cursors)
+    if (rs->ahead_started)
     {
-        rs->fetch_status = OCIStmtFetch2(rs->stmt->stmt, rs->stmt->con->err,
-                                         rs->fetch_size, (ub2) direction, (sb4) offset,
-                                         (ub4) OCI_DEFAULT);
+        /* rows have been fetched in background into the other placeholder */
+
+        CHECK(OcilibResultsetReadAheadWait(rs))
+
+        err              = rs->ahead_err;
+        elapsed          = rs->ahead_time;
+        rs->fetch_status = rs->ahead_status;
     }
     else
+    {
+        const boolean  timed = LIB_STATEMENT_STATS || rs->fetch_adapt;
+        const big_uint start = timed ? OcilibStatementStatsGetTime() : 0;
+
+#if defined(OCI_STMT_SCROLLABLE_READONLY)
+
+        if (Env.use_scrollable_cursors)
+        {
+            rs->fetch_status = OCIStmtFetch2(rs->stmt->stmt, rs->stmt->con->err,
+                                             rs->fetch_size, (ub2) direction, (sb4) offset,
+                                             (ub4) OCI_DEFAULT);
+        }
+        else
 
 #endif
 
-    {
-        rs->fetch_status = OCIStmtFetch(rs->stmt->stmt, rs->stmt->con->err,
-                                        rs->fetch_size, (ub2) OCI_FETCH_NEXT,
-                                        (ub4) OCI_DEFAULT);
+        {
+            rs->fetch_status = OCIStmtFetch(rs->stmt->stmt, rs->stmt->con->err,
+                                            rs->fetch_size, (ub2) OCI_FETCH_NEXT,
+                                            (ub4) OCI_DEFAULT);
+        }
+
+        elapsed = timed ? OcilibStatementStatsGetTime() - start : 0;
     }
 
     if (OCI_ERROR == rs->fetch_status)
     {
         /* failure */
-        THROW(OcilibExceptionOCI, rs->stmt->con->err, rs->fetch_status)
+        THROW(OcilibExceptionOCI, err, rs->fetch_status)
     }
     else if (OCI_SUCCESS_WITH_INFO == rs->fetch_status)
     {
-        OcilibExceptionOCI(&call_context, rs->stmt->con->err, rs->fetch_status);
+        OcilibExceptionOCI(&call_context, err, rs->fetch_status);
     }
 
     /* finalize dynamic fetch */
@@ -537,11 +1086,35 @@ static boolean OcilibResultsetFetchData
         rs->row_count = row_count;
     }
 
+    if (LIB_STATEMENT_STATS)
+    {
+        big_uint row_size = 0;
+
+        for (ub4 i = 0; i < rs->nb_defs; i++)
+        {
+            row_size += rs->defs[i].col.bufsize;
+        }
+
+        OcilibStatementStatsRecord(rs->stmt, OCI_SSV_FETCH_COUNT, elapsed, row_fetched, row_fetched * row_size);
+    }
+
     if (row_fetched > 0)
     {
         rs->row_fetched = row_fetched;
     }
 
+    if (rs->fetch_adapt)
+    {
+        OcilibResultsetAdaptFetchSize(rs, row_fetched, elapsed);
+    }
+
+    /* fetch the next rows in background while the current ones are consumed */
+
+    if (rs->ahead && (OCI_NO_DATA != rs->fetch_status))
+    {
+        CHECK(OcilibResultsetReadAheadStart(rs))
+    }
+
     /* so far, no OCI error occurred, let's clear the error flag */
 
     /* check if internal fetch was successful */
@@ -641,8 +1214,40 @@ boolean OcilibResultsetInitialize
     rs->row_cur      = 0;
     rs->row_abs      = 0;
     rs->row_fetched  = 0;
+    rs->fetch_sample = 0;
+    rs->fetch_time   = 0;
+    rs->block_rows   = 0;
 
-    return TRUE;
+    return OcilibResultsetStopReadAhead(rs);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibResultsetStopReadAhead
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibResultsetStopReadAhead
+(
+    OCI_Resultset *rs
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_RESULTSET, rs
+    )
+
+    CHECK_PTR(OCI_IPC_RESULTSET, rs)
+
+    /* rows fetched in background are discarded */
+
+    if (rs->ahead_started)
+    {
+        CHECK(OcilibResultsetReadAheadWait(rs))
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
 }
 
 /* --------------------------------------------------------------------------------------------- *
@@ -664,6 +1269,32 @@ boolean OcilibResultsetFree
 
     CHECK_PTR(OCI_IPC_RESULTSET, rs)
 
+    OcilibResultsetStopReadAhead(rs);
+
+    /* stop the read-ahead helper thread */
+
+    if (NULL != rs->ahead_thread)
+    {
+        OcilibConditionAcquire(rs->ahead_cond);
+
+        rs->ahead_stop = TRUE;
+
+        OcilibConditionBroadcast(rs->ahead_cond);
+        OcilibConditionRelease(rs->ahead_cond);
+
+        OcilibThreadJoin(rs->ahead_thread);
+        OcilibThreadFree(rs->ahead_thread);
+
+        rs->ahead_thread = NULL;
+    }
+
+    if (NULL != rs->ahead_cond)
+    {
+        OcilibConditionFree(rs->ahead_cond);
+
+        rs->ahead_cond = NULL;
+    }
+
     for (ub4 i = 0; i < rs->nb_defs; i++)
     {
         OCI_Define *def = &(rs->defs[i]);
@@ -712,7 +1343,8 @@ boolean OcilibResultsetFree
             }
             else
             {
-                OcilibMemoryFreeDescriptorArray((dvoid *)def->buf.data,
+                OcilibMemoryFreeDescriptorArray((dvoid *)def->rs->stmt->con->env,
+                                                (dvoid *)def->buf.data,
                                                 (ub4)def->col.handletype,
                                                 (ub4)def->buf.count);
             }
@@ -755,6 +1387,26 @@ boolean OcilibResultsetFree
         FREE(def->buf.obj_inds)
         FREE(def->buf.lens)
         FREE(def->buf.tmpbuf)
+
+        /* free read-ahead placeholder */
+
+        if (NULL != def->ahead.data && OCI_UNKNOWN != def->col.handletype)
+        {
+            OcilibMemoryFreeDescriptorArray((dvoid *)def->rs->stmt->con->env,
+                                            (dvoid *)def->ahead.data,
+                                            (ub4)def->col.handletype,
+                                            (ub4)def->buf.count);
+        }
+
+        FREE(def->ahead.data)
+        FREE(def->ahead.inds)
+        FREE(def->ahead.obj_inds)
+        FREE(def->ahead.lens)
+    }
+
+    if (NULL != rs->ahead_err)
+    {
+        OcilibMemoryFreeHandle((dvoid *)rs->ahead_err, OCI_HTYPE_ERROR);
     }
 
     /* free column map */
@@ -928,6 +1580,165 @@ boolean OcilibResultsetFetchNext
     EXIT_FUNC()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibResultsetFetchNextAsync
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibResultsetFetchNextAsync
+(
+    OCI_Resultset     *rs,
+    POCI_ASYNC_HANDLER handler,
+    void              *ctx
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_RESULTSET, rs
+    )
+
+    CHECK_PTR(OCI_IPC_RESULTSET, rs)
+    CHECK_STMT_STATUS(rs->stmt, OCI_STMT_EXECUTED)
+
+    CHECK(OcilibConnectionRunAsync(rs->stmt->con, OCI_ACT_FETCH, rs->stmt, rs, handler, ctx))
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibResultsetFetchBlock
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibResultsetFetchBlock
+(
+    OCI_Resultset *rs,
+    unsigned int  *nrows
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_RESULTSET, rs
+    )
+
+    CHECK_PTR(OCI_IPC_RESULTSET, rs)
+    CHECK_PTR(OCI_IPC_VOID,      nrows)
+    CHECK_STMT_STATUS(rs->stmt, OCI_STMT_EXECUTED)
+
+    *nrows = 0;
+
+    /* blocks are only available for regular resultsets */
+
+    CHECK(rs->stmt->nb_rbinds == 0)
+    CHECK(!rs->eof)
+
+    /* rows of the current array not consumed yet are returned before fetching new ones */
+
+    if (rs->row_cur >= rs->row_fetched)
+    {
+        if (OCI_NO_DATA == rs->fetch_status)
+        {
+            rs->eof = TRUE;
+        }
+
+        CHECK(!rs->eof)
+
+        CHECK(OcilibResultsetFetchData(rs, OCI_SFD_NEXT, 0))
+
+        rs->row_cur = 0;
+    }
+
+    /* the last row of the block becomes the current row */
+
+    rs->block_start = rs->row_cur;
+    rs->block_rows  = rs->row_fetched - rs->row_cur;
+    rs->row_abs    += rs->block_rows;
+    rs->row_cur     = rs->row_fetched;
+    rs->bof         = FALSE;
+
+    *nrows = rs->block_rows;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibResultsetGetBlockRowCount
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int OcilibResultsetGetBlockRowCount
+(
+    OCI_Resultset *rs
+)
+{
+    GET_PROP
+    (
+        unsigned int, 0,
+        OCI_IPC_RESULTSET, rs,
+        block_rows
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibResultsetGetColumnBlock
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibResultsetGetColumnBlock
+(
+    OCI_Resultset         *rs,
+    unsigned int           index,
+    const void           **data,
+    unsigned int          *size,
+    const short          **inds,
+    const unsigned short **lens
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_RESULTSET, rs
+    )
+
+    CHECK_PTR(OCI_IPC_RESULTSET, rs)
+    CHECK_BOUND(index, 1, rs->nb_defs)
+    CHECK(rs->block_rows > 0)
+
+    OCI_Define  *def       = &rs->defs[index - 1];
+    unsigned int elem_size = 0;
+
+    /* pointers to the define arrays, starting at the first row of the block */
+
+    const void *ptr = OcilibDefineGetBlockData(def, rs->block_start, &elem_size);
+    CHECK_NULL(ptr)
+
+    if (NULL != data)
+    {
+        *data = ptr;
+    }
+
+    if (NULL != size)
+    {
+        *size = elem_size;
+    }
+
+    if (NULL != inds)
+    {
+        *inds = (const short *) (def->buf.inds + rs->block_start);
+    }
+
+    if (NULL != lens)
+    {
+        *lens = ((const unsigned short *) def->buf.lens) + rs->block_start;
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OcilibResultsetFetchFirstg
  * --------------------------------------------------------------------------------------------- */
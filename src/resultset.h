@@ -28,12 +28,23 @@ OCI_SYM_LOCAL boolean OcilibResultsetInitialize
     OCI_Resultset* rs
 );
 
+OCI_SYM_LOCAL boolean OcilibResultsetStopReadAhead
+(
+    OCI_Resultset* rs
+);
+
 OCI_SYM_LOCAL OCI_Resultset* OcilibResultsetCreate
 (
     OCI_Statement * stmt,
     int             size
 );
 
+OCI_SYM_LOCAL boolean OcilibResultsetRedefine
+(
+    OCI_Resultset* rs,
+    boolean      * p_valid
+);
+
 OCI_SYM_LOCAL boolean OcilibResultsetFree
 (
     OCI_Resultset* rs
@@ -49,6 +60,34 @@ OCI_SYM_LOCAL boolean OcilibResultsetFetchNext
     OCI_Resultset* rs
 );
 
+OCI_SYM_LOCAL boolean OcilibResultsetFetchNextAsync
+(
+    OCI_Resultset    * rs,
+    POCI_ASYNC_HANDLER handler,
+    void             * ctx
+);
+
+OCI_SYM_LOCAL boolean OcilibResultsetFetchBlock
+(
+    OCI_Resultset* rs,
+    unsigned int * nrows
+);
+
+OCI_SYM_LOCAL unsigned int OcilibResultsetGetBlockRowCount
+(
+    OCI_Resultset* rs
+);
+
+OCI_SYM_LOCAL boolean OcilibResultsetGetColumnBlock
+(
+    OCI_Resultset          * rs,
+    unsigned int             index,
+    const void            ** data,
+    unsigned int           * size,
+    const short           ** inds,
+    const unsigned short  ** lens
+);
+
 OCI_SYM_LOCAL boolean OcilibResultsetFetchFirst
 (
     OCI_Resultset* rs
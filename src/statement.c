@@ -35,6 +35,7 @@
 #include "lob.h"
 #include "macros.h"
 #include "memory.h"
+#include "mutex.h"
 #include "number.h"
 #include "object.h"
 #include "reference.h"
@@ -90,6 +91,32 @@ static unsigned int BindAllocationValues[] =
     OCI_BAM_INTERNAL
 };
 
+static unsigned int BindBigIntModeValues[] =
+{
+    OCI_BIM_NUMBER,
+    OCI_BIM_NATIVE
+};
+
+static unsigned int FormatParameterModeValues[] =
+{
+    OCI_FPM_LITERAL,
+    OCI_FPM_BIND
+};
+
+static unsigned int StatementStatsValues[] =
+{
+    OCI_SSV_PREPARE_COUNT,
+    OCI_SSV_PREPARE_TIME,
+    OCI_SSV_EXECUTE_COUNT,
+    OCI_SSV_EXECUTE_TIME,
+    OCI_SSV_FETCH_COUNT,
+    OCI_SSV_FETCH_TIME,
+    OCI_SSV_ROWS_FETCHED,
+    OCI_SSV_ROUND_TRIPS,
+    OCI_SSV_BIND_BYTES,
+    OCI_SSV_DEFINE_BYTES
+};
+
 static unsigned int LongModeValues[] =
 {
     OCI_LONG_EXPLICIT,
@@ -181,6 +208,16 @@ static unsigned int LongModeValues[] =
                                                         \
     EXIT_FUNC()                                         \
 
+#define BIGINT_BIND_SIZE(stmt)                         \
+                                                       \
+    ((OCI_BIM_NATIVE == (stmt)->bind_bigint_mode) ?    \
+     sizeof(big_int) : sizeof(OCINumber))              \
+
+#define BIGINT_BIND_CODE(stmt, code)                   \
+                                                       \
+    ((OCI_BIM_NATIVE == (stmt)->bind_bigint_mode) ?    \
+     (code) : SQLT_VNU)                                \
+
 #define OCI_BIND_GET_SCALAR(s, t, i) (bnd->is_array ? ((t *) (s)) + (i) : (t *) (s))
 #define OCI_BIND_GET_HANDLE(s, t, i) (bnd->is_array ? ((t **) (s))[i] : (t *) (s))
 #define OCI_BIND_GET_BUFFER(d, t, i) ((t *)((d) + (i) * sizeof(t)))
@@ -369,6 +406,8 @@ static boolean OcilibStatementReset
 
     FREE(stmt->sql)
     FREE(stmt->sql_id)
+    FREE(stmt->cache_key)
+    FREE(stmt->fmt_data)
 
     stmt->rsts   = NULL;
     stmt->stmts  = NULL;
@@ -377,6 +416,12 @@ static boolean OcilibStatementReset
     stmt->map    = NULL;
     stmt->batch  = NULL;
 
+    /* statistics are collected per prepared SQL */
+
+    stmt->sql_stats = NULL;
+
+    memset(stmt->stats, 0, sizeof(stmt->stats));
+
     stmt->nb_rs   = 0;
     stmt->nb_stmt = 0;
 
@@ -700,9 +745,10 @@ static boolean OcilibStatementBindCheckAll
              (OCI_CDT_TEXT != bnd->type) &&
              (OCI_CDT_NUMERIC != bnd->type || SQLT_VNU == bnd->code)))
         {
-            /* for strings, re-initialize length array with buffer default size */
+            /* for strings, re-initialize length array with buffer default size
+               unless lengths are provided by the user */
 
-            if (OCI_CDT_TEXT == bnd->type)
+            if ((OCI_CDT_TEXT == bnd->type) && !(bnd->ext_arrays & OCI_BIND_EXT_LENGTHS))
             {
                 for (j = 0; j < bnd->buffer.count; j++)
                 {
@@ -981,7 +1027,7 @@ OCI_Statement * OcilibStatementInitialize
 
     CHECK_PTR(OCI_IPC_CONNECTION, con)
 
-    ALLOC_DATA(OCI_IPC_STATEMENT, stmt, 1);
+    ARENA_ALLOC_DATA(con->arena, OCI_IPC_STATEMENT, stmt, 1);
 
     stmt->con  = con;
     stmt->stmt = handle;
@@ -995,6 +1041,9 @@ OCI_Statement * OcilibStatementInitialize
     stmt->fetch_size      = OCI_FETCH_SIZE;
     stmt->prefetch_size   = OCI_PREFETCH_SIZE;
 
+    stmt->bind_bigint_mode = OCI_BIM_NUMBER;
+    stmt->fmt_param_mode   = OCI_FPM_LITERAL;
+
     /* reset statement */
 
     CHECK(OcilibStatementReset(stmt))
@@ -1117,8 +1166,8 @@ static boolean OcilibStatementCheckImplicitResultsets
 
             /* allocate resultset handles array */
 
-            ALLOC_DATA(OCI_IPC_STATEMENT_ARRAY, stmt->stmts, stmt->nb_stmt)
-            ALLOC_DATA(OCI_IPC_RESULTSET_ARRAY, stmt->rsts,  stmt->nb_stmt)
+            ARENA_ALLOC_DATA(stmt->con->arena, OCI_IPC_STATEMENT_ARRAY, stmt->stmts, stmt->nb_stmt)
+            ARENA_ALLOC_DATA(stmt->con->arena, OCI_IPC_RESULTSET_ARRAY, stmt->rsts,  stmt->nb_stmt)
 
             while (OCI_SUCCESS == OCIStmtGetNextResult(stmt->stmt, stmt->con->err, (dvoid  **)&result, &rs_type, OCI_DEFAULT))
             {
@@ -1183,7 +1232,7 @@ static boolean OcilibStatementBatchErrorInit
     {
         /* allocate batch error structure */
 
-        ALLOC_DATA(OCI_IPC_BATCH_ERRORS, stmt->batch, 1)
+        ARENA_ALLOC_DATA(stmt->con->arena, OCI_IPC_BATCH_ERRORS, stmt->batch, 1)
 
         /* allocate array of error objects */
 
@@ -1250,275 +1299,1121 @@ static boolean OcilibStatementBatchErrorInit
 }
 
 /* --------------------------------------------------------------------------------------------- *
- * OcilibStatementPrepareInternal
+ * OcilibStatementCacheGetKey
  * --------------------------------------------------------------------------------------------- */
 
-boolean OcilibStatementPrepareInternal
+static otext * OcilibStatementCacheGetKey
 (
     OCI_Statement *stmt,
     const otext   *sql
 )
 {
-    ENTER_FUNC
-    (
-        /* returns */ boolean, FALSE,
-        /* context */ OCI_IPC_STATEMENT, stmt
-    )
+    otext *key = (otext *) OcilibMemoryAlloc(OCI_IPC_STRING, sizeof(otext), ostrlen(sql) + 5, TRUE);
 
-    dbtext *dbstr = NULL;
-    int dbsize = -1;
+    /* parked statements are only handed back to statements using the same bind configuration */
 
-    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+    if (NULL != key)
+    {
+        key[0] = (otext) (OTEXT('0') + stmt->bind_mode);
+        key[1] = (otext) (OTEXT('0') + stmt->bind_alloc_mode);
+        key[2] = (otext) (OTEXT('0') + stmt->bind_bigint_mode);
+        key[3] = OTEXT('|');
 
-    /* reset statement */
+        ostrcat(key, sql);
+    }
 
-    CHECK(OcilibStatementReset(stmt))
+    return key;
+}
 
-    /* store SQL */
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementCacheIsEligible
+ * --------------------------------------------------------------------------------------------- */
 
-    stmt->sql = OcilibStringDuplicate(sql);
+static boolean OcilibStatementCacheIsEligible
+(
+    OCI_Statement *stmt
+)
+{
+    if ((0 == stmt->con->prep_cache.size) || (NULL == stmt->stmt) ||
+        (OCI_OBJECT_ALLOCATED != stmt->hstate) || !(stmt->status & OCI_STMT_PREPARED) ||
+        !IS_STRING_VALID(stmt->sql) || (stmt->nb_rbinds > 0) || (stmt->nb_stmt > 0))
+    {
+        return FALSE;
+    }
 
-    dbstr = OcilibStringGetDBString(stmt->sql, &dbsize);
+    /* binds must point to buffers owned by OCILIB that remain valid once parked */
 
-    if (Env.version_runtime < OCI_9_2)
+    for (ub2 i = 0; i < stmt->nb_ubinds; i++)
     {
-        /* allocate handle */
+        const OCI_Bind *bnd = stmt->ubinds[i];
 
-        CHECK(OcilibMemoryAllocHandle((dvoid *)stmt->con->env, (dvoid **)(void *)&stmt->stmt, OCI_HTYPE_STMT))
+        if ((OCI_BAM_INTERNAL != bnd->alloc_mode) || (0 != bnd->ext_arrays) ||
+            (OCI_CDT_LONG == bnd->type) || (OCI_CDT_CURSOR == bnd->type))
+        {
+            return FALSE;
+        }
     }
 
-    /* prepare SQL */
-
-#if OCI_VERSION_COMPILE >= OCI_9_2
+    /* LONG defines keep a reference to their statement */
 
-    if (Env.version_runtime >= OCI_9_2)
+    for (ub4 i = 0; i < stmt->nb_rs; i++)
     {
-        ub4 mode = OCI_DEFAULT;
-
-  #if OCI_VERSION_COMPILE >= OCI_12_2
+        const OCI_Resultset *rs = stmt->rsts[i];
 
-        if (OcilibConnectionIsVersionSupported(stmt->con, OCI_12_2))
+        for (ub4 j = 0; rs && j < rs->nb_defs; j++)
         {
-            mode |= OCI_PREP2_GET_SQL_ID;
+            if (OCI_CDT_LONG == rs->defs[j].col.datatype)
+            {
+                return FALSE;
+            }
         }
+    }
 
-  #endif
+    return TRUE;
+}
 
-        CHECK_OCI
-        (
-            stmt->con->err,
-            OCIStmtPrepare2,
-            stmt->con->cxt, &stmt->stmt, stmt->con->err, (OraText *) dbstr,
-            (ub4) dbsize, NULL, 0, (ub4) OCI_NTV_SYNTAX, (ub4) mode
-        )
-    }
-    else
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementCacheUnlink
+ * --------------------------------------------------------------------------------------------- */
 
-#endif
+static void OcilibStatementCacheUnlink
+(
+    OCI_StatementCache *cache,
+    OCI_Statement      *stmt
+)
+{
+    OCI_HashEntry *e = OcilibHashLookup(cache->map, stmt->cache_key, FALSE);
 
+    /* remove it from the chain of statements sharing the same key */
+
+    if (NULL != e && NULL != e->values)
     {
-        CHECK_OCI
-        (
-            stmt->con->err,
-            OCIStmtPrepare,
-            stmt->stmt,stmt->con->err, (OraText *) dbstr, (ub4) dbsize,
-            (ub4) OCI_NTV_SYNTAX, (ub4) OCI_DEFAULT
-        )
-    }
+        OCI_Statement *prev = NULL;
+        OCI_Statement *cur  = (OCI_Statement *) e->values->value.p_void;
 
-    /* get statement type */
+        while (NULL != cur && cur != stmt)
+        {
+            prev = cur;
+            cur  = cur->cache_link;
+        }
 
-    CHECK_ATTRIB_GET
-    (
-        OCI_HTYPE_STMT, OCI_ATTR_STMT_TYPE,
-        stmt->stmt, &stmt->type, NULL,
-        stmt->con->err
-    )
+        if (NULL != prev)
+        {
+            prev->cache_link = stmt->cache_link;
+        }
+        else if (NULL != cur)
+        {
+            e->values->value.p_void = stmt->cache_link;
+        }
+    }
 
-    /* update statement status */
+    /* remove it from the parking order list */
 
-    stmt->status = OCI_STMT_PREPARED;
+    if (NULL != stmt->cache_prev)
+    {
+        stmt->cache_prev->cache_next = stmt->cache_next;
+    }
+    else
+    {
+        cache->head = stmt->cache_next;
+    }
 
-    CHECK(OcilibStatementSetPrefetchSize(stmt, stmt->prefetch_size))
-    CHECK(OcilibStatementSetFetchSize(stmt, stmt->fetch_size))
+    if (NULL != stmt->cache_next)
+    {
+        stmt->cache_next->cache_prev = stmt->cache_prev;
+    }
+    else
+    {
+        cache->tail = stmt->cache_prev;
+    }
 
-    SET_SUCCESS()
+    stmt->cache_prev = NULL;
+    stmt->cache_next = NULL;
+    stmt->cache_link = NULL;
 
-    CLEANUP_AND_EXIT_FUNC
-    (
-        OcilibStringReleaseDBString(dbstr);
-    )
+    cache->count--;
 }
 
 /* --------------------------------------------------------------------------------------------- *
- * OcilibStatementExecuteInternal
+ * OcilibStatementCacheCompact
  * --------------------------------------------------------------------------------------------- */
 
-boolean OcilibStatementExecuteInternal
+static void OcilibStatementCacheCompact
 (
-    OCI_Statement *stmt,
-    ub4            mode
+    OCI_StatementCache *cache
 )
 {
-    ENTER_FUNC
-    (
-        /* returns */ boolean, FALSE,
-        /* context */ OCI_IPC_STATEMENT, stmt
-    )
-
-    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+    /* the hash table does not support removals, so keys of statements taken from the cache
+       remain with an empty chain. The table is rebuilt when they outnumber parked statements */
 
-    ub4 iters = 0;
+    if (cache->map->count <= (cache->size * 2) + OCI_HASH_MIN_SIZE)
+    {
+        return;
+    }
 
-    /* set up iterations and mode values for execution */
+    OCI_HashTable *map = OcilibHashCreate(OCI_HASH_MIN_SIZE, OCI_HASH_POINTER);
 
-    if (OCI_CST_SELECT == stmt->type)
+    if (NULL == map)
     {
-        mode |= stmt->exec_mode;
+        return;
     }
-    else
-    {
-        iters = stmt->nb_iters;
 
-        /* for array DML, use batch error mode */
-
-        if (iters > 1 && !IS_PLSQL_STMT(stmt->type))
+    for (OCI_Statement *stmt = cache->head; stmt; stmt = stmt->cache_next)
+    {
+        if (NULL == OcilibHashLookup(map, stmt->cache_key, FALSE))
         {
-            mode = mode | OCI_BATCH_ERRORS;
+            OcilibHashAddPointer(map, stmt->cache_key, OcilibHashGetPointer(cache->map, stmt->cache_key));
         }
     }
 
-    /* reset batch errors */
-
-    CHECK(OcilibStatementBatchErrorClear(stmt))
+    OcilibHashFree(cache->map);
 
-    /* check bind objects for updating their null indicator status */
+    cache->map = map;
+}
 
-    CHECK(OcilibStatementBindCheckAll(stmt))
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementCacheTake
+ * --------------------------------------------------------------------------------------------- */
 
-    /* check current resultsets */
+static OCI_Statement * OcilibStatementCacheTake
+(
+    OCI_StatementCache *cache,
+    const otext        *key
+)
+{
+    OCI_Statement *stmt = NULL;
 
-    if (stmt->rsts)
+    if (NULL != cache->map)
     {
-        /* resultsets are freed before any prepare operations.
-           So, if we got ones here, it means the same SQL order
-           is re-executed */
+        stmt = (OCI_Statement *) OcilibHashGetPointer(cache->map, key);
 
-        if (OCI_CST_SELECT == stmt->type)
-        {
-            /* just reinitialize the current resultset */
+        /* hash table keys are case insensitive, SQL texts are not */
 
-            CHECK(OcilibResultsetInitialize(stmt->rsts[0]))
-        }
-        else
+        while (NULL != stmt && 0 != ostrcmp(stmt->cache_key, key))
         {
-            /* Must free previous resultsets for 'returning into'
-               SQL orders that can produce multiple resultsets */
+            stmt = stmt->cache_link;
+        }
 
-            CHECK(OcilibStatementReleaseResultsets(stmt))
+        if (NULL != stmt)
+        {
+            OcilibStatementCacheUnlink(cache, stmt);
         }
     }
 
-    /* Oracle execute call */
-
-    const sword ret = OCIStmtExecute(stmt->con->cxt, stmt->stmt, stmt->con->err, 
-                                     iters, (ub4)0, (OCISnapshot *)NULL, 
-                                     (OCISnapshot *)NULL, mode);
-
-    /* check result */
-
-    boolean success = ((OCI_SUCCESS           == ret) ||
-                       (OCI_SUCCESS_WITH_INFO == ret) ||
-                       (OCI_NEED_DATA         == ret));
-    
-    /* handle no data as error only for PL/SQL statements as it results from NO_DATA_FOUND exception in PL/SQL */
-
-    if (!success && !IS_PLSQL_STMT(stmt->type))
+    if (NULL != stmt)
     {
-        success = (OCI_NO_DATA == ret);
+        cache->hits++;
     }
-
-    if (OCI_SUCCESS_WITH_INFO == ret)
+    else
     {
-        OcilibExceptionOCI(&call_context, stmt->con->err, ret);
+        cache->misses++;
     }
 
-    /* on batch mode, check if any error occurred */
+    return stmt;
+}
 
-    if (mode & OCI_BATCH_ERRORS)
-    {
-        /* build batch error list if the statement is array DML */
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementCachePark
+ * --------------------------------------------------------------------------------------------- */
 
-        OcilibStatementBatchErrorInit(stmt);
+static boolean OcilibStatementCachePark
+(
+    OCI_Statement *stmt
+)
+{
+    OCI_StatementCache *cache  = &stmt->con->prep_cache;
+    OCI_Statement      *victim = NULL;
+    boolean             parked = FALSE;
 
-        if (stmt->batch)
-        {
-            success = (stmt->batch->count == 0);
-        }
+    if (!OcilibStatementCacheIsEligible(stmt))
+    {
+        return FALSE;
     }
 
-    /* update status on success */
+    FREE(stmt->cache_key)
 
-    if (success)
+    stmt->cache_key = OcilibStatementCacheGetKey(stmt, stmt->sql);
+
+    if (NULL == stmt->cache_key || !OcilibStatementBatchErrorClear(stmt))
     {
-        if (mode & OCI_PARSE_ONLY)
-        {
-            stmt->status |= OCI_STMT_PARSED;
-        }
-        else if (mode & OCI_DESCRIBE_ONLY)
-        {
-            stmt->status |= OCI_STMT_PARSED;
-            stmt->status |= OCI_STMT_DESCRIBED;
-        }
-        else
-        {
-            stmt->status |= OCI_STMT_PARSED;
-            stmt->status |= OCI_STMT_DESCRIBED;
-            stmt->status |= OCI_STMT_EXECUTED;
+        return FALSE;
+    }
 
-#if OCI_VERSION_COMPILE >= OCI_12_2
+    LIST_ATOMIC_OPERATION
+    (
+        stmt->con->stmts,
+        {
+            OCI_HashEntry *e = NULL;
 
-            if (OcilibConnectionIsVersionSupported(stmt->con, OCI_12_2) && stmt->sql_id == NULL)
+            if (NULL == cache->map)
             {
-                unsigned int size_id = 0;
+                cache->map = OcilibHashCreate(OCI_HASH_MIN_SIZE, OCI_HASH_POINTER);
+            }
 
-                OcilibStringGetAttribute(stmt->con, stmt->stmt, OCI_HTYPE_STMT, 
-                                         OCI_ATTR_SQL_ID, &stmt->sql_id, &size_id);
+            if (NULL != cache->map)
+            {
+                e = OcilibHashLookup(cache->map, stmt->cache_key, TRUE);
             }
 
-#endif
+            if (NULL != e && NULL != e->values)
+            {
+                stmt->cache_link        = (OCI_Statement *) e->values->value.p_void;
+                e->values->value.p_void = stmt;
+                parked                  = TRUE;
+            }
+            else if (NULL != e)
+            {
+                stmt->cache_link = NULL;
+                parked           = OcilibHashAddPointer(cache->map, stmt->cache_key, stmt);
+            }
 
-            /* reset binds indicators */
+            if (parked)
+            {
+                stmt->cache_prev = NULL;
+                stmt->cache_next = cache->head;
 
-            CHECK(OcilibStatementBindUpdateAll(stmt))
+                if (NULL != cache->head)
+                {
+                    cache->head->cache_prev = stmt;
+                }
+                else
+                {
+                    cache->tail = stmt;
+                }
 
-            /* commit if necessary */
+                cache->head = stmt;
+                cache->count++;
 
-            if (stmt->con->autocom)
-            {
-                CHECK(OcilibConnectionCommit(stmt->con))
-            }
+                /* the least recently parked statement is evicted when the cache is full */
 
-            /* check if any implicit results are available */
+                if (cache->count > cache->size)
+                {
+                    victim = cache->tail;
 
-            CHECK(OcilibStatementCheckImplicitResultsets(stmt))
+                    OcilibStatementCacheUnlink(cache, victim);
+                }
 
+                OcilibStatementCacheCompact(cache);
+            }
         }
-    }
-    else
+    )
+
+    if (parked)
+    {
+        OcilibErrorResetSource(NULL, stmt);
+    }
+
+    if (NULL != victim)
+    {
+        LIST_ATOMIC_REMOVE(stmt->con->stmts, victim, OcilibStatementDispose)
+
+        FREE(victim)
+    }
+
+    return parked;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementPrepareFromCache
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean OcilibStatementPrepareFromCache
+(
+    OCI_Statement *stmt,
+    const otext   *sql,
+    boolean       *p_found
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    OCI_StatementCache *cache  = &stmt->con->prep_cache;
+    OCI_Statement      *cached = NULL;
+    otext              *key    = NULL;
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+
+    *p_found = FALSE;
+
+    if (0 == cache->size)
+    {
+        SET_SUCCESS()
+        JUMP_EXIT()
+    }
+
+    key = OcilibStatementCacheGetKey(stmt, sql);
+    CHECK_NULL(key)
+
+    LIST_ATOMIC_OPERATION
+    (
+        stmt->con->stmts,
+        {
+            cached = OcilibStatementCacheTake(cache, key);
+        }
+    )
+
+    if (NULL != cached)
+    {
+        /* move the prepared state of the parked statement. Statement settings are kept */
+
+        stmt->stmt             = cached->stmt;
+        stmt->hstate           = cached->hstate;
+        stmt->rsts             = cached->rsts;
+        stmt->sql              = cached->sql;
+        stmt->sql_id           = cached->sql_id;
+        stmt->ubinds           = cached->ubinds;
+        stmt->map              = cached->map;
+        stmt->nb_ubinds        = cached->nb_ubinds;
+        stmt->allocated_ubinds = cached->allocated_ubinds;
+        stmt->bind_array       = cached->bind_array;
+        stmt->type             = cached->type;
+        stmt->nb_iters         = cached->nb_iters;
+        stmt->nb_iters_init    = cached->nb_iters_init;
+        stmt->nb_rs            = cached->nb_rs;
+        stmt->cur_rs           = 0;
+        stmt->status           = OCI_STMT_PREPARED;
+
+        for (ub2 i = 0; i < stmt->nb_ubinds; i++)
+        {
+            stmt->ubinds[i]->stmt = stmt;
+        }
+
+        for (ub4 i = 0; i < stmt->nb_rs; i++)
+        {
+            if (NULL != stmt->rsts[i])
+            {
+                stmt->rsts[i]->stmt = stmt;
+            }
+        }
+
+        /* existing binds can be bound again to update them */
+
+        if (stmt->nb_ubinds > 0)
+        {
+            stmt->bind_reuse = TRUE;
+        }
+
+        /* release the parked statement object that does not own anything anymore */
+
+        cached->stmt      = NULL;
+        cached->rsts      = NULL;
+        cached->sql       = NULL;
+        cached->sql_id    = NULL;
+        cached->ubinds    = NULL;
+        cached->map       = NULL;
+        cached->nb_ubinds = 0;
+        cached->nb_rs     = 0;
+
+        LIST_ATOMIC_REMOVE(stmt->con->stmts, cached, OcilibStatementDispose)
+
+        FREE(cached)
+
+        CHECK(OcilibStatementSetPrefetchSize(stmt, stmt->prefetch_size))
+        CHECK(OcilibStatementSetFetchSize(stmt, stmt->fetch_size))
+
+        *p_found = TRUE;
+    }
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        OcilibMemoryFree(key);
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementCachePurge
+ * --------------------------------------------------------------------------------------------- */
+
+void OcilibStatementCachePurge
+(
+    OCI_Connection *con,
+    unsigned int    size
+)
+{
+    OCI_StatementCache *cache = &con->prep_cache;
+
+    for (;;)
+    {
+        OCI_Statement *victim = NULL;
+
+        LIST_ATOMIC_OPERATION
+        (
+            con->stmts,
+            {
+                if (cache->count > size)
+                {
+                    victim = cache->tail;
+
+                    OcilibStatementCacheUnlink(cache, victim);
+                }
+            }
+        )
+
+        if (NULL == victim)
+        {
+            break;
+        }
+
+        LIST_ATOMIC_REMOVE(con->stmts, victim, OcilibStatementDispose)
+
+        FREE(victim)
+    }
+
+    if (0 == size && NULL != cache->map)
+    {
+        OcilibHashFree(cache->map);
+
+        cache->map = NULL;
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementDetachResultset
+ * --------------------------------------------------------------------------------------------- */
+
+static OCI_Resultset * OcilibStatementDetachResultset
+(
+    OCI_Statement *stmt,
+    const otext   *sql
+)
+{
+    OCI_Resultset *rs = NULL;
+
+    /* when the same SQL select is prepared again, its described columns and their buffers
+       are kept and only defined again once the new statement handle has been executed */
+
+    if ((OCI_CST_SELECT != stmt->type) || (1 != stmt->nb_rs) || (NULL == stmt->rsts) ||
+        (NULL == stmt->rsts[0]) || (stmt->nb_stmt > 0) || (stmt->nb_rbinds > 0) ||
+        !IS_STRING_VALID(stmt->sql) || (0 != ostrcmp(stmt->sql, sql)))
+    {
+        return NULL;
+    }
+
+    rs = stmt->rsts[0];
+
+    for (ub4 i = 0; i < rs->nb_defs; i++)
+    {
+        const OCI_Define *def = &rs->defs[i];
+
+        /* skip resultsets only described and columns holding data tied to the statement */
+
+        if ((NULL == def->buf.data) || IS_DYNAMIC_FETCH_COLUMN(&def->col) ||
+            (OCI_CDT_CURSOR == def->col.datatype) ||
+            (SQLT_NTY == def->col.sqlcode) || (SQLT_REF == def->col.sqlcode))
+        {
+            return NULL;
+        }
+    }
+
+    /* rows fetched in background belong to the previous statement handle */
+
+    if (!OcilibResultsetStopReadAhead(rs))
+    {
+        return NULL;
+    }
+
+    stmt->rsts[0] = NULL;
+
+    rs->redefine = TRUE;
+
+    return rs;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementPrepareInternal
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibStatementPrepareInternal
+(
+    OCI_Statement *stmt,
+    const otext   *sql
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    dbtext *dbstr = NULL;
+    int dbsize = -1;
+
+    boolean from_cache = FALSE;
+
+    OCI_Resultset *rs = NULL;
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+
+    /* keep the described select list if the same SQL is prepared again */
+
+    rs = OcilibStatementDetachResultset(stmt, sql);
+
+    /* reset statement */
+
+    CHECK(OcilibStatementReset(stmt))
+
+    const big_uint start = LIB_STATEMENT_STATS ? OcilibStatementStatsGetTime() : 0;
+
+    /* reuse a statement parked in the connection statement cache if possible */
+
+    CHECK(OcilibStatementPrepareFromCache(stmt, sql, &from_cache))
+
+    if (from_cache)
+    {
+        /* the parked statement comes with its own resultsets */
+
+        if (NULL != rs)
+        {
+            OcilibResultsetFree(rs);
+        }
+
+        if (LIB_STATEMENT_STATS)
+        {
+            OcilibStatementStatsRecord(stmt, OCI_SSV_PREPARE_COUNT, OcilibStatementStatsGetTime() - start, 0, 0);
+        }
+
+        SET_SUCCESS()
+        JUMP_EXIT()
+    }
+
+    /* store SQL */
+
+    stmt->sql = OcilibStringDuplicate(sql);
+
+    dbstr = OcilibStringGetDBString(stmt->sql, &dbsize);
+
+    if (Env.version_runtime < OCI_9_2)
+    {
+        /* allocate handle */
+
+        CHECK(OcilibMemoryAllocHandle((dvoid *)stmt->con->env, (dvoid **)(void *)&stmt->stmt, OCI_HTYPE_STMT))
+    }
+
+    /* prepare SQL */
+
+#if OCI_VERSION_COMPILE >= OCI_9_2
+
+    if (Env.version_runtime >= OCI_9_2)
+    {
+        ub4 mode = OCI_DEFAULT;
+
+  #if OCI_VERSION_COMPILE >= OCI_12_2
+
+        if (OcilibConnectionIsVersionSupported(stmt->con, OCI_12_2))
+        {
+            mode |= OCI_PREP2_GET_SQL_ID;
+        }
+
+  #endif
+
+        CHECK_OCI
+        (
+            stmt->con->err,
+            OCIStmtPrepare2,
+            stmt->con->cxt, &stmt->stmt, stmt->con->err, (OraText *) dbstr,
+            (ub4) dbsize, NULL, 0, (ub4) OCI_NTV_SYNTAX, (ub4) mode
+        )
+    }
+    else
+
+#endif
+
+    {
+        CHECK_OCI
+        (
+            stmt->con->err,
+            OCIStmtPrepare,
+            stmt->stmt,stmt->con->err, (OraText *) dbstr, (ub4) dbsize,
+            (ub4) OCI_NTV_SYNTAX, (ub4) OCI_DEFAULT
+        )
+    }
+
+    /* get statement type */
+
+    CHECK_ATTRIB_GET
+    (
+        OCI_HTYPE_STMT, OCI_ATTR_STMT_TYPE,
+        stmt->stmt, &stmt->type, NULL,
+        stmt->con->err
+    )
+
+    /* update statement status */
+
+    stmt->status = OCI_STMT_PREPARED;
+
+    CHECK(OcilibStatementSetPrefetchSize(stmt, stmt->prefetch_size))
+    CHECK(OcilibStatementSetFetchSize(stmt, stmt->fetch_size))
+
+    if (LIB_STATEMENT_STATS)
+    {
+        OcilibStatementStatsRecord(stmt, OCI_SSV_PREPARE_COUNT, OcilibStatementStatsGetTime() - start, 0, 0);
+    }
+
+    if ((NULL != rs) && (OCI_CST_SELECT == stmt->type))
+    {
+        ARENA_ALLOC_DATA(stmt->con->arena, OCI_IPC_RESULTSET_ARRAY, stmt->rsts, 1)
+
+        stmt->rsts[0] = rs;
+        stmt->nb_rs   = 1;
+        stmt->cur_rs  = 0;
+
+        rs = NULL;
+    }
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        OcilibStringReleaseDBString(dbstr);
+
+        if (NULL != rs)
+        {
+            OcilibResultsetFree(rs);
+        }
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementExecuteInternal
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibStatementExecuteInternal
+(
+    OCI_Statement *stmt,
+    ub4            mode
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+
+    ub4 iters = 0;
+
+    /* set up iterations and mode values for execution */
+
+    if (OCI_CST_SELECT == stmt->type)
+    {
+        mode |= stmt->exec_mode;
+    }
+    else
+    {
+        iters = stmt->nb_iters;
+
+        /* for array DML, use batch error mode */
+
+        if (iters > 1 && !IS_PLSQL_STMT(stmt->type))
+        {
+            mode = mode | OCI_BATCH_ERRORS;
+        }
+    }
+
+    /* reset batch errors */
+
+    CHECK(OcilibStatementBatchErrorClear(stmt))
+
+    /* check bind objects for updating their null indicator status */
+
+    CHECK(OcilibStatementBindCheckAll(stmt))
+
+    /* check current resultsets */
+
+    if (stmt->rsts)
+    {
+        /* resultsets are freed before any prepare operations.
+           So, if we got ones here, it means the same SQL order
+           is re-executed */
+
+        if (OCI_CST_SELECT == stmt->type && stmt->rsts[0] && stmt->rsts[0]->fetch_mem == stmt->fetch_mem &&
+            (stmt->fetch_mem > 0 || stmt->rsts[0]->fetch_size == stmt->fetch_size))
+        {
+            /* just reinitialize the current resultset if the fetch size or budget has not changed */
+
+            CHECK(OcilibResultsetInitialize(stmt->rsts[0]))
+        }
+        else
+        {
+            /* Must free previous resultsets for 'returning into'
+               SQL orders that can produce multiple resultsets */
+
+            CHECK(OcilibStatementReleaseResultsets(stmt))
+        }
+    }
+
+    /* Oracle execute call */
+
+    const big_uint start = LIB_STATEMENT_STATS ? OcilibStatementStatsGetTime() : 0;
+
+    const sword ret = OCIStmtExecute(stmt->con->cxt, stmt->stmt, stmt->con->err, 
+                                     iters, (ub4)0, (OCISnapshot *)NULL, 
+                                     (OCISnapshot *)NULL, mode);
+
+    if (LIB_STATEMENT_STATS)
+    {
+        const big_uint elapsed = OcilibStatementStatsGetTime() - start;
+
+        big_uint bytes = 0;
+
+        for (ub2 i = 0; i < stmt->nb_ubinds; i++)
+        {
+            bytes += (big_uint) stmt->ubinds[i]->size * (iters > 0 ? iters : 1);
+        }
+
+        OcilibStatementStatsRecord(stmt, OCI_SSV_EXECUTE_COUNT, elapsed, 0, bytes);
+    }
+
+    /* check result */
+
+    boolean success = ((OCI_SUCCESS           == ret) ||
+                       (OCI_SUCCESS_WITH_INFO == ret) ||
+                       (OCI_NEED_DATA         == ret));
+    
+    /* handle no data as error only for PL/SQL statements as it results from NO_DATA_FOUND exception in PL/SQL */
+
+    if (!success && !IS_PLSQL_STMT(stmt->type))
+    {
+        success = (OCI_NO_DATA == ret);
+    }
+
+    if (OCI_SUCCESS_WITH_INFO == ret)
+    {
+        OcilibExceptionOCI(&call_context, stmt->con->err, ret);
+    }
+
+    /* on batch mode, check if any error occurred */
+
+    if (mode & OCI_BATCH_ERRORS)
+    {
+        /* build batch error list if the statement is array DML */
+
+        OcilibStatementBatchErrorInit(stmt);
+
+        if (stmt->batch)
+        {
+            success = (stmt->batch->count == 0);
+        }
+    }
+
+    /* update status on success */
+
+    if (success)
+    {
+        if (mode & OCI_PARSE_ONLY)
+        {
+            stmt->status |= OCI_STMT_PARSED;
+        }
+        else if (mode & OCI_DESCRIBE_ONLY)
+        {
+            stmt->status |= OCI_STMT_PARSED;
+            stmt->status |= OCI_STMT_DESCRIBED;
+        }
+        else
+        {
+            stmt->status |= OCI_STMT_PARSED;
+            stmt->status |= OCI_STMT_DESCRIBED;
+            stmt->status |= OCI_STMT_EXECUTED;
+
+#if OCI_VERSION_COMPILE >= OCI_12_2
+
+            if (OcilibConnectionIsVersionSupported(stmt->con, OCI_12_2) && stmt->sql_id == NULL)
+            {
+                unsigned int size_id = 0;
+
+                OcilibStringGetAttribute(stmt->con, stmt->stmt, OCI_HTYPE_STMT, 
+                                         OCI_ATTR_SQL_ID, &stmt->sql_id, &size_id);
+
+                /* an empty identifier is not kept so that a later execution can retrieve it */
+
+                if (!IS_STRING_VALID(stmt->sql_id))
+                {
+                    FREE(stmt->sql_id)
+                }
+            }
+
+#endif
+
+            /* reset binds indicators */
+
+            CHECK(OcilibStatementBindUpdateAll(stmt))
+
+            /* commit if necessary */
+
+            if (stmt->con->autocom)
+            {
+                CHECK(OcilibConnectionCommit(stmt->con))
+            }
+
+            /* check if any implicit results are available */
+
+            CHECK(OcilibStatementCheckImplicitResultsets(stmt))
+
+        }
+    }
+    else
     {
         /* get parse error position type */
 
-        /* (one of the rare OCI call not enclosed with a OCI_CALL macro ...) */
+        /* (one of the rare OCI call not enclosed with a OCI_CALL macro ...) */
+
+        OCIAttrGet((dvoid *)stmt->stmt, (ub4)OCI_HTYPE_STMT,
+                   (dvoid *)&stmt->err_pos, (ub4 *)NULL,
+                   (ub4)OCI_ATTR_PARSE_ERROR_OFFSET, stmt->con->err);
+
+        /* raise exception */
+
+        THROW(OcilibExceptionOCI, stmt->con->err, ret)
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementCreate
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_Statement * OcilibStatementCreate
+(
+    OCI_Connection *con
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ OCI_Statement*, NULL,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    /* create statement object */
+
+    OCI_Statement *stmt = NULL;
+    
+    LIST_ATOMIC_ADD(con->stmts, stmt)
+
+    CHECK_NULL(stmt)
+
+    SET_RETVAL(OcilibStatementInitialize(con, (OCI_Statement*)stmt, NULL, FALSE, NULL))
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementFree
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibStatementFree
+(
+    OCI_Statement *stmt
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+    CHECK_OBJECT_FETCHED(stmt)
+
+    /* wait for any asynchronous call running for the statement */
+
+    CHECK(OcilibConnectionWaitAsync(stmt->con, stmt))
+
+    /* keep the statement in the connection statement cache if enabled */
+
+    if (!OcilibStatementCachePark(stmt))
+    {
+        LIST_ATOMIC_REMOVE(stmt->con->stmts, stmt, OcilibStatementDispose)
+
+        FREE(stmt)
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementGetResultset
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_Resultset * OcilibStatementGetResultset
+(
+    OCI_Statement *stmt
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ OCI_Resultset*, NULL,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+    CHECK_STMT_STATUS(stmt, OCI_STMT_DESCRIBED)
+
+    OCI_Resultset *rs = NULL;
+
+    /* if the sql statement does not return a result, we just return NULL and not
+       throwing any exception
+       statements that can return a resultset are "SELECT..." and "... RETURNING INTO..."
+    */
+
+    if ((OCI_CST_SELECT == stmt->type) || (stmt->nb_rbinds > 0) || (stmt->nb_stmt > 0))
+    {
+        /* if the resultset exists, let's use it */
+
+        if (stmt->rsts && stmt->rsts[0])
+        {
+            rs = stmt->rsts[0];
+
+            /* a resultset kept from a previous prepare is checked against the new description */
+
+            if (rs->redefine)
+            {
+                boolean valid = FALSE;
+
+                CHECK(OcilibResultsetRedefine(rs, &valid))
+
+                if (!valid)
+                {
+                    CHECK(OcilibStatementReleaseResultsets(stmt))
+
+                    rs = NULL;
+                }
+            }
+        }
+
+        /* allocate resultset for select statements only */
+
+        if (NULL == rs && (OCI_CST_SELECT == stmt->type))
+        {
+            /* allocate memory for one resultset handle */
+
+            ARENA_ALLOC_DATA(stmt->con->arena, OCI_IPC_RESULTSET_ARRAY, stmt->rsts, 1)
+
+            stmt->nb_rs  = 1;
+            stmt->cur_rs = 0;
+
+            /* create resultset object */
+
+            rs = stmt->rsts[0] = OcilibResultsetCreate(stmt, stmt->fetch_size);
+        }
+
+        CHECK_NULL(rs)
+    }
+
+    SET_RETVAL(rs)
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementGetNextResultset
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_Resultset * OcilibStatementGetNextResultset
+(
+    OCI_Statement *stmt
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ OCI_Resultset*, NULL,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+    CHECK_STMT_STATUS(stmt, OCI_STMT_DESCRIBED)
+    CHECK(stmt->cur_rs < stmt->nb_rs-1)
+
+    SET_RETVAL(stmt->rsts[++stmt->cur_rs])
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementReleaseResultsets
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibStatementReleaseResultsets
+(
+    OCI_Statement *stmt
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    ub4 i;
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+
+    /* release statements for implicit resultsets */
+    if (NULL != stmt->stmts)
+    {
+        for (i = 0; i < stmt->nb_stmt; i++)
+        {
+            if (stmt->stmts[i] != NULL)
+            {
+                OcilibStatementDispose(stmt->stmts[i]);
+                FREE(stmt->stmts[i])
+            }
+        }
+
+        FREE(stmt->stmts)
+    }
+
+    /* release resultsets */
+    if (NULL != stmt->rsts)
+    {
+        for (i = 0; i < stmt->nb_rs; i++)
+        {
+            if (stmt->rsts[i] != NULL)
+            {
+                OcilibResultsetFree(stmt->rsts[i]);
+            }
+        }
+
+        FREE(stmt->rsts)
+    }
 
-        OCIAttrGet((dvoid *)stmt->stmt, (ub4)OCI_HTYPE_STMT,
-                   (dvoid *)&stmt->err_pos, (ub4 *)NULL,
-                   (ub4)OCI_ATTR_PARSE_ERROR_OFFSET, stmt->con->err);
+    SET_SUCCESS()
 
-        /* raise exception */
+    EXIT_FUNC()
+}
 
-        THROW(OcilibExceptionOCI, stmt->con->err, ret)
-    }
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementPrepare
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibStatementPrepare
+(
+    OCI_Statement *stmt,
+    const otext   *sql
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+    CHECK_PTR(OCI_IPC_STRING,    sql)
+
+    CHECK(OcilibStatementPrepareInternal(stmt, sql))
 
     SET_SUCCESS()
 
@@ -1526,273 +2421,619 @@ boolean OcilibStatementExecuteInternal
 }
 
 /* --------------------------------------------------------------------------------------------- *
- * OcilibStatementCreate
+ * OcilibStatementExecute
  * --------------------------------------------------------------------------------------------- */
 
-OCI_Statement * OcilibStatementCreate
+boolean OcilibStatementExecute
 (
-    OCI_Connection *con
+    OCI_Statement *stmt
 )
 {
     ENTER_FUNC
     (
-        /* returns */ OCI_Statement*, NULL,
-        /* context */ OCI_IPC_CONNECTION, con
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
     )
 
-    CHECK_PTR(OCI_IPC_CONNECTION, con)
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+    CHECK_STMT_STATUS(stmt, OCI_STMT_PREPARED)
 
-    /* create statement object */
+    CHECK(OcilibStatementExecuteInternal(stmt, OCI_DEFAULT))
 
-    OCI_Statement *stmt = NULL;
-    
-    LIST_ATOMIC_ADD(con->stmts, stmt)
+    SET_SUCCESS()
 
-    CHECK_NULL(stmt)
+    EXIT_FUNC()
+}
 
-    SET_RETVAL(OcilibStatementInitialize(con, (OCI_Statement*)stmt, NULL, FALSE, NULL))
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementExecuteStmt
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibStatementExecuteStmt
+(
+    OCI_Statement *stmt,
+    const otext   *sql
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+    CHECK_PTR(OCI_IPC_STRING,    sql)
+
+    CHECK(OcilibStatementPrepareInternal(stmt, sql))
+    CHECK(OcilibStatementExecuteInternal(stmt, OCI_DEFAULT))
+
+    SET_SUCCESS()
 
     EXIT_FUNC()
 }
 
 /* --------------------------------------------------------------------------------------------- *
- * OcilibStatementFree
+ * OcilibStatementExecuteAsync
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibStatementExecuteAsync
+(
+    OCI_Statement     *stmt,
+    POCI_ASYNC_HANDLER handler,
+    void              *ctx
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+    CHECK_STMT_STATUS(stmt, OCI_STMT_PREPARED)
+
+    CHECK(OcilibConnectionRunAsync(stmt->con, OCI_ACT_EXECUTE, stmt, NULL, handler, ctx))
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementGetAsyncStatus
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int OcilibStatementGetAsyncStatus
+(
+    OCI_Statement *stmt
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ unsigned int, OCI_ACS_NONE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+
+    SET_RETVAL(OcilibConnectionGetAsyncStatus(stmt->con, stmt))
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementWaitAsync
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibStatementWaitAsync
+(
+    OCI_Statement *stmt
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+
+    CHECK(OcilibConnectionWaitAsync(stmt->con, stmt))
+
+    /* return the result of the last call if it was run for this statement */
+
+    SET_RETVAL(NULL != stmt->con->async && stmt == stmt->con->async->stmt && stmt->con->async->result)
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementExecuteArrayStream
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibStatementExecuteArrayStream
+(
+    OCI_Statement  *stmt,
+    POCI_ARRAY_FILL fill,
+    void           *ctx
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    OCI_BatchErrors *batch = NULL;
+
+    ub4 allocated = 0;
+    ub4 offset    = 0;
+    ub4 chunk     = 0;
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+    CHECK_PTR(OCI_IPC_PROC,      fill)
+    CHECK_STMT_STATUS(stmt, OCI_STMT_PREPARED)
+
+    /* the chunk size is the array size the binds have been allocated with */
+
+    chunk = stmt->nb_iters_init;
+
+    /* array DML errors of all chunks are reported, thus force batch errors mode */
+
+    const ub4 mode = IS_PLSQL_STMT(stmt->type) ? OCI_DEFAULT : OCI_BATCH_ERRORS;
+
+    CHECK(OcilibStatementBatchErrorClear(stmt))
+
+    for (;;)
+    {
+        stmt->nb_iters = chunk;
+
+        const ub4 size = (ub4) fill(stmt, (unsigned int) offset, (unsigned int) chunk, ctx);
+
+        if (0 == size)
+        {
+            break;
+        }
+
+        CHECK_BOUND(size, 1, chunk)
+
+        stmt->nb_iters = size;
+
+        if (!OcilibStatementExecuteInternal(stmt, mode))
+        {
+            /* only batch errors let the next chunks to be executed */
+
+            CHECK_NULL(stmt->batch)
+
+            /* move chunk errors to the stream error list with global row offsets */
+
+            if (NULL == batch)
+            {
+                ARENA_ALLOC_DATA(stmt->con->arena, OCI_IPC_BATCH_ERRORS, batch, 1)
+            }
+
+            REALLOC_DATA(OCI_IPC_ERROR, batch->errs, batch->count + stmt->batch->count,
+                         allocated, batch->count + stmt->batch->count)
+
+            for (ub4 i = 0; i < stmt->batch->count; i++)
+            {
+                OCI_Error *err = &batch->errs[batch->count++];
+
+                *err      = stmt->batch->errs[i];
+                err->row += offset;
+            }
+
+            stmt->batch->count = 0;
+        }
+
+        offset += size;
+    }
+
+    SET_RETVAL(NULL == batch)
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (NULL != stmt)
+        {
+            if (chunk > 0)
+            {
+                stmt->nb_iters = chunk;
+            }
+
+            if (NULL != batch)
+            {
+                OcilibStatementBatchErrorClear(stmt);
+
+                stmt->batch = batch;
+            }
+        }
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementBatchIsNameChar
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean OcilibStatementBatchIsNameChar
+(
+    otext c
+)
+{
+    return ((c >= OTEXT('a') && c <= OTEXT('z')) ||
+            (c >= OTEXT('A') && c <= OTEXT('Z')) ||
+            (c >= OTEXT('0') && c <= OTEXT('9')) ||
+            OTEXT('_') == c || OTEXT('$') == c || OTEXT('#') == c);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementBatchCopySql
+ * --------------------------------------------------------------------------------------------- */
+
+static otext * OcilibStatementBatchCopySql
+(
+    otext       *dst,
+    const otext *sql,
+    unsigned int index
+)
+{
+    otext prefix[OCI_SIZE_FORMAT + 1];
+
+    const int prefix_len = OcilibStringFormat(prefix, OCI_SIZE_FORMAT, OTEXT("s%u_"), index);
+
+    const otext *end = sql + ostrlen(sql);
+
+    otext quote = 0;
+
+    /* remove trailing separators */
+
+    while (end > sql && (OTEXT(' ')  == end[-1] || OTEXT('\t') == end[-1] ||
+                         OTEXT('\r') == end[-1] || OTEXT('\n') == end[-1] ||
+                         OTEXT(';')  == end[-1]))
+    {
+        end--;
+    }
+
+    /* copy the statement, renaming placeholders outside literals and comments */
+
+    for (const otext *p = sql; p < end; p++)
+    {
+        *dst++ = *p;
+
+        if (0 != quote)
+        {
+            if (OTEXT('*') == quote && OTEXT('*') == p[0] && OTEXT('/') == p[1])
+            {
+                *dst++ = *++p;
+                quote  = 0;
+            }
+            else if (OTEXT('*') != quote && quote == p[0])
+            {
+                quote = 0;
+            }
+        }
+        else if (OTEXT('\'') == p[0] || OTEXT('"') == p[0])
+        {
+            quote = p[0];
+        }
+        else if (OTEXT('-') == p[0] && OTEXT('-') == p[1])
+        {
+            *dst++ = *++p;
+            quote  = OTEXT('\n');
+        }
+        else if (OTEXT('/') == p[0] && OTEXT('*') == p[1])
+        {
+            *dst++ = *++p;
+            quote  = OTEXT('*');
+        }
+        else if (OTEXT(':') == p[0] && OcilibStatementBatchIsNameChar(p[1]))
+        {
+            ostrcpy(dst, prefix);
+            dst += prefix_len;
+        }
+    }
+
+    /* end a trailing line comment so it does not hide the text that follows */
+
+    if (OTEXT('\n') == quote)
+    {
+        *dst++ = OTEXT('\n');
+    }
+
+    *dst = 0;
+
+    return dst;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementBatchBind
  * --------------------------------------------------------------------------------------------- */
 
-boolean OcilibStatementFree
+static boolean OcilibStatementBatchBind
 (
-    OCI_Statement *stmt
+    OCI_Statement *batch,
+    OCI_Bind      *bnd,
+    const otext   *name
 )
 {
     ENTER_FUNC
     (
         /* returns */ boolean, FALSE,
-        /* context */ OCI_IPC_STATEMENT, stmt
+        /* context */ OCI_IPC_STATEMENT, batch
     )
 
-    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
-    CHECK_OBJECT_FETCHED(stmt)
+    OCIBind *handle = NULL;
+    dbtext  *dbstr  = NULL;
+    int      dbsize = -1;
+
+    CHECK_PTR(OCI_IPC_STATEMENT, batch)
+    CHECK_PTR(OCI_IPC_BIND,      bnd)
+
+    /* the statement bind buffers, already filled from the user variables,
+       are directly bound to the PL/SQL block placeholder */
+
+    dbstr = OcilibStringGetDBString(name, &dbsize);
+
+    CHECK_OCI
+    (
+        batch->con->err,
+        OCIBindByName,
+        batch->stmt,
+        &handle,
+        batch->con->err,
+        (OraText *)dbstr,
+        (sb4)dbsize,
+        (void *)bnd->buffer.data,
+        bnd->size,
+        bnd->code,
+        (void *)bnd->buffer.inds,
+        (ub2 *)bnd->buffer.lens,
+        (ub2 *)NULL,
+        (ub4)0,
+        (ub4 *)NULL,
+        (ub4)OCI_DEFAULT
+    )
+
+    if (SQLT_NTY == bnd->code || SQLT_REF == bnd->code)
+    {
+        CHECK_OCI
+        (
+            batch->con->err,
+            OCIBindObject,
+            handle,
+            batch->con->err,
+            (OCIType *)bnd->typinf->tdo,
+            (void **)bnd->buffer.data,
+            (ub4 *)NULL,
+            (void **)bnd->buffer.obj_inds,
+            (ub4 *)NULL
+        )
+    }
 
-    LIST_ATOMIC_REMOVE(stmt->con->stmts, stmt, OcilibStatementDispose)
+    if ((OCI_CDT_LOB == bnd->type) && (OCI_NCLOB == bnd->subtype))
+    {
+        ub1 csfrm = SQLCS_NCHAR;
 
-    FREE(stmt)
+        CHECK_ATTRIB_SET
+        (
+            OCI_HTYPE_BIND, OCI_ATTR_CHARSET_FORM,
+            handle, &csfrm, sizeof(csfrm),
+            batch->con->err
+        )
+    }
 
     SET_SUCCESS()
 
-    EXIT_FUNC()
+    CLEANUP_AND_EXIT_FUNC
+    (
+        OcilibStringReleaseDBString(dbstr);
+    )
 }
 
 /* --------------------------------------------------------------------------------------------- *
- * OcilibStatementGetResultset
+ * OcilibStatementExecuteBatch
  * --------------------------------------------------------------------------------------------- */
 
-OCI_Resultset * OcilibStatementGetResultset
+boolean OcilibStatementExecuteBatch
 (
-    OCI_Statement *stmt
+    OCI_Connection *con,
+    OCI_Statement **stmts,
+    unsigned int    count,
+    unsigned int   *rows
 )
 {
     ENTER_FUNC
     (
-        /* returns */ OCI_Resultset*, NULL,
-        /* context */ OCI_IPC_STATEMENT, stmt
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_CONNECTION, con
     )
 
-    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
-    CHECK_STMT_STATUS(stmt, OCI_STMT_DESCRIBED)
+    OCI_Statement *batch   = NULL;
+    otext         *sql     = NULL;
+    otext         *msgs    = NULL;
+    int           *counts  = NULL;
+    int           *codes   = NULL;
+    size_t         size    = 0;
+    boolean        success = TRUE;
 
-    OCI_Resultset *rs = NULL;
+    otext name[OCI_SIZE_BUFFER + 1];
 
-    /* if the sql statement does not return a result, we just return NULL and not
-       throwing any exception
-       statements that can return a resultset are "SELECT..." and "... RETURNING INTO..."
-    */
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+    CHECK_PTR(OCI_IPC_VOID,       stmts)
+    CHECK_BOUND(count, 1, OCI_BIND_MAX / 3)
 
-    if ((OCI_CST_SELECT == stmt->type) || (stmt->nb_rbinds > 0) || (stmt->nb_stmt > 0))
+    /* check the statements and compute the PL/SQL block size */
+
+    size = 16;
+
+    for (unsigned int i = 0; i < count; i++)
     {
-        /* if the resultset exists, let's use it */
+        OCI_Statement *stmt = stmts[i];
 
-        if (stmt->rsts && stmt->rsts[0])
+        CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+        CHECK_STMT_STATUS(stmt, OCI_STMT_PREPARED)
+
+        if (stmt->con != con)
         {
-            rs = stmt->rsts[0];
+            THROW(OcilibExceptionArgInvalidValue, OTEXT("Statement"), i + 1)
         }
 
-        /* allocate resultset for select statements only */
-
-        if (NULL == rs && (OCI_CST_SELECT == stmt->type))
+        if (!IS_DML_STMT(stmt->type))
         {
-            /* allocate memory for one resultset handle */
+            THROW(OcilibExceptionArgInvalidValue, OTEXT("Statement type"), stmt->type)
+        }
 
-            ALLOC_DATA(OCI_IPC_RESULTSET_ARRAY, stmt->rsts, 1)
+        if (OCI_BIND_BY_NAME != stmt->bind_mode)
+        {
+            THROW(OcilibExceptionArgInvalidValue, OTEXT("Bind mode"), stmt->bind_mode)
+        }
 
-            stmt->nb_rs  = 1;
-            stmt->cur_rs = 0;
+        if (stmt->bind_array || stmt->nb_rbinds > 0)
+        {
+            THROW(OcilibExceptionArgInvalidValue, OTEXT("Bind array size"), stmt->nb_iters_init)
+        }
 
-            /* create resultset object */
+        for (ub4 j = 0; j < stmt->nb_ubinds; j++)
+        {
+            const OCI_Bind *bnd = stmt->ubinds[j];
 
-            rs = stmt->rsts[0] = OcilibResultsetCreate(stmt, stmt->fetch_size);
+            if (OCI_CDT_LONG == bnd->type || OCI_CDT_CURSOR == bnd->type)
+            {
+                THROW(OcilibExceptionDatatypeNotSupported, bnd->code)
+            }
         }
 
-        CHECK_NULL(rs)
+        /* statement text + renamed placeholders + exception block */
+
+        size += ostrlen(stmt->sql) + 192;
+
+        for (const otext *p = stmt->sql; *p; p++)
+        {
+            if (OTEXT(':') == *p)
+            {
+                size += 12;
+            }
+        }
     }
 
-    SET_RETVAL(rs)
+    ALLOC_DATA(OCI_IPC_STRING, sql,    size + 1)
+    ALLOC_DATA(OCI_IPC_STRING, msgs,   count * (OCI_SIZE_BUFFER + 1))
+    ALLOC_DATA(OCI_IPC_INT,    counts, count)
+    ALLOC_DATA(OCI_IPC_INT,    codes,  count)
 
-    EXIT_FUNC()
-}
+    /* build the PL/SQL block: each statement runs in its own sub block catching its errors */
 
-/* --------------------------------------------------------------------------------------------- *
- * OcilibStatementGetNextResultset
- * --------------------------------------------------------------------------------------------- */
+    otext *p = sql;
 
-OCI_Resultset * OcilibStatementGetNextResultset
-(
-    OCI_Statement *stmt
-)
-{
-    ENTER_FUNC
-    (
-        /* returns */ OCI_Resultset*, NULL,
-        /* context */ OCI_IPC_STATEMENT, stmt
-    )
+    ostrcpy(p, OTEXT("begin\n"));
+    p += ostrlen(p);
 
-    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
-    CHECK_STMT_STATUS(stmt, OCI_STMT_DESCRIBED)
-    CHECK(stmt->cur_rs < stmt->nb_rs-1)
+    for (unsigned int i = 0; i < count; i++)
+    {
+        ostrcpy(p, OTEXT("begin "));
+        p += ostrlen(p);
 
-    SET_RETVAL(stmt->rsts[++stmt->cur_rs])
+        p = OcilibStatementBatchCopySql(p, stmts[i]->sql, i + 1);
 
-    EXIT_FUNC()
-}
+        p += OcilibStringFormat(p, (int) (size - (size_t) (p - sql)),
+                                OTEXT("; :r%u := sql%%rowcount; exception when others then ")
+                                OTEXT(":c%u := sqlcode; :m%u := substr(sqlerrm, 1, %d); end;\n"),
+                                i + 1, i + 1, i + 1, OCI_SIZE_BUFFER);
+    }
 
-/* --------------------------------------------------------------------------------------------- *
- * OcilibStatementReleaseResultsets
- * --------------------------------------------------------------------------------------------- */
+    ostrcpy(p, OTEXT("end;"));
 
-boolean OcilibStatementReleaseResultsets
-(
-    OCI_Statement *stmt
-)
-{
-    ENTER_FUNC
-    (
-        /* returns */ boolean, FALSE,
-        /* context */ OCI_IPC_STATEMENT, stmt
-    )
+    batch = OcilibStatementCreate(con);
+    CHECK_NULL(batch)
 
-    ub4 i;
+    CHECK(OcilibStatementPrepareInternal(batch, sql))
 
-    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+    /* bind the statements variables and the result placeholders */
 
-    /* release statements for implicit resultsets */
-    if (NULL != stmt->stmts)
+    for (unsigned int i = 0; i < count; i++)
     {
-        for (i = 0; i < stmt->nb_stmt; i++)
-        {
-            if (stmt->stmts[i] != NULL)
-            {
-                OcilibStatementDispose(stmt->stmts[i]);
-                FREE(stmt->stmts[i])
-            }
-        }
+        OCI_Statement *stmt = stmts[i];
 
-        FREE(stmt->stmts)
-    }
+        CHECK(OcilibStatementBindCheckAll(stmt))
 
-    /* release resultsets */
-    if (NULL != stmt->rsts)
-    {
-        for (i = 0; i < stmt->nb_rs; i++)
+        for (ub4 j = 0; j < stmt->nb_ubinds; j++)
         {
-            if (stmt->rsts[i] != NULL)
-            {
-                OcilibResultsetFree(stmt->rsts[i]);
-            }
-        }
-
-        FREE(stmt->rsts)
-    }
+            OCI_Bind *bnd = stmt->ubinds[j];
 
-    SET_SUCCESS()
+            const int len = OcilibStringFormat(name, OCI_SIZE_BUFFER, OTEXT(":s%u_"), i + 1);
 
-    EXIT_FUNC()
-}
+            ostrncpy(name + len, OTEXT(':') == bnd->name[0] ? bnd->name + 1 : bnd->name,
+                     (size_t) (OCI_SIZE_BUFFER - len));
 
-/* --------------------------------------------------------------------------------------------- *
- * OcilibStatementPrepare
- * --------------------------------------------------------------------------------------------- */
+            name[OCI_SIZE_BUFFER] = 0;
 
-boolean OcilibStatementPrepare
-(
-    OCI_Statement *stmt,
-    const otext   *sql
-)
-{
-    ENTER_FUNC
-    (
-        /* returns */ boolean, FALSE,
-        /* context */ OCI_IPC_STATEMENT, stmt
-    )
+            CHECK(OcilibStatementBatchBind(batch, bnd, name))
+        }
 
-    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
-    CHECK_PTR(OCI_IPC_STRING,    sql)
+        OcilibStringFormat(name, OCI_SIZE_BUFFER, OTEXT(":r%u"), i + 1);
+        CHECK(OcilibStatementBindInt(batch, name, &counts[i]))
 
-    CHECK(OcilibStatementPrepareInternal(stmt, sql))
+        OcilibStringFormat(name, OCI_SIZE_BUFFER, OTEXT(":c%u"), i + 1);
+        CHECK(OcilibStatementBindInt(batch, name, &codes[i]))
 
-    SET_SUCCESS()
+        OcilibStringFormat(name, OCI_SIZE_BUFFER, OTEXT(":m%u"), i + 1);
+        CHECK(OcilibStatementBindString(batch, name, &msgs[i * (OCI_SIZE_BUFFER + 1)], OCI_SIZE_BUFFER))
+    }
 
-    EXIT_FUNC()
-}
+    /* single round trip */
 
-/* --------------------------------------------------------------------------------------------- *
- * OcilibStatementExecute
- * --------------------------------------------------------------------------------------------- */
+    CHECK(OcilibStatementExecuteInternal(batch, OCI_DEFAULT))
 
-boolean OcilibStatementExecute
-(
-    OCI_Statement *stmt
-)
-{
-    ENTER_FUNC
-    (
-        /* returns */ boolean, FALSE,
-        /* context */ OCI_IPC_STATEMENT, stmt
-    )
+    /* report results and errors to each statement */
 
-    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
-    CHECK_STMT_STATUS(stmt, OCI_STMT_PREPARED)
+    for (unsigned int i = 0; i < count; i++)
+    {
+        OCI_Statement *stmt = stmts[i];
 
-    CHECK(OcilibStatementExecuteInternal(stmt, OCI_DEFAULT))
+        CHECK(OcilibStatementBatchErrorClear(stmt))
+        CHECK(OcilibStatementBindUpdateAll(stmt))
 
-    SET_SUCCESS()
+        if (NULL != rows)
+        {
+            rows[i] = (0 == codes[i]) ? (unsigned int) counts[i] : 0;
+        }
 
-    EXIT_FUNC()
-}
+        if (0 != codes[i])
+        {
+            success = FALSE;
 
-/* --------------------------------------------------------------------------------------------- *
- * OcilibStatementExecuteStmt
- * --------------------------------------------------------------------------------------------- */
+            ARENA_ALLOC_DATA(stmt->con->arena, OCI_IPC_BATCH_ERRORS, stmt->batch, 1)
+            ALLOC_DATA(OCI_IPC_ERROR, stmt->batch->errs, 1)
 
-boolean OcilibStatementExecuteStmt
-(
-    OCI_Statement *stmt,
-    const otext   *sql
-)
-{
-    ENTER_FUNC
-    (
-        /* returns */ boolean, FALSE,
-        /* context */ OCI_IPC_STATEMENT, stmt
-    )
+            stmt->batch->count = 1;
 
-    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
-    CHECK_PTR(OCI_IPC_STRING,    sql)
+            OcilibErrorSet
+            (
+                &stmt->batch->errs[0],
+                OCI_ERR_ORACLE,
+                codes[i] < 0 ? -codes[i] : codes[i],
+                (void *) stmt,
+                OCI_IPC_STATEMENT,
+                call_context.location,
+                &msgs[i * (OCI_SIZE_BUFFER + 1)],
+                i + 1
+            );
+        }
+    }
 
-    CHECK(OcilibStatementPrepareInternal(stmt, sql))
-    CHECK(OcilibStatementExecuteInternal(stmt, OCI_DEFAULT))
+    SET_RETVAL(success)
 
-    SET_SUCCESS()
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (NULL != batch)
+        {
+            OcilibStatementFree(batch);
+        }
 
-    EXIT_FUNC()
+        FREE(sql)
+        FREE(msgs)
+        FREE(counts)
+        FREE(codes)
+    )
 }
 
 /* --------------------------------------------------------------------------------------------- *
@@ -1874,12 +3115,14 @@ boolean OcilibStatementPrepareFmt
 
     va_list first_pass_args;
     va_list second_pass_args;
+    va_list bind_pass_args;
 
     CHECK_PTR(OCI_IPC_STATEMENT, stmt)
     CHECK_PTR(OCI_IPC_STRING,    sql)
 
     va_copy(first_pass_args,  args);
     va_copy(second_pass_args, args);
+    va_copy(bind_pass_args,   args);
 
     /* first, get buffer size */
 
@@ -1898,6 +3141,7 @@ boolean OcilibStatementPrepareFmt
             /* parse buffer */
 
             CHECK(OcilibStatementPrepareInternal(stmt, sql_fmt))
+            CHECK(OcilibFormatBindSql(stmt, sql, &bind_pass_args))
         }
     }
 
@@ -1907,6 +3151,7 @@ boolean OcilibStatementPrepareFmt
     (
         va_end(first_pass_args);
         va_end(second_pass_args);
+        va_end(bind_pass_args);
 
         FREE(sql_fmt)
     )
@@ -1931,6 +3176,7 @@ boolean OcilibStatementExecuteStmtFmt
 
     va_list first_pass_args;
     va_list second_pass_args;
+    va_list bind_pass_args;
 
     otext* sql_fmt = NULL;
 
@@ -1939,6 +3185,7 @@ boolean OcilibStatementExecuteStmtFmt
 
     va_copy(first_pass_args,  args);
     va_copy(second_pass_args, args);
+    va_copy(bind_pass_args,   args);
 
     /* first, get buffer size */
 
@@ -1958,6 +3205,7 @@ boolean OcilibStatementExecuteStmtFmt
             /* prepare and execute SQL buffer */
 
             CHECK(OcilibStatementPrepareInternal(stmt, sql_fmt))
+            CHECK(OcilibFormatBindSql(stmt, sql, &bind_pass_args))
             CHECK(OcilibStatementExecuteInternal(stmt, OCI_DEFAULT))
         }
     }
@@ -1968,6 +3216,7 @@ boolean OcilibStatementExecuteStmtFmt
     (
         va_end(first_pass_args);
         va_end(second_pass_args);
+        va_end(bind_pass_args);
 
         FREE(sql_fmt)
     )
@@ -1992,6 +3241,7 @@ boolean OcilibStatementParseFmt
 
     va_list first_pass_args;
     va_list second_pass_args;
+    va_list bind_pass_args;
 
     otext* sql_fmt = NULL;
 
@@ -2000,6 +3250,7 @@ boolean OcilibStatementParseFmt
 
     va_copy(first_pass_args,  args);
     va_copy(second_pass_args, args);
+    va_copy(bind_pass_args,   args);
 
     /* first, get buffer size */
 
@@ -2018,6 +3269,7 @@ boolean OcilibStatementParseFmt
             /* prepare and execute SQL buffer */
 
             CHECK(OcilibStatementPrepareInternal(stmt, sql_fmt))
+            CHECK(OcilibFormatBindSql(stmt, sql, &bind_pass_args))
             CHECK(OcilibStatementExecuteInternal(stmt, OCI_PARSE_ONLY))
         }
     }
@@ -2028,6 +3280,7 @@ boolean OcilibStatementParseFmt
     (
         va_end(first_pass_args);
         va_end(second_pass_args);
+        va_end(bind_pass_args);
 
         FREE(sql_fmt)
     )
@@ -2052,6 +3305,7 @@ boolean OcilibStatementDescribeFmt
 
     va_list first_pass_args;
     va_list second_pass_args;
+    va_list bind_pass_args;
 
     otext* sql_fmt = NULL;
 
@@ -2060,6 +3314,7 @@ boolean OcilibStatementDescribeFmt
 
     va_copy(first_pass_args,  args);
     va_copy(second_pass_args, args);
+    va_copy(bind_pass_args,   args);
 
     /* first, get buffer size */
 
@@ -2078,6 +3333,7 @@ boolean OcilibStatementDescribeFmt
             /* prepare and execute SQL buffer */
 
             CHECK(OcilibStatementPrepareInternal(stmt, sql_fmt))
+            CHECK(OcilibFormatBindSql(stmt, sql, &bind_pass_args))
             CHECK(OcilibStatementExecuteInternal(stmt, OCI_DESCRIBE_ONLY))
         }
     }
@@ -2088,6 +3344,7 @@ boolean OcilibStatementDescribeFmt
     (
         va_end(first_pass_args);
         va_end(second_pass_args);
+        va_end(bind_pass_args);
 
         FREE(sql_fmt)
     )
@@ -2413,7 +3670,8 @@ boolean OcilibStatementBindBigInt
 {
     BIND_CALL_NULL_ALLOWED
     (
-        OCI_IPC_BIGINT, sizeof(OCINumber), OCI_CDT_NUMERIC, SQLT_VNU, OCI_NUM_BIGINT, NULL, 0
+        OCI_IPC_BIGINT, BIGINT_BIND_SIZE(stmt), OCI_CDT_NUMERIC,
+        BIGINT_BIND_CODE(stmt, SQLT_INT), OCI_NUM_BIGINT, NULL, 0
     )
 }
 
@@ -2431,7 +3689,8 @@ boolean OcilibStatementBindArrayOfBigInts
 {
     BIND_CALL_NULL_ALLOWED
     (
-        OCI_IPC_BIGINT, sizeof(OCINumber), OCI_CDT_NUMERIC, SQLT_VNU, OCI_NUM_BIGINT, NULL, nbelem
+        OCI_IPC_BIGINT, BIGINT_BIND_SIZE(stmt), OCI_CDT_NUMERIC,
+        BIGINT_BIND_CODE(stmt, SQLT_INT), OCI_NUM_BIGINT, NULL, nbelem
     )
 }
 
@@ -2448,7 +3707,8 @@ boolean OcilibStatementBindUnsignedBigInt
 {
     BIND_CALL_NULL_ALLOWED
     (
-        OCI_IPC_BIGINT, sizeof(OCINumber), OCI_CDT_NUMERIC, SQLT_VNU, OCI_NUM_BIGUINT, NULL, 0
+        OCI_IPC_BIGINT, BIGINT_BIND_SIZE(stmt), OCI_CDT_NUMERIC,
+        BIGINT_BIND_CODE(stmt, SQLT_UIN), OCI_NUM_BIGUINT, NULL, 0
     )
 }
 
@@ -2466,7 +3726,8 @@ boolean OcilibStatementBindArrayOfUnsignedBigInts
 {
     BIND_CALL_NULL_ALLOWED
     (
-        OCI_IPC_BIGINT, sizeof(OCINumber), OCI_CDT_NUMERIC, SQLT_VNU, OCI_NUM_BIGUINT, NULL, nbelem
+        OCI_IPC_BIGINT, BIGINT_BIND_SIZE(stmt), OCI_CDT_NUMERIC,
+        BIGINT_BIND_CODE(stmt, SQLT_UIN), OCI_NUM_BIGUINT, NULL, nbelem
     )
 }
 
@@ -3775,16 +5036,86 @@ boolean OcilibStatementSetFetchMode
         }
     }
 
-    SET_SUCCESS()
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementGetFetchMode
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int OcilibStatementGetFetchMode
+(
+    OCI_Statement *stmt
+)
+{
+    GET_PROP
+    (
+        unsigned int, OCI_UNKNOWN,
+        OCI_IPC_STATEMENT, stmt,
+        exec_mode
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementSetBindMode
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibStatementSetBindMode
+(
+    OCI_Statement *stmt,
+    unsigned int   mode
+)
+{
+    SET_PROP_ENUM
+    (
+        /* handle */ OCI_IPC_STATEMENT, stmt,
+        /* member */ bind_mode, ub1,
+        /* value  */ mode, BindModeValues, OTEXT("Bind Mode")
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementGetBindMode
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int OcilibStatementGetBindMode
+(
+    OCI_Statement *stmt
+)
+{
+    GET_PROP
+    (
+        unsigned int, OCI_UNKNOWN,
+        OCI_IPC_STATEMENT, stmt,
+        bind_mode
+    )
+}
 
-    EXIT_FUNC()
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementSetBindAllocation
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibStatementSetBindAllocation
+(
+    OCI_Statement *stmt,
+    unsigned int   mode
+)
+{
+    SET_PROP_ENUM
+    (
+        /* handle */ OCI_IPC_STATEMENT, stmt,
+        /* member */ bind_alloc_mode, ub1,
+        /* value  */ mode, BindAllocationValues, OTEXT("Bind Allocation")
+    )
 }
 
 /* --------------------------------------------------------------------------------------------- *
- * OcilibStatementGetFetchMode
+ * OcilibStatementGetBindAllocation
  * --------------------------------------------------------------------------------------------- */
 
-unsigned int OcilibStatementGetFetchMode
+unsigned int OcilibStatementGetBindAllocation
 (
     OCI_Statement *stmt
 )
@@ -3793,15 +5124,15 @@ unsigned int OcilibStatementGetFetchMode
     (
         unsigned int, OCI_UNKNOWN,
         OCI_IPC_STATEMENT, stmt,
-        exec_mode
+        bind_alloc_mode
     )
 }
 
 /* --------------------------------------------------------------------------------------------- *
- * OcilibStatementSetBindMode
+ * OcilibStatementSetBindBigIntMode
  * --------------------------------------------------------------------------------------------- */
 
-boolean OcilibStatementSetBindMode
+boolean OcilibStatementSetBindBigIntMode
 (
     OCI_Statement *stmt,
     unsigned int   mode
@@ -3810,16 +5141,16 @@ boolean OcilibStatementSetBindMode
     SET_PROP_ENUM
     (
         /* handle */ OCI_IPC_STATEMENT, stmt,
-        /* member */ bind_mode, ub1,
-        /* value  */ mode, BindModeValues, OTEXT("Bind Mode")
+        /* member */ bind_bigint_mode, unsigned int,
+        /* value  */ mode, BindBigIntModeValues, OTEXT("Big Integer Bind Mode")
     )
 }
 
 /* --------------------------------------------------------------------------------------------- *
- * OcilibStatementGetBindMode
+ * OcilibStatementGetBindBigIntMode
  * --------------------------------------------------------------------------------------------- */
 
-unsigned int OcilibStatementGetBindMode
+unsigned int OcilibStatementGetBindBigIntMode
 (
     OCI_Statement *stmt
 )
@@ -3828,15 +5159,15 @@ unsigned int OcilibStatementGetBindMode
     (
         unsigned int, OCI_UNKNOWN,
         OCI_IPC_STATEMENT, stmt,
-        bind_mode
+        bind_bigint_mode
     )
 }
 
 /* --------------------------------------------------------------------------------------------- *
- * OcilibStatementSetBindAllocation
+ * OcilibStatementSetFormatParameterMode
  * --------------------------------------------------------------------------------------------- */
 
-boolean OcilibStatementSetBindAllocation
+boolean OcilibStatementSetFormatParameterMode
 (
     OCI_Statement *stmt,
     unsigned int   mode
@@ -3845,16 +5176,16 @@ boolean OcilibStatementSetBindAllocation
     SET_PROP_ENUM
     (
         /* handle */ OCI_IPC_STATEMENT, stmt,
-        /* member */ bind_alloc_mode, ub1,
-        /* value  */ mode, BindAllocationValues, OTEXT("Bind Allocation")
+        /* member */ fmt_param_mode, unsigned int,
+        /* value  */ mode, FormatParameterModeValues, OTEXT("Format Parameter Mode")
     )
 }
 
 /* --------------------------------------------------------------------------------------------- *
- * OcilibStatementGetBindAllocation
+ * OcilibStatementGetFormatParameterMode
  * --------------------------------------------------------------------------------------------- */
 
-unsigned int OcilibStatementGetBindAllocation
+unsigned int OcilibStatementGetFormatParameterMode
 (
     OCI_Statement *stmt
 )
@@ -3863,7 +5194,7 @@ unsigned int OcilibStatementGetBindAllocation
     (
         unsigned int, OCI_UNKNOWN,
         OCI_IPC_STATEMENT, stmt,
-        bind_alloc_mode
+        fmt_param_mode
     )
 }
 
@@ -4021,6 +5352,95 @@ unsigned int OcilibStatementGetPrefetchMemory
     )
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementSetFetchMemory
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibStatementSetFetchMemory
+(
+    OCI_Statement *stmt,
+    unsigned int   size
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+
+    stmt->fetch_mem = size;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementGetFetchMemory
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int OcilibStatementGetFetchMemory
+(
+    OCI_Statement *stmt
+)
+{
+    GET_PROP
+    (
+        unsigned int, 0,
+        OCI_IPC_STATEMENT, stmt,
+        fetch_mem
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementSetReadAhead
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibStatementSetReadAhead
+(
+    OCI_Statement *stmt,
+    boolean        value
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+
+    if (value)
+    {
+        CHECK_THREAD_ENABLED()
+    }
+
+    stmt->read_ahead = value;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementGetReadAhead
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibStatementGetReadAhead
+(
+    OCI_Statement *stmt
+)
+{
+    GET_PROP
+    (
+        boolean, FALSE,
+        OCI_IPC_STATEMENT, stmt,
+        read_ahead
+    )
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OcilibStatementSetPieceSize
  * --------------------------------------------------------------------------------------------- */
@@ -4419,3 +5839,233 @@ unsigned int OcilibStatementGetBatchErrorCount
 
     EXIT_FUNC()
 }
+
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementStatsGetTime
+ * --------------------------------------------------------------------------------------------- */
+
+big_uint OcilibStatementStatsGetTime
+(
+    void
+)
+{
+#ifdef _WINDOWS
+
+    LARGE_INTEGER freq;
+    LARGE_INTEGER counter;
+
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&counter);
+
+    return (big_uint) (counter.QuadPart / freq.QuadPart) * 1000000 +
+           (big_uint) (counter.QuadPart % freq.QuadPart) * 1000000 / (big_uint) freq.QuadPart;
+
+#else
+
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (big_uint) ts.tv_sec * 1000000 + (big_uint) ts.tv_nsec / 1000;
+
+#endif
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementStatsLookup
+ * --------------------------------------------------------------------------------------------- */
+
+static OCI_SqlStats * OcilibStatementStatsLookup
+(
+    const otext *key
+)
+{
+    OCI_SqlStatsTable *table = &Env.sql_stats;
+    OCI_SqlStats      *entry = NULL;
+
+    if (NULL == table->map || NULL == key)
+    {
+        return NULL;
+    }
+
+    entry = (OCI_SqlStats *) OcilibHashGetPointer(table->map, key);
+
+    if (NULL != entry)
+    {
+        return entry;
+    }
+
+    if (table->count >= table->allocated)
+    {
+        const unsigned int allocated = table->allocated + OCI_HASH_MIN_SIZE;
+
+        OCI_SqlStats **entries = (OCI_SqlStats **) ((NULL == table->entries) ?
+            OcilibMemoryAlloc(OCI_IPC_SQL_STATS, sizeof(*entries), (size_t) allocated, TRUE) :
+            OcilibMemoryRealloc(table->entries, OCI_IPC_SQL_STATS, sizeof(*entries), (size_t) allocated, TRUE));
+
+        if (NULL == entries)
+        {
+            return NULL;
+        }
+
+        table->entries   = entries;
+        table->allocated = allocated;
+    }
+
+    entry = (OCI_SqlStats *) OcilibMemoryAlloc(OCI_IPC_SQL_STATS, sizeof(*entry), (size_t) 1, TRUE);
+
+    if (NULL == entry)
+    {
+        return NULL;
+    }
+
+    entry->key = OcilibStringDuplicate(key);
+
+    if (NULL == entry->key || !OcilibHashAddPointer(table->map, key, entry))
+    {
+        FREE(entry->key)
+        FREE(entry)
+
+        return NULL;
+    }
+
+    table->entries[table->count++] = entry;
+
+    return entry;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementStatsRecord
+ * --------------------------------------------------------------------------------------------- */
+
+void OcilibStatementStatsRecord
+(
+    OCI_Statement *stmt,
+    unsigned int   call,
+    big_uint       elapsed,
+    big_uint       rows,
+    big_uint       bytes
+)
+{
+    big_uint deltas[OCI_SSV_COUNT];
+
+    memset(deltas, 0, sizeof(deltas));
+
+    /* call is one of OCI_SSV_PREPARE_COUNT, OCI_SSV_EXECUTE_COUNT and OCI_SSV_FETCH_COUNT
+       and is immediately followed by its elapsed time value */
+
+    deltas[call - 1] = 1;
+    deltas[call]     = elapsed;
+
+    /* statements are only prepared locally while each execute and fetch call
+       is accounted as a server round trip */
+
+    if (OCI_SSV_EXECUTE_COUNT == call)
+    {
+        deltas[OCI_SSV_ROUND_TRIPS - 1] = 1;
+        deltas[OCI_SSV_BIND_BYTES  - 1] = bytes;
+    }
+    else if (OCI_SSV_FETCH_COUNT == call)
+    {
+        deltas[OCI_SSV_ROUND_TRIPS  - 1] = 1;
+        deltas[OCI_SSV_ROWS_FETCHED - 1] = rows;
+        deltas[OCI_SSV_DEFINE_BYTES - 1] = bytes;
+    }
+
+    for (unsigned int i = 0; i < OCI_SSV_COUNT; i++)
+    {
+        stmt->stats[i] += deltas[i];
+    }
+
+    /* aggregate into the environment wide entry of the statement SQL */
+
+    OCI_SqlStatsTable *table = &Env.sql_stats;
+
+    if (NULL != table->mutex)
+    {
+        OcilibMutexAcquire(table->mutex);
+    }
+
+    /* entries are keyed by SQL text that is known from the prepare call whereas the
+       sql id is only retrieved after the first execution */
+
+    if (NULL == stmt->sql_stats && IS_STRING_VALID(stmt->sql))
+    {
+        stmt->sql_stats = OcilibStatementStatsLookup(stmt->sql);
+    }
+
+    if (NULL != stmt->sql_stats)
+    {
+        for (unsigned int i = 0; i < OCI_SSV_COUNT; i++)
+        {
+            stmt->sql_stats->values[i] += deltas[i];
+        }
+    }
+
+    if (NULL != table->mutex)
+    {
+        OcilibMutexRelease(table->mutex);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementStatsRelease
+ * --------------------------------------------------------------------------------------------- */
+
+void OcilibStatementStatsRelease
+(
+    void
+)
+{
+    OCI_SqlStatsTable *table = &Env.sql_stats;
+
+    for (unsigned int i = 0; i < table->count; i++)
+    {
+        FREE(table->entries[i]->key)
+        FREE(table->entries[i])
+    }
+
+    FREE(table->entries)
+
+    table->count     = 0;
+    table->allocated = 0;
+
+    if (NULL != table->map)
+    {
+        OcilibHashFree(table->map);
+
+        table->map = NULL;
+    }
+
+    if (NULL != table->mutex)
+    {
+        OcilibMutexFree(table->mutex);
+
+        table->mutex = NULL;
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibStatementGetStats
+ * --------------------------------------------------------------------------------------------- */
+
+big_uint OcilibStatementGetStats
+(
+    OCI_Statement *stmt,
+    unsigned int   value
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ big_uint, 0,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+    CHECK_ENUM_VALUE(value, StatementStatsValues, OTEXT("Statement statistics value"))
+
+    SET_RETVAL(stmt->stats[value - 1])
+
+    EXIT_FUNC()
+}
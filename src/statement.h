@@ -34,6 +34,12 @@ OCI_SYM_LOCAL boolean OcilibStatementDispose
     OCI_Statement* stmt
 );
 
+OCI_SYM_LOCAL void OcilibStatementCachePurge
+(
+    OCI_Connection *con,
+    unsigned int    size
+);
+
 OCI_SYM_LOCAL OCI_Statement * OcilibStatementInitialize
 (
     OCI_Connection* con,
@@ -97,6 +103,38 @@ OCI_SYM_LOCAL boolean OcilibStatementExecuteStmt
     const otext  * sql
 );
 
+OCI_SYM_LOCAL boolean OcilibStatementExecuteAsync
+(
+    OCI_Statement     *stmt,
+    POCI_ASYNC_HANDLER handler,
+    void              *ctx
+);
+
+OCI_SYM_LOCAL unsigned int OcilibStatementGetAsyncStatus
+(
+    OCI_Statement *stmt
+);
+
+OCI_SYM_LOCAL boolean OcilibStatementWaitAsync
+(
+    OCI_Statement *stmt
+);
+
+OCI_SYM_LOCAL boolean OcilibStatementExecuteArrayStream
+(
+    OCI_Statement  *stmt,
+    POCI_ARRAY_FILL fill,
+    void           *ctx
+);
+
+OCI_SYM_LOCAL boolean OcilibStatementExecuteBatch
+(
+    OCI_Connection *con,
+    OCI_Statement **stmts,
+    unsigned int    count,
+    unsigned int   *rows
+);
+
 OCI_SYM_LOCAL boolean OcilibStatementParse
 (
     OCI_Statement* stmt,
@@ -652,6 +690,28 @@ OCI_SYM_LOCAL unsigned int OcilibStatementGetBindAllocation
     OCI_Statement* stmt
 );
 
+OCI_SYM_LOCAL boolean OcilibStatementSetBindBigIntMode
+(
+    OCI_Statement* stmt,
+    unsigned int   mode
+);
+
+OCI_SYM_LOCAL unsigned int OcilibStatementGetBindBigIntMode
+(
+    OCI_Statement* stmt
+);
+
+OCI_SYM_LOCAL boolean OcilibStatementSetFormatParameterMode
+(
+    OCI_Statement* stmt,
+    unsigned int   mode
+);
+
+OCI_SYM_LOCAL unsigned int OcilibStatementGetFormatParameterMode
+(
+    OCI_Statement* stmt
+);
+
 OCI_SYM_LOCAL boolean OcilibStatementSetFetchSize
 (
     OCI_Statement* stmt,
@@ -685,6 +745,28 @@ OCI_SYM_LOCAL unsigned int OcilibStatementGetPrefetchMemory
     OCI_Statement* stmt
 );
 
+OCI_SYM_LOCAL boolean OcilibStatementSetFetchMemory
+(
+    OCI_Statement* stmt,
+    unsigned int   size
+);
+
+OCI_SYM_LOCAL unsigned int OcilibStatementGetFetchMemory
+(
+    OCI_Statement* stmt
+);
+
+OCI_SYM_LOCAL boolean OcilibStatementSetReadAhead
+(
+    OCI_Statement* stmt,
+    boolean        value
+);
+
+OCI_SYM_LOCAL boolean OcilibStatementGetReadAhead
+(
+    OCI_Statement* stmt
+);
+
 OCI_SYM_LOCAL boolean OcilibStatementSetPieceSize
 (
     OCI_Statement* stmt,
@@ -775,4 +857,29 @@ OCI_SYM_LOCAL unsigned int OcilibStatementGetBatchErrorCount
     OCI_Statement* stmt
 );
 
+OCI_SYM_LOCAL big_uint OcilibStatementStatsGetTime
+(
+    void
+);
+
+OCI_SYM_LOCAL void OcilibStatementStatsRecord
+(
+    OCI_Statement *stmt,
+    unsigned int   call,
+    big_uint       elapsed,
+    big_uint       rows,
+    big_uint       bytes
+);
+
+OCI_SYM_LOCAL void OcilibStatementStatsRelease
+(
+    void
+);
+
+OCI_SYM_LOCAL big_uint OcilibStatementGetStats
+(
+    OCI_Statement* stmt,
+    unsigned int   value
+);
+
 #endif /* OCILIB_STATEMENT_H_INCLUDED */
@@ -21,6 +21,7 @@
 #include "typeinfo.h"
 
 #include "column.h"
+#include "hash.h"
 #include "list.h"
 #include "macros.h"
 #include "memory.h"
@@ -85,6 +86,453 @@ static OCI_TypeInfo* OcilibTypeInfoFindOrCreate(OCI_Connection* con, TypeInfoFin
     return typinf;
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibTypeInfoParseName
+ * --------------------------------------------------------------------------------------------- */
+
+static void OcilibTypeInfoParseName
+(
+    const otext *name,
+    otext       *obj_schema,
+    otext       *obj_name
+)
+{
+    otext *str = NULL;
+
+    obj_schema[0] = 0;
+    obj_name[0]   = 0;
+
+    /* is the schema provided in the object name ? */
+
+    for (str = (otext *) name; *str; str++)
+    {
+        if (*str == OTEXT('.'))
+        {
+            ostrncat(obj_schema, name,  str-name);
+            ostrncat(obj_name,   ++str, (size_t) OCI_SIZE_OBJ_NAME);
+            break;
+        }
+    }
+
+    /* if the schema is not provided, we just copy the object name */
+
+    if (!obj_name[0])
+    {
+        ostrncat(obj_name, name, (size_t) OCI_SIZE_OBJ_NAME);
+    }
+
+    /* type name must be uppercase if not quoted */
+
+    if (obj_name[0] != OTEXT('"'))
+    {
+        for (str = obj_name; *str; str++)
+        {
+            *str = (otext)otoupper(*str);
+        }
+    }
+
+    /* schema name must be uppercase if not quoted */
+
+    if (obj_schema[0] != OTEXT('"'))
+    {
+        for (str = obj_schema; *str; str++)
+        {
+            *str = (otext)otoupper(*str);
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibTypeInfoGetFullName
+ * --------------------------------------------------------------------------------------------- */
+
+static otext * OcilibTypeInfoGetFullName
+(
+    OCI_TypeInfo *typinf
+)
+{
+    size_t len = ostrlen(typinf->name) + 1;
+    otext *str = NULL;
+
+    if (IS_STRING_VALID(typinf->schema))
+    {
+        len += ostrlen(typinf->schema) + 1;
+    }
+
+    str = (otext *) OcilibMemoryAlloc(OCI_IPC_STRING, sizeof(otext), len, TRUE);
+
+    if (NULL != str)
+    {
+        if (IS_STRING_VALID(typinf->schema))
+        {
+            ostrcat(str, typinf->schema);
+            ostrcat(str, OTEXT("."));
+        }
+
+        ostrcat(str, typinf->name);
+    }
+
+    return str;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibTypeInfoCacheGetKey
+ * --------------------------------------------------------------------------------------------- */
+
+static otext * OcilibTypeInfoCacheGetKey
+(
+    OCI_Connection     *con,
+    TypeInfoFindParams *find_params
+)
+{
+    const otext *db   = con->db   ? con->db   : OTEXT("");
+    const otext *user = con->user ? con->user : OTEXT("");
+    otext       *key  = NULL;
+
+    /* the key identifies the database, the session user (for unqualified names) and the object */
+
+    const size_t len = ostrlen(db) + ostrlen(user) + ostrlen(find_params->schema) +
+                       ostrlen(find_params->name) + 8;
+
+    key = (otext *) OcilibMemoryAlloc(OCI_IPC_STRING, sizeof(otext), len, TRUE);
+
+    if (NULL != key)
+    {
+        otext type[2] = { (otext) (OTEXT('0') + find_params->type), 0 };
+
+        ostrcat(key, db);
+        ostrcat(key, OTEXT("|"));
+        ostrcat(key, user);
+        ostrcat(key, OTEXT("|"));
+        ostrcat(key, type);
+        ostrcat(key, OTEXT("|"));
+        ostrcat(key, find_params->schema);
+        ostrcat(key, OTEXT("."));
+        ostrcat(key, find_params->name);
+    }
+
+    return key;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibTypeInfoDescFree
+ * --------------------------------------------------------------------------------------------- */
+
+static void OcilibTypeInfoDescFree
+(
+    OCI_TypeInfoDesc *desc
+)
+{
+    if (NULL != desc->cols)
+    {
+        for (ub2 i = 0; i < desc->nb_cols; i++)
+        {
+            OcilibMemoryFree(desc->cols[i].name);
+        }
+    }
+
+    if (NULL != desc->col_types)
+    {
+        for (ub2 i = 0; i < desc->nb_cols; i++)
+        {
+            OcilibMemoryFree(desc->col_types[i]);
+        }
+    }
+
+    OcilibMemoryFree(desc->cols);
+    OcilibMemoryFree(desc->col_types);
+    OcilibMemoryFree(desc->schema);
+    OcilibMemoryFree(desc->name);
+    OcilibMemoryFree(desc->parent_name);
+    OcilibMemoryFree(desc->target_name);
+    OcilibMemoryFree(desc);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibTypeInfoDescRelease
+ * --------------------------------------------------------------------------------------------- */
+
+static void OcilibTypeInfoDescRelease
+(
+    OCI_TypeInfoDesc *desc
+)
+{
+    OCI_TypeInfoCache *cache = &Env.tinf_cache;
+
+    if (NULL != cache->mutex)
+    {
+        OcilibMutexAcquire(cache->mutex);
+    }
+
+    if (0 == --desc->refs)
+    {
+        OcilibTypeInfoDescFree(desc);
+    }
+
+    if (NULL != cache->mutex)
+    {
+        OcilibMutexRelease(cache->mutex);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibTypeInfoCacheAcquire
+ * --------------------------------------------------------------------------------------------- */
+
+static OCI_TypeInfoDesc * OcilibTypeInfoCacheAcquire
+(
+    const otext *key
+)
+{
+    OCI_TypeInfoCache *cache = &Env.tinf_cache;
+    OCI_TypeInfoDesc  *desc  = NULL;
+
+    if (NULL != cache->mutex)
+    {
+        OcilibMutexAcquire(cache->mutex);
+    }
+
+    if (NULL != cache->map)
+    {
+        desc = (OCI_TypeInfoDesc *) OcilibHashGetPointer(cache->map, key);
+
+        if (NULL != desc)
+        {
+            desc->refs++;
+        }
+    }
+
+    if (NULL != cache->mutex)
+    {
+        OcilibMutexRelease(cache->mutex);
+    }
+
+    return desc;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibTypeInfoCacheStore
+ * --------------------------------------------------------------------------------------------- */
+
+static void OcilibTypeInfoCacheStore
+(
+    const otext  *key,
+    OCI_TypeInfo *typinf,
+    OCI_TypeInfo *syn_typinf,
+    unsigned int  type
+)
+{
+    OCI_TypeInfoCache *cache   = &Env.tinf_cache;
+    OCI_TypeInfoDesc  *desc    = NULL;
+    boolean            success = TRUE;
+
+    desc = (OCI_TypeInfoDesc *) OcilibMemoryAlloc(OCI_IPC_TYPE_INFO, sizeof(*desc), (size_t) 1, TRUE);
+
+    if (NULL == desc)
+    {
+        return;
+    }
+
+    desc->refs   = 1;
+    desc->type   = (NULL != syn_typinf) ? type : typinf->type;
+    desc->schema = OcilibStringDuplicate(typinf->schema);
+    desc->name   = OcilibStringDuplicate(typinf->name);
+
+    success = (NULL != desc->schema && NULL != desc->name);
+
+    if (NULL != syn_typinf)
+    {
+        /* synonyms are stored as a reference to the object they are pointing to */
+
+        desc->target_name = OcilibTypeInfoGetFullName(syn_typinf);
+
+        success = success && (NULL != desc->target_name);
+    }
+    else
+    {
+        desc->typecode = typinf->typecode;
+        desc->colcode  = typinf->colcode;
+        desc->is_final = typinf->is_final;
+
+        if (NULL != typinf->parent_type)
+        {
+            desc->parent_name = OcilibTypeInfoGetFullName(typinf->parent_type);
+
+            success = success && (NULL != desc->parent_name);
+        }
+
+        if (success && typinf->nb_cols > 0)
+        {
+            desc->cols      = (OCI_Column *) OcilibMemoryAlloc(OCI_IPC_COLUMN, sizeof(*desc->cols),
+                                                               (size_t) typinf->nb_cols, TRUE);
+            desc->col_types = (otext **) OcilibMemoryAlloc(OCI_IPC_ARRAY, sizeof(*desc->col_types),
+                                                           (size_t) typinf->nb_cols, TRUE);
+
+            success = (NULL != desc->cols && NULL != desc->col_types);
+
+            if (success)
+            {
+                desc->nb_cols = typinf->nb_cols;
+
+                memcpy(desc->cols, typinf->cols, sizeof(*desc->cols) * desc->nb_cols);
+
+                for (ub2 i = 0; i < desc->nb_cols; i++)
+                {
+                    desc->cols[i].typinf = NULL;
+                    desc->cols[i].name   = OcilibStringDuplicate(typinf->cols[i].name);
+
+                    success = success && (NULL != desc->cols[i].name);
+
+                    if (NULL != typinf->cols[i].typinf)
+                    {
+                        desc->col_types[i] = OcilibTypeInfoGetFullName(typinf->cols[i].typinf);
+
+                        success = success && (NULL != desc->col_types[i]);
+                    }
+                }
+            }
+        }
+    }
+
+    if (success)
+    {
+        if (NULL != cache->mutex)
+        {
+            OcilibMutexAcquire(cache->mutex);
+        }
+
+        /* another connection may have described the same object in the meantime */
+
+        if (NULL != cache->map && NULL == OcilibHashGetPointer(cache->map, key))
+        {
+            if (OcilibHashAddPointer(cache->map, key, desc))
+            {
+                desc = NULL;
+            }
+        }
+
+        if (NULL != cache->mutex)
+        {
+            OcilibMutexRelease(cache->mutex);
+        }
+    }
+
+    if (NULL != desc)
+    {
+        OcilibTypeInfoDescFree(desc);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibTypeInfoLoad
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean OcilibTypeInfoLoad
+(
+    OCI_TypeInfo      *typinf,
+    OCI_TypeInfoDesc  *desc,
+    OCI_TypeInfo     **p_syn_typinf
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_TYPE_INFO, typinf
+    )
+
+    OCI_Connection *con = typinf->con;
+
+    dbtext* dbstr1  = NULL;
+    int     dbsize1 = -1;
+    dbtext* dbstr2  = NULL;
+    int     dbsize2 = -1;
+
+    /* synonyms: retrieve the type info of the real object */
+
+    if (IS_STRING_VALID(desc->target_name))
+    {
+        *p_syn_typinf = OcilibTypeInfoGet(con, desc->target_name, desc->type);
+
+        CHECK_NULL(*p_syn_typinf)
+
+        SET_SUCCESS()
+
+        JUMP_EXIT()
+    }
+
+    typinf->type     = desc->type;
+    typinf->typecode = desc->typecode;
+    typinf->colcode  = desc->colcode;
+    typinf->is_final = desc->is_final;
+
+    /* type descriptors are pinned for the session duration and cannot be shared */
+
+    if (OCI_TIF_TYPE == typinf->type)
+    {
+        dbstr1 = OcilibStringGetDBString(typinf->schema, &dbsize1);
+        dbstr2 = OcilibStringGetDBString(typinf->name,   &dbsize2);
+
+        CHECK_OCI
+        (
+            con->err,
+            OCITypeByName,
+            con->env, con->err, con->cxt,
+            (CONST text*) dbstr1, dbsize1,
+            (CONST text*) dbstr2, dbsize2,
+            (text*)0, 0,
+            OCI_DURATION_SESSION, OCI_TYPEGET_ALL,
+            &typinf->tdo
+        )
+    }
+
+    if (IS_STRING_VALID(desc->parent_name))
+    {
+        typinf->parent_type = OcilibTypeInfoGet(con, desc->parent_name, OCI_TIF_TYPE);
+
+        CHECK_NULL(typinf->parent_type)
+    }
+
+    if (desc->nb_cols > 0)
+    {
+        ALLOC_DATA(OCI_IPC_ARRAY, typinf->offsets, desc->nb_cols)
+
+        memset(typinf->offsets, -1, sizeof(*typinf->offsets) * desc->nb_cols);
+
+        ALLOC_DATA(OCI_IPC_COLUMN, typinf->cols, desc->nb_cols)
+
+        memcpy(typinf->cols, desc->cols, sizeof(*typinf->cols) * desc->nb_cols);
+
+        typinf->nb_cols = desc->nb_cols;
+
+        /* column names must be owned by the type info before anything can fail */
+
+        for (ub2 i = 0; i < typinf->nb_cols; i++)
+        {
+            typinf->cols[i].name = OcilibStringDuplicate(desc->cols[i].name);
+        }
+
+        for (ub2 i = 0; i < typinf->nb_cols; i++)
+        {
+            CHECK_NULL(typinf->cols[i].name)
+
+            if (IS_STRING_VALID(desc->col_types[i]))
+            {
+                typinf->cols[i].typinf = OcilibTypeInfoGet(con, desc->col_types[i], OCI_TIF_TYPE);
+
+                CHECK_NULL(typinf->cols[i].typinf)
+            }
+        }
+    }
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        OcilibStringReleaseDBString(dbstr1);
+        OcilibStringReleaseDBString(dbstr2);
+    )
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OcilibTypeInfoDispose
  * --------------------------------------------------------------------------------------------- */
@@ -179,53 +627,16 @@ OCI_TypeInfo * OcilibTypeInfoGet
     otext obj_schema[OCI_SIZE_OBJ_NAME + 1];
     otext obj_name[OCI_SIZE_OBJ_NAME + 1];
 
+    OCI_TypeInfoDesc *desc      = NULL;
+    otext            *cache_key = NULL;
+
     boolean is_created = FALSE;
 
     CHECK_PTR(OCI_IPC_CONNECTION, con)
     CHECK_PTR(OCI_IPC_STRING,     name)
     CHECK_ENUM_VALUE(type, TypeInfoTypeValues, OTEXT("Type"))
 
-    obj_schema[0] = 0;
-    obj_name[0]   = 0;
-
-    /* is the schema provided in the object name ? */
-
-    for (str = (otext *) name; *str; str++)
-    {
-        if (*str == OTEXT('.'))
-        {
-            ostrncat(obj_schema, name,  str-name);
-            ostrncat(obj_name,   ++str, (size_t) OCI_SIZE_OBJ_NAME);
-            break;
-        }
-    }
-
-    /* if the schema is not provided, we just copy the object name */
-
-    if (!obj_name[0])
-    {
-        ostrncat(obj_name, name, (size_t) OCI_SIZE_OBJ_NAME);
-    }
-
-    /* type name must be uppercase if not quoted */
-
-    if (obj_name[0] != OTEXT('"'))
-    {
-        for (str = obj_name; *str; str++)
-        {
-            *str = (otext)otoupper(*str);
-        }
-    }
-
-    /* schema name must be uppercase if not quoted */
-
-    if (obj_schema[0] != OTEXT('"'))
-    {
-        for (str = obj_schema; *str; str++)
-        {
-            *str = (otext)otoupper(*str);
-        }
-    }
+    OcilibTypeInfoParseName(name, obj_schema, obj_name);
 
     /* first try to find it in list */
 
@@ -243,9 +654,24 @@ OCI_TypeInfo * OcilibTypeInfoGet
 
     CHECK_NULL(typinf)
 
+    /* Not found, try to build it from a description shared by other connections */
+
+    if (is_created && LIB_TYPEINFO_CACHE)
+    {
+        cache_key = OcilibTypeInfoCacheGetKey(con, &find_params);
+        CHECK_NULL(cache_key)
+
+        desc = OcilibTypeInfoCacheAcquire(cache_key);
+
+        if (NULL != desc)
+        {
+            CHECK(OcilibTypeInfoLoad(typinf, desc, &syn_typinf))
+        }
+    }
+
     /* Not found, so create type object */
 
-    if (is_created)
+    if (is_created && NULL == desc)
     {
         /* allocate describe handle */
         
@@ -623,6 +1049,13 @@ OCI_TypeInfo * OcilibTypeInfoGet
         THROW(OcilibExceptionTypeInfoWrongType, name)
     }
 
+    /* share the description of the newly described object */
+
+    if (is_created && NULL == desc && NULL != cache_key)
+    {
+        OcilibTypeInfoCacheStore(cache_key, typinf, syn_typinf, type);
+    }
+
     SET_RETVAL(syn_typinf ? syn_typinf : typinf)
 
     CLEANUP_AND_EXIT_FUNC
@@ -641,6 +1074,13 @@ OCI_TypeInfo * OcilibTypeInfoGet
 
         OcilibMemoryFreeHandle(dschp, OCI_HTYPE_DESCRIBE);
 
+        OcilibMemoryFree(cache_key);
+
+        if (NULL != desc)
+        {
+            OcilibTypeInfoDescRelease(desc);
+        }
+
         if (NULL != typinf && (FAILURE || NULL != syn_typinf))
         {
            LIST_ATOMIC_REMOVE(con->tinfs, typinf, OcilibTypeInfoDispose)
@@ -648,6 +1088,140 @@ OCI_TypeInfo * OcilibTypeInfoGet
     )
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibTypeInfoInvalidate
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OcilibTypeInfoInvalidate
+(
+    const otext *name
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    OCI_TypeInfoCache *cache = &Env.tinf_cache;
+    OCI_HashTable     *map   = NULL;
+
+    otext obj_schema[OCI_SIZE_OBJ_NAME + 1];
+    otext obj_name[OCI_SIZE_OBJ_NAME + 1];
+
+    boolean locked = FALSE;
+
+    CHECK_INITIALIZED()
+
+    if (NULL == cache->map)
+    {
+        SET_SUCCESS()
+        JUMP_EXIT()
+    }
+
+    if (NULL != name)
+    {
+        OcilibTypeInfoParseName(name, obj_schema, obj_name);
+    }
+
+    if (NULL != cache->mutex)
+    {
+        OcilibMutexAcquire(cache->mutex);
+        locked = TRUE;
+    }
+
+    /* open addressing tables do not support removals, so remaining entries are moved to a new table */
+
+    map = OcilibHashCreate(OCI_HASH_MIN_SIZE, OCI_HASH_POINTER);
+    CHECK_NULL(map)
+
+    for (unsigned int i = 0, n = OcilibHashGetSize(cache->map); i < n; i++)
+    {
+        OCI_HashEntry *e = OcilibHashGetEntry(cache->map, i);
+
+        if (NULL != e && NULL != e->values)
+        {
+            OCI_TypeInfoDesc *desc = (OCI_TypeInfoDesc *) e->values->value.p_void;
+
+            const boolean matches = (NULL == name) ||
+                                    ((0 == OcilibStringCaseCompare(desc->name, obj_name)) &&
+                                     (!obj_schema[0] || 0 == OcilibStringCaseCompare(desc->schema, obj_schema)));
+
+            if (matches)
+            {
+                if (0 == --desc->refs)
+                {
+                    OcilibTypeInfoDescFree(desc);
+                }
+            }
+            else if (!OcilibHashAddPointer(map, e->key, desc))
+            {
+                /* on failure, the description is no more referenced by the cache */
+
+                if (0 == --desc->refs)
+                {
+                    OcilibTypeInfoDescFree(desc);
+                }
+            }
+        }
+    }
+
+    OcilibHashFree(cache->map);
+
+    cache->map = map;
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (locked)
+        {
+            OcilibMutexRelease(cache->mutex);
+        }
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OcilibTypeInfoCacheRelease
+ * --------------------------------------------------------------------------------------------- */
+
+void OcilibTypeInfoCacheRelease
+(
+    void
+)
+{
+    OCI_TypeInfoCache *cache = &Env.tinf_cache;
+
+    if (NULL != cache->map)
+    {
+        for (unsigned int i = 0, n = OcilibHashGetSize(cache->map); i < n; i++)
+        {
+            OCI_HashEntry *e = OcilibHashGetEntry(cache->map, i);
+
+            if (NULL != e && NULL != e->values)
+            {
+                OCI_TypeInfoDesc *desc = (OCI_TypeInfoDesc *) e->values->value.p_void;
+
+                if (0 == --desc->refs)
+                {
+                    OcilibTypeInfoDescFree(desc);
+                }
+            }
+        }
+
+        OcilibHashFree(cache->map);
+
+        cache->map = NULL;
+    }
+
+    if (NULL != cache->mutex)
+    {
+        OcilibMutexFree(cache->mutex);
+
+        cache->mutex = NULL;
+    }
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OcilibTypeInfoFree
  * --------------------------------------------------------------------------------------------- */
@@ -76,4 +76,14 @@ OCI_SYM_LOCAL OCI_TypeInfo* OcilibTypeInfoGetSuperType
     OCI_TypeInfo* typinf
 );
 
+OCI_SYM_LOCAL boolean OcilibTypeInfoInvalidate
+(
+    const otext *name
+);
+
+OCI_SYM_LOCAL void OcilibTypeInfoCacheRelease
+(
+    void
+);
+
 #endif /* OCILIB_TYPEINFO_H_INCLUDED */
@@ -36,18 +36,159 @@
 
 struct OCI_MemoryBlock
 {
-    int          type; /* type of allocated data */
-    unsigned int size; /* allocated memory size*/
+    int                     type;  /* type of allocated data */
+    unsigned int            size;  /* allocated memory size*/
+    struct OCI_MemoryArena *arena; /* owning arena, if any */
 };
 
 typedef struct OCI_MemoryBlock OCI_MemoryBlock;
 
+/*
+ * OCI_MemoryProfile : allocation statistics for a given type of memory block
+ *
+ */
+
+struct OCI_MemoryProfile
+{
+    big_uint bytes; /* allocated bytes */
+    big_uint count; /* allocated blocks */
+    big_uint peak;  /* highest number of allocated bytes */
+};
+
+typedef struct OCI_MemoryProfile OCI_MemoryProfile;
+
+/*
+ * OCI_PooledDescriptors : array of OCI descriptors kept for reuse
+ *
+ */
+
+struct OCI_PooledDescriptors
+{
+    struct OCI_PooledDescriptors *next;    /* next pooled array */
+    CONST dvoid                  *parenth; /* parent environment handle */
+    dvoid                       **descs;   /* pooled descriptors */
+    ub4                           type;    /* descriptor type */
+    ub4                           nb_elem; /* number of descriptors */
+};
+
+typedef struct OCI_PooledDescriptors OCI_PooledDescriptors;
+
+/*
+ * OCI_DescriptorPool : environment wide pool of OCI descriptor arrays
+ *
+ */
+
+struct OCI_DescriptorPool
+{
+    OCI_PooledDescriptors *head;   /* pooled descriptor arrays */
+    OCI_Mutex             *mutex;  /* mutex for multithreading */
+    unsigned int           count;  /* number of pooled arrays */
+    big_uint               hits;   /* requests served from the pool */
+    big_uint               misses; /* requests served by OCI */
+};
+
+typedef struct OCI_DescriptorPool OCI_DescriptorPool;
+
+/*
+ * OCI_TypeInfoDesc : connection independent description of a type info object.
+ *
+ * Descriptions are shared by all connections to the same database through the
+ * environment wide type info cache. Type info objects referenced by the description
+ * (super type, synonym target, object columns) are stored by name.
+ *
+ */
+
+struct OCI_TypeInfoDesc
+{
+    OCI_Column   *cols;        /* columns (typinf members are not set) */
+    otext       **col_types;   /* full names of object columns types */
+    otext        *schema;      /* owner of the type info object */
+    otext        *name;        /* name of the type info object */
+    otext        *parent_name; /* full name of the super type */
+    otext        *target_name; /* full name of the object pointed by a synonym */
+    unsigned int  refs;        /* number of references (cache included) */
+    unsigned int  type;        /* type of type info handle */
+    ub2           typecode;    /* Oracle type code */
+    ub2           colcode;     /* Oracle collection code */
+    ub2           nb_cols;     /* number of columns */
+    ub1           is_final;    /* is is a virtual type that can be inherited ? */
+};
+
+typedef struct OCI_TypeInfoDesc OCI_TypeInfoDesc;
+
+/*
+ * OCI_TypeInfoCache : environment wide cache of type info descriptions
+ *
+ */
+
+struct OCI_TypeInfoCache
+{
+    OCI_HashTable *map;   /* descriptions indexed by database identity and object name */
+    OCI_Mutex     *mutex; /* mutex for multithreading */
+};
+
+typedef struct OCI_TypeInfoCache OCI_TypeInfoCache;
+
+/*
+ * OCI_SqlStats : environment wide statistics of a SQL statement
+ *
+ */
+
+struct OCI_SqlStats
+{
+    otext    *key;                   /* sql id or SQL text */
+    big_uint  values[OCI_SSV_COUNT]; /* statistics accumulated by all statements */
+};
+
+typedef struct OCI_SqlStats OCI_SqlStats;
+
+/*
+ * OCI_SqlStatsTable : environment wide table of SQL statistics
+ *
+ */
+
+struct OCI_SqlStatsTable
+{
+    OCI_HashTable  *map;       /* entries indexed by sql id or SQL text */
+    OCI_SqlStats  **entries;   /* entries in creation order */
+    unsigned int    count;     /* number of entries */
+    unsigned int    allocated; /* number of allocated entries */
+    OCI_Mutex      *mutex;     /* mutex for multithreading */
+};
+
+typedef struct OCI_SqlStatsTable OCI_SqlStatsTable;
+
+/*
+ * OCI_MemoryArena : Internal memory arena.
+ *
+ * When OCI_ENV_MEMORY_ARENA is set, each connection owns an arena from which
+ * small internal structures (statements, binds, resultsets, ...) are carved.
+ * Blocks are recycled through per size class free lists and all slabs are
+ * released at once when the connection is destroyed.
+ *
+ */
+
+struct OCI_MemoryArena
+{
+    OCI_MemoryBlock *free_blocks[OCI_ARENA_CLASS_COUNT]; /* recycled blocks per size class */
+    void            *slabs;                              /* list of allocated slabs */
+    unsigned char   *cursor;                             /* first unused byte of current slab */
+    unsigned char   *limit;                              /* end of current slab */
+    OCI_Mutex       *mutex;                              /* mutex handle */
+};
+
+typedef struct OCI_MemoryArena OCI_MemoryArena;
+
 /*
  * OCI_Item : Internal list entry.
  *
  * The library needs to manage internal list of objects in order to be able to
  * free them if the application does not.
  *
+ * The entry is intrusive : it is stored in the same memory block than the
+ * object it links, right after it, allowing O(1) insertion and removal
+ * without any extra allocation
+ *
  * @note
  * Internal lists are using mutexes for resource locking in multithreaded
  * environments
@@ -57,6 +198,8 @@ typedef struct OCI_MemoryBlock OCI_MemoryBlock;
 struct OCI_Item
 {
     void            *data; /* pointer to external data */
+    struct OCI_List *list; /* list holding the element */
+    struct OCI_Item *prev; /* previous element in list */
     struct OCI_Item *next; /* next element in list */
 };
 
@@ -76,10 +219,13 @@ typedef struct OCI_Item OCI_Item;
 
 struct OCI_List
 {
-    OCI_Item  *head;     /* pointer to first item */
-    OCI_Mutex *mutex;    /* mutex handle */
-    int        type;     /* type of list item */
-    ub4        count;    /* number of elements in list */
+    OCI_Item        *head;     /* pointer to first item */
+    OCI_Item        *tail;     /* pointer to last item */
+    OCI_Mutex       *mutex;    /* mutex handle */
+    OCI_MemoryArena *arena;    /* arena used for item data, if any */
+    size_t           offset;   /* offset of the entry within item data blocks */
+    int              type;     /* type of list item */
+    ub4              count;    /* number of elements in list */
 };
 
 typedef struct OCI_List OCI_List;
@@ -150,6 +296,17 @@ struct OCI_Mutex
     OCIError       *err;      /* OCI Error handle */
 };
 
+/*
+ * Condition object
+ *
+ * Internal lock with a condition variable used to wake up helper threads.
+ * The Oracle thread package has no condition variables, thus the object is
+ * implemented with the native thread API and is defined in mutex.c
+ *
+ */
+
+typedef struct OCI_Condition OCI_Condition;
+
 /*
  * Thread object
  *
@@ -201,6 +358,7 @@ struct OCI_Environment
     OCI_Error      *lib_err;                      /* Global error */
     OCI_HashTable  *key_map;                      /* hash table for mapping name/key */
     OCI_ThreadKey  *key_errs;                     /* Thread key to store thread errors */
+    OCI_ThreadKey  *key_async;                    /* Thread key to store asynchronous call of workers */
     OCI_HashTable* sql_funcs;                     /* hash table handle for sql function names */
     OCI_Mutex      *mem_mutex;                    /* mutex for memory counters */
     void           *usrdata;                      /* user data */
@@ -212,6 +370,10 @@ struct OCI_Environment
 #endif
     big_uint        mem_bytes_oci;                /* allocated bytes by OCI client */
     big_uint        mem_bytes_lib;                /* allocated bytes by OCILIB */
+    OCI_MemoryProfile mem_profile[OCI_IPC_COUNT]; /* allocation profile per memory type */
+    OCI_DescriptorPool desc_pool;                 /* pool of OCI descriptor arrays */
+    OCI_TypeInfoCache  tinf_cache;                /* cache of type info descriptions */
+    OCI_SqlStatsTable  sql_stats;                 /* statistics per SQL statement */
     unsigned int    version_compile;              /* OCI version used at compile time */
     unsigned int    version_runtime;              /* OCI version used at runtime */
     unsigned int    charset;                      /* charset type */
@@ -251,6 +413,110 @@ struct OCI_Pool
     ub4       cache_size;       /* statement cache size */
 };
 
+/*
+ * OCI_StatementCache : per connection cache of prepared statements.
+ *
+ * Freed statements are parked with their OCI handle, binds and resultsets and handed
+ * back to the next statement prepared with the same SQL and bind configuration.
+ *
+ */
+
+struct OCI_StatementCache
+{
+    OCI_HashTable *map;    /* chains of parked statements indexed by key */
+    OCI_Statement *head;   /* most recently parked statement */
+    OCI_Statement *tail;   /* least recently parked statement */
+    unsigned int   size;   /* maximum number of parked statements */
+    unsigned int   count;  /* number of parked statements */
+    big_uint       hits;   /* prepare calls served from the cache */
+    big_uint       misses; /* prepare calls served by OCI */
+};
+
+typedef struct OCI_StatementCache OCI_StatementCache;
+
+/*
+ * Asynchronous job
+ *
+ * Statement execution or fetch queued for the worker thread of a connection
+ *
+ */
+
+struct OCI_AsyncJob
+{
+    OCI_Statement       *stmt;    /* statement of the call */
+    OCI_Resultset       *rs;      /* resultset of the call for fetches */
+    POCI_ASYNC_HANDLER   handler; /* completion callback */
+    void                *ctx;     /* completion callback user context */
+    unsigned int         type;    /* type of call */
+    struct OCI_AsyncJob *next;    /* next queued job */
+};
+
+typedef struct OCI_AsyncJob OCI_AsyncJob;
+
+/*
+ * Asynchronous call
+ *
+ * Worker thread of a connection running its queued asynchronous calls.
+ * It is started by the first call and lives until the connection is freed
+ *
+ */
+
+struct OCI_AsyncCall
+{
+    OCI_Thread    *thread;   /* worker thread running the calls */
+    OCI_Condition *cond;     /* protects the fields below, signals queued and completed jobs */
+    OCI_AsyncJob  *head;     /* first queued job */
+    OCI_AsyncJob  *tail;     /* last queued job */
+    OCI_Statement *stmt;     /* statement of the last started call */
+    unsigned int   status;   /* status of the last started call */
+    boolean        result;   /* result of the last completed call */
+    boolean        running;  /* a job is run by the worker */
+    boolean        stop;     /* the worker exits once the queue is empty */
+    boolean        detached; /* connection freed from a completion callback */
+};
+
+typedef struct OCI_AsyncCall OCI_AsyncCall;
+
+/*
+ * Parallel query
+ *
+ * Partitions of a query run concurrently by worker threads over pooled connections
+ *
+ */
+
+struct OCI_PartitionedQuery
+{
+    const otext        *sql;        /* partitioned SQL statement */
+    otext             **bounds;     /* low and high bounds of partitions (ROWID and RANGE modes) */
+    otext              *error;      /* error message of the first failed partition */
+    POCI_PARALLEL_FETCH handler;    /* row consumer */
+    void               *ctx;        /* row consumer user context */
+    OCI_Mutex          *mutex;      /* mutex serializing the consumer and the partitions dispatch */
+    unsigned int        mode;       /* partitioning mode */
+    unsigned int        nb_parts;   /* number of partitions */
+    unsigned int        next;       /* index of the next partition to run */
+    unsigned int        failed;     /* index of the first failed partition (starting at 1) */
+    unsigned int        fetch_size; /* fetch array size of partitions */
+    boolean             stop;       /* the consumer asked to stop */
+};
+
+typedef struct OCI_PartitionedQuery OCI_PartitionedQuery;
+
+/*
+ * Parallel query worker
+ *
+ */
+
+struct OCI_ParallelWorker
+{
+    OCI_PartitionedQuery *query;   /* parallel query */
+    OCI_Connection       *con;     /* pooled connection of the worker */
+    OCI_Thread           *thread;  /* worker thread */
+    boolean               running; /* is the worker thread running ? */
+};
+
+typedef struct OCI_ParallelWorker OCI_ParallelWorker;
+
 /*
  * Connection object
  *
@@ -270,6 +536,9 @@ struct OCI_Connection
     OCI_Pool         *pool;                     /* pointer to parent pool object */
     OCI_ServerOutput *svopt;                    /* Pointer to server output object */
     OCI_TraceInfo   *trace;                     /* trace information */
+    OCI_MemoryArena  *arena;                    /* memory arena for internal structures */
+    OCI_StatementCache prep_cache;              /* cache of prepared statements */
+    OCI_AsyncCall    *async;                    /* asynchronous call */
     otext            *db;                       /* database */
     otext            *user;                     /* user */
     otext            *pwd;                      /* password */
@@ -383,6 +652,7 @@ struct OCI_Bind
     ub1            csfrm;        /* charset form */
     ub1            direction;    /* in, out or in/out bind */
     ub1            alloc_mode;   /* allocation mode : internal or external */
+    ub1            ext_arrays;   /* indicators and lengths arrays provided by the user */
 };
 
 /*
@@ -396,6 +666,7 @@ struct OCI_Define
     void          *obj;   /* current OCILIB object instance */
     OCI_Column     col;   /* column object */
     OCI_Buffer     buf;   /* placeholder */
+    OCI_Buffer     ahead; /* second placeholder filled by read-ahead fetches */
 };
 
 typedef struct OCI_Define OCI_Define;
@@ -415,10 +686,27 @@ struct OCI_Resultset
     ub4            row_abs;         /* absolute position in the resultset */
     ub4            row_count;       /* number of rows fetched so far */
     ub4            row_fetched;     /* rows fetched by last call (scrollable) */
+    ub4            block_start;     /* index of the first row of the current block */
+    ub4            block_rows;      /* number of rows of the current block */
     ub4            fetch_size;      /* internal array size */
+    ub4            fetch_max;       /* allocated array size */
+    ub4            fetch_mem;       /* fetch memory budget the array was sized for */
+    ub4            fetch_sample;    /* rows of the last throughput sample */
+    big_uint       fetch_time;      /* elapsed time of the last throughput sample */
+    boolean        fetch_adapt;     /* is the fetch size still adapting ? */
+    OCI_Thread    *ahead_thread;    /* helper thread fetching the next rows (read-ahead) */
+    OCI_Condition *ahead_cond;      /* signals read-ahead requests and completions */
+    OCIError      *ahead_err;       /* error handle of read-ahead fetches */
+    big_uint       ahead_time;      /* elapsed time of the last read-ahead fetch */
+    sword          ahead_status;    /* status of the last read-ahead fetch */
+    boolean        ahead;           /* read-ahead enabled ? */
+    boolean        ahead_started;   /* read-ahead fetch started and not consumed yet ? */
+    boolean        ahead_request;   /* read-ahead fetch requested to the helper thread ? */
+    boolean        ahead_stop;      /* helper thread must exit ? */
     boolean        eof;             /* end of resultset reached ?  */
     boolean        bof;             /* beginning of resultset reached ?  */
     sword          fetch_status;    /* internal fetch status */
+    boolean        redefine;        /* kept from a previous prepare of the same SQL ? */
 };
 
 /*
@@ -464,9 +752,16 @@ struct OCI_Statement
     boolean          bind_reuse;        /* rebind data allowed ? */
     unsigned int     bind_mode;         /* type of binding */
     unsigned int     bind_alloc_mode;   /* type of bind allocation */
+    unsigned int     bind_bigint_mode;  /* type of big integer binds */
+    unsigned int     fmt_param_mode;    /* formatted functions parameter mode */
+    void            *fmt_data;          /* values bound by formatted functions */
+    OCI_SqlStats    *sql_stats;         /* environment wide statistics entry */
+    big_uint         stats[OCI_SSV_COUNT]; /* execution statistics */
     ub4              fetch_size;        /* fetch array size */
     ub4              prefetch_size;     /* pre-fetch size */
     ub4              prefetch_mem;      /* pre-fetch memory */
+    ub4              fetch_mem;         /* fetch memory budget */
+    boolean          read_ahead;        /* fetch next rows in background ? */
     ub4              piece_size;        /* default piece size for dynamic fetchs */
     ub1              long_mode;         /* LONG datatype handling mode */
     ub1              status;            /* statement status */
@@ -478,6 +773,10 @@ struct OCI_Statement
     ub2              cur_rs;            /* index of the current resultset */
     ub2              dynidx;            /* bind index counter for dynamic exec */
     ub2              err_pos;           /* error position in sql statement */
+    otext           *cache_key;         /* key in the connection statement cache */
+    OCI_Statement   *cache_prev;        /* previous parked statement */
+    OCI_Statement   *cache_next;        /* next parked statement */
+    OCI_Statement   *cache_link;        /* next parked statement with the same key */
 };
 
 /*
@@ -940,15 +1239,34 @@ struct OCI_Array
 
 typedef struct OCI_Array OCI_Array;
 
+/*
+ * Hash table slot
+ *
+ * Entries and their first value are stored inline in the slots array
+ *
+ */
+
+struct OCI_HashSlot
+{
+    OCI_HashEntry entry;         /* entry (key and values) */
+    OCI_HashValue value;         /* storage for the first value of the entry */
+};
+
+typedef struct OCI_HashSlot OCI_HashSlot;
+
 /*
  * Hash table object
  *
+ * Open addressing table with linear probing. The hash of each slot key is cached
+ * in a separate array, 0 marking empty slots
+ *
  */
 
 struct OCI_HashTable
 {
-    OCI_HashEntry **items;        /* array of slots */
-    unsigned int    size;         /* size of the slots array */
+    OCI_HashSlot   *slots;        /* array of slots */
+    unsigned int   *hashes;       /* cached hashes of the slots keys */
+    unsigned int    size;         /* size of the slots array (power of 2) */
     unsigned int    count;        /* number of used slots */
     unsigned int    type;         /* type of data */
 };
@@ -40,6 +40,115 @@ namespace TestCApi
         ExecDML(OTEXT("drop table TestExternalArrayInsertArray"));
     }
 
+    TEST(TestArray, InsertNativeBigIntArray)
+    {
+        ExecDML(OTEXT("create table TestNativeBigIntArrayInsert(code number, code2 number)"));
+        ExecDML(OTEXT("truncate table TestNativeBigIntArrayInsert"));
+
+        ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+        const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+        ASSERT_NE(nullptr, conn);
+
+        const auto stmt = OCI_StatementCreate(conn);
+        ASSERT_NE(nullptr, stmt);
+
+        big_int tab_bint[ARRAY_SIZE];
+        big_uint tab_buint[ARRAY_SIZE];
+
+        ASSERT_EQ(OCI_BIM_NUMBER, OCI_GetBindBigIntMode(stmt));
+
+        ASSERT_TRUE(OCI_Prepare(stmt, OTEXT("insert into TestNativeBigIntArrayInsert values(:i, :u)")));
+        ASSERT_TRUE(OCI_BindArraySetSize(stmt, ARRAY_SIZE));
+        ASSERT_TRUE(OCI_SetBindBigIntMode(stmt, OCI_BIM_NATIVE));
+        ASSERT_TRUE(OCI_BindArrayOfBigInts(stmt, OTEXT(":i"), static_cast<big_int*>(tab_bint), 0));
+        ASSERT_TRUE(OCI_SetBindBigIntMode(stmt, OCI_BIM_NUMBER));
+        ASSERT_TRUE(OCI_BindArrayOfUnsignedBigInts(stmt, OTEXT(":u"), static_cast<big_uint*>(tab_buint), 0));
+
+        ASSERT_EQ(OCI_BIM_NATIVE, OCI_BindGetBigIntMode(OCI_GetBind(stmt, 1)));
+        ASSERT_EQ(OCI_BIM_NUMBER, OCI_BindGetBigIntMode(OCI_GetBind(stmt, 2)));
+
+        for (int i = 0; i < ARRAY_SIZE; i++)
+        {
+            tab_bint[i] = -(static_cast<big_int>(1) << 40) - i;
+            tab_buint[i] = (static_cast<big_uint>(1) << 40) + i;
+        }
+
+        ASSERT_TRUE(OCI_Execute(stmt));
+        ASSERT_EQ(ARRAY_SIZE, OCI_GetAffectedRows(stmt));
+
+        ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select count(*) from TestNativeBigIntArrayInsert where code = -code2")));
+
+        const auto rslt = OCI_GetResultset(stmt);
+        ASSERT_NE(nullptr, rslt);
+        ASSERT_TRUE(OCI_FetchNext(rslt));
+        ASSERT_EQ(ARRAY_SIZE, OCI_GetInt(rslt, 1));
+
+        ASSERT_TRUE(OCI_StatementFree(stmt));
+        ASSERT_TRUE(OCI_ConnectionFree(conn));
+        ASSERT_TRUE(OCI_Cleanup());
+
+        ExecDML(OTEXT("drop table TestNativeBigIntArrayInsert"));
+    }
+
+    TEST(TestArray, InsertExternalArrayDataSizes)
+    {
+        ExecDML(OTEXT("create table TestExternalArrayDataSizes(code int, content raw(20))"));
+        ExecDML(OTEXT("truncate table TestExternalArrayDataSizes"));
+
+        ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+        const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+        ASSERT_NE(nullptr, conn);
+
+        const auto stmt = OCI_StatementCreate(conn);
+        ASSERT_NE(nullptr, stmt);
+
+        int tab_int[ARRAY_SIZE];
+        unsigned char tab_raw[ARRAY_SIZE][STRING_SIZE];
+        unsigned int sizes[ARRAY_SIZE];
+        unsigned int sizes_out[ARRAY_SIZE];
+
+        ASSERT_TRUE(OCI_Prepare(stmt, OTEXT("insert into TestExternalArrayDataSizes values(:i, :r)")));
+        ASSERT_TRUE(OCI_BindArraySetSize(stmt, ARRAY_SIZE));
+        ASSERT_TRUE(OCI_BindArrayOfInts(stmt, OTEXT(":i"), static_cast<int*>(tab_int), 0));
+        ASSERT_TRUE(OCI_BindArrayOfRaws(stmt, OTEXT(":r"), tab_raw, STRING_SIZE, 0));
+
+        for (int i = 0; i < ARRAY_SIZE; i++)
+        {
+            tab_int[i] = i + 1;
+            sizes[i] = i + 1;
+            memset(tab_raw[i], 'A' + i, STRING_SIZE);
+        }
+
+        const auto bind = OCI_GetBind(stmt, 2);
+
+        ASSERT_TRUE(OCI_BindSetDataSizes(bind, sizes, ARRAY_SIZE));
+        ASSERT_TRUE(OCI_BindGetDataSizes(bind, sizes_out, ARRAY_SIZE));
+
+        for (int i = 0; i < ARRAY_SIZE; i++)
+        {
+            ASSERT_EQ(sizes[i], sizes_out[i]);
+            ASSERT_EQ(sizes[i], OCI_BindGetDataSizeAtPos(bind, i + 1));
+        }
+
+        ASSERT_TRUE(OCI_Execute(stmt));
+        ASSERT_EQ(ARRAY_SIZE, OCI_GetAffectedRows(stmt));
+
+        ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select count(*) from TestExternalArrayDataSizes where utl_raw.length(content) = code")));
+
+        const auto rslt = OCI_GetResultset(stmt);
+        ASSERT_NE(nullptr, rslt);
+        ASSERT_TRUE(OCI_FetchNext(rslt));
+        ASSERT_EQ(ARRAY_SIZE, OCI_GetInt(rslt, 1));
+
+        ASSERT_TRUE(OCI_StatementFree(stmt));
+        ASSERT_TRUE(OCI_ConnectionFree(conn));
+        ASSERT_TRUE(OCI_Cleanup());
+
+        ExecDML(OTEXT("drop table TestExternalArrayDataSizes"));
+    }
+
     TEST(TestArray, InsertExternalArrayError)
     {
         ExecDML(OTEXT("create table TestExternalArrayInsertArrayError(code int NOT NULL, name varchar2(50))"));
@@ -91,6 +200,83 @@ namespace TestCApi
         ExecDML(OTEXT("drop table TestExternalArrayInsertArrayError"));
     }
 
+    struct ArrayStreamRows
+    {
+        int tab_int[ARRAY_SIZE];
+        unsigned int total;
+        unsigned int null_row;
+    };
+
+    static unsigned int FillArrayStreamRows(OCI_Statement* stmt, unsigned int offset, unsigned int size, void* ctx)
+    {
+        const auto rows = static_cast<ArrayStreamRows*>(ctx);
+        const auto bnd = OCI_GetBind(stmt, 1);
+
+        unsigned int count = 0;
+
+        for (; count < size && offset + count < rows->total; count++)
+        {
+            rows->tab_int[count] = static_cast<int>(offset + count + 1);
+
+            if (offset + count + 1 == rows->null_row)
+            {
+                OCI_BindSetNullAtPos(bnd, count + 1);
+            }
+            else
+            {
+                OCI_BindSetNotNullAtPos(bnd, count + 1);
+            }
+        }
+
+        return count;
+    }
+
+    TEST(TestArray, InsertExternalArrayStream)
+    {
+        ExecDML(OTEXT("create table TestExternalArrayInsertArrayStream(code int NOT NULL)"));
+        ExecDML(OTEXT("truncate table TestExternalArrayInsertArrayStream"));
+
+        ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+        const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+        ASSERT_NE(nullptr, conn);
+
+        const auto stmt = OCI_StatementCreate(conn);
+        ASSERT_NE(nullptr, stmt);
+
+        ArrayStreamRows rows;
+        rows.total = ARRAY_SIZE * 2 + ARRAY_SIZE / 2;
+        rows.null_row = ARRAY_SIZE + 4;
+
+        ASSERT_TRUE(OCI_Prepare(stmt, OTEXT("insert into TestExternalArrayInsertArrayStream values(:i)")));
+        ASSERT_TRUE(OCI_BindArraySetSize(stmt, ARRAY_SIZE));
+        ASSERT_TRUE(OCI_BindArrayOfInts(stmt, OTEXT(":i"), static_cast<int*>(rows.tab_int), 0));
+
+        ASSERT_FALSE(OCI_ExecuteArrayStream(stmt, FillArrayStreamRows, &rows));
+
+        // The row of the second chunk must be reported with its global position
+        ASSERT_EQ(1, OCI_GetBatchErrorCount(stmt));
+
+        const auto err = OCI_GetBatchError(stmt);
+        ASSERT_NE(nullptr, err);
+        ASSERT_EQ(rows.null_row, OCI_ErrorGetRow(err));
+
+        // Bind array size is restored after the last partial chunk
+        ASSERT_EQ(ARRAY_SIZE, OCI_BindArrayGetSize(stmt));
+
+        ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select count(*) from TestExternalArrayInsertArrayStream")));
+
+        const auto rslt = OCI_GetResultset(stmt);
+        ASSERT_TRUE(OCI_FetchNext(rslt));
+        ASSERT_EQ(static_cast<int>(rows.total - 1), OCI_GetInt(rslt, 1));
+
+        ASSERT_TRUE(OCI_StatementFree(stmt));
+        ASSERT_TRUE(OCI_ConnectionFree(conn));
+        ASSERT_TRUE(OCI_Cleanup());
+
+        ExecDML(OTEXT("drop table TestExternalArrayInsertArrayStream"));
+    }
+
     TEST(TestArray, InsertInternalArray)
     {
         ExecDML(OTEXT("create table TestInternalArrayInsertArray(code int, name varchar2(50), creation date)"));
@@ -157,4 +343,111 @@ namespace TestCApi
 
         ExecDML(OTEXT("drop table TestInternalArrayInsertArray"));
     }
-}
\ No newline at end of file
+}
+
+namespace TestCppApi
+{
+    TEST(TestArray, InsertArrayInPlace)
+    {
+        ExecDML(OTEXT("create table TestArrayInsertInPlace(code int, value number, name varchar2(50))"));
+        ExecDML(OTEXT("truncate table TestArrayInsertInPlace"));
+
+        ocilib::Environment::Initialize();
+
+        {
+            ocilib::Connection con(DBS, USR, PWD);
+            ocilib::Statement st(con);
+
+            std::vector<int> codes(ARRAY_SIZE);
+            double values[ARRAY_SIZE];
+            short indicators[ARRAY_SIZE];
+            otext names[ARRAY_SIZE][STRING_SIZE + 1];
+            unsigned short lengths[ARRAY_SIZE];
+
+            st.Prepare(OTEXT("insert into TestArrayInsertInPlace values(:c, :v, :n)"));
+            st.SetBindArraySize(ARRAY_SIZE);
+            st.BindInPlace(OTEXT(":c"), codes, ocilib::BindInfo::In);
+            st.BindInPlace(OTEXT(":v"), values, ocilib::BindInfo::In, ocilib::BindInfo::AsArray, indicators);
+            st.BindInPlace(OTEXT(":n"), &names[0][0], STRING_SIZE, ARRAY_SIZE, ocilib::BindInfo::In, ocilib::BindInfo::AsArray, nullptr, lengths);
+
+            for (int i = 0; i < ARRAY_SIZE; i++)
+            {
+                codes[i] = i + 1;
+                values[i] = i * 1.5;
+                indicators[i] = (i % 2) ? -1 : 0;
+
+                const int len = osprintf(names[i], OTEXT("Name %d"), i + 1);
+                lengths[i] = static_cast<unsigned short>((len + 1) * sizeof(otext));
+            }
+
+            st.ExecutePrepared();
+
+            ASSERT_EQ(ARRAY_SIZE, st.GetAffectedRows());
+
+            st.Execute(OTEXT("select count(*), count(value), count(distinct name) from TestArrayInsertInPlace"));
+
+            auto rs = st.GetResultset();
+            ASSERT_TRUE(rs.Next());
+            ASSERT_EQ(ARRAY_SIZE, rs.Get<int>(1));
+            ASSERT_EQ(ARRAY_SIZE / 2, rs.Get<int>(2));
+            ASSERT_EQ(ARRAY_SIZE, rs.Get<int>(3));
+        }
+
+        ocilib::Environment::Cleanup();
+
+        ExecDML(OTEXT("drop table TestArrayInsertInPlace"));
+    }
+
+    TEST(TestArray, InsertArrayStream)
+    {
+        ExecDML(OTEXT("create table TestArrayInsertStream(code int, name varchar2(50))"));
+        ExecDML(OTEXT("truncate table TestArrayInsertStream"));
+
+        ocilib::Environment::Initialize();
+
+        {
+            ocilib::Connection con(DBS, USR, PWD);
+            ocilib::Statement st(con);
+
+            std::vector<int> source;
+            std::vector<int> codes(ARRAY_SIZE);
+            std::vector<ocilib::ostring> names(ARRAY_SIZE);
+
+            for (int i = 0; i < ARRAY_SIZE * 3 + 1; i++)
+            {
+                source.push_back(i + 1);
+            }
+
+            st.Prepare(OTEXT("insert into TestArrayInsertStream values(:c, :n)"));
+            st.SetBindArraySize(ARRAY_SIZE);
+            st.Bind(OTEXT(":c"), codes, ocilib::BindInfo::In);
+            st.Bind(OTEXT(":n"), names, STRING_SIZE, ocilib::BindInfo::In);
+
+            struct RowAssign
+            {
+                std::vector<int>& codes;
+                std::vector<ocilib::ostring>& names;
+
+                void operator()(int code, unsigned int index) const
+                {
+                    codes[index] = code;
+                    names[index] = OTEXT("Name ") + TO_STRING(code);
+                }
+            };
+
+            ASSERT_EQ(source.size(), st.ExecuteArrayStream(source.begin(), source.end(), RowAssign{ codes, names }));
+
+            st.Execute(OTEXT("select count(*), max(code), count(distinct name) from TestArrayInsertStream"));
+
+            auto rs = st.GetResultset();
+            ASSERT_TRUE(rs.Next());
+            ASSERT_EQ(static_cast<int>(source.size()), rs.Get<int>(1));
+            ASSERT_EQ(static_cast<int>(source.size()), rs.Get<int>(2));
+            ASSERT_EQ(static_cast<int>(source.size()), rs.Get<int>(3));
+        }
+
+        ocilib::Environment::Cleanup();
+
+        ExecDML(OTEXT("drop table TestArrayInsertStream"));
+    }
+}
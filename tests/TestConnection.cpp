@@ -22,6 +22,137 @@ namespace TestCApi
         ASSERT_TRUE(OCI_Cleanup());
     }
 
+    TEST(TestConnection, MemoryArena)
+    {
+        ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_THREADED | OCI_ENV_MEMORY_ARENA));
+
+        const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+        ASSERT_NE(nullptr, conn);
+
+        for (int i = 0; i < 100; i++)
+        {
+            const auto stmt = OCI_StatementCreate(conn);
+            ASSERT_NE(nullptr, stmt);
+
+            int value = 0;
+
+            ASSERT_TRUE(OCI_Prepare(stmt, OTEXT("select :value from dual")));
+            ASSERT_TRUE(OCI_BindInt(stmt, OTEXT(":value"), &value));
+
+            value = i;
+
+            ASSERT_TRUE(OCI_Execute(stmt));
+
+            const auto rslt = OCI_GetResultset(stmt);
+            ASSERT_NE(nullptr, rslt);
+            ASSERT_TRUE(OCI_FetchNext(rslt));
+            ASSERT_EQ(i, OCI_GetInt(rslt, 1));
+
+            if (i % 2)
+            {
+                ASSERT_TRUE(OCI_StatementFree(stmt));
+            }
+        }
+
+        ASSERT_TRUE(OCI_ConnectionFree(conn));
+        ASSERT_TRUE(OCI_Cleanup());
+    }
+
+    TEST(TestConnection, ManyStatements)
+    {
+        ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+        const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+        ASSERT_NE(nullptr, conn);
+
+        std::vector<OCI_Statement*> stmts;
+
+        for (int i = 0; i < 1000; i++)
+        {
+            const auto stmt = OCI_StatementCreate(conn);
+            ASSERT_NE(nullptr, stmt);
+
+            stmts.push_back(stmt);
+        }
+
+        /* free statements from the middle, the tail and the head of the connection list */
+
+        for (size_t i = 250; i < 500; i++)
+        {
+            ASSERT_TRUE(OCI_StatementFree(stmts[i]));
+        }
+
+        for (size_t i = stmts.size() - 1; i >= 900; i--)
+        {
+            ASSERT_TRUE(OCI_StatementFree(stmts[i]));
+        }
+
+        for (size_t i = 0; i < 100; i++)
+        {
+            ASSERT_TRUE(OCI_StatementFree(stmts[i]));
+        }
+
+        ASSERT_TRUE(OCI_ExecuteStmt(stmts[500], OTEXT("select 1 from dual")));
+
+        /* remaining statements are freed with the connection */
+
+        ASSERT_TRUE(OCI_ConnectionFree(conn));
+        ASSERT_TRUE(OCI_Cleanup());
+    }
+
+    TEST(TestConnection, PreparedCache)
+    {
+        ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+        const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+        ASSERT_NE(nullptr, conn);
+
+        ASSERT_EQ(0U, OCI_GetPreparedCacheSize(conn));
+        ASSERT_TRUE(OCI_SetPreparedCacheSize(conn, 2));
+        ASSERT_EQ(2U, OCI_GetPreparedCacheSize(conn));
+
+        for (int i = 0; i < 3; i++)
+        {
+            const auto stmt = OCI_StatementCreate(conn);
+            ASSERT_NE(nullptr, stmt);
+
+            ASSERT_TRUE(OCI_SetBindAllocation(stmt, OCI_BAM_INTERNAL));
+            ASSERT_TRUE(OCI_Prepare(stmt, OTEXT("select :value from dual")));
+
+            if (i == 0)
+            {
+                ASSERT_EQ(0U, OCI_GetBindCount(stmt));
+                ASSERT_TRUE(OCI_BindInt(stmt, OTEXT(":value"), NULL));
+            }
+            else
+            {
+                /* binds are retained by the cached statement */
+                ASSERT_EQ(1U, OCI_GetBindCount(stmt));
+            }
+
+            *static_cast<int*>(OCI_BindGetData(OCI_GetBind(stmt, 1))) = i;
+
+            ASSERT_TRUE(OCI_Execute(stmt));
+
+            const auto rslt = OCI_GetResultset(stmt);
+            ASSERT_NE(nullptr, rslt);
+            ASSERT_TRUE(OCI_FetchNext(rslt));
+            ASSERT_EQ(i, OCI_GetInt(rslt, 1));
+
+            ASSERT_TRUE(OCI_StatementFree(stmt));
+        }
+
+        ASSERT_EQ(2U, OCI_GetPreparedCacheValue(conn, OCI_PCV_HITS));
+        ASSERT_EQ(1U, OCI_GetPreparedCacheValue(conn, OCI_PCV_MISSES));
+        ASSERT_EQ(1U, OCI_GetPreparedCacheValue(conn, OCI_PCV_SIZE));
+
+        ASSERT_TRUE(OCI_SetPreparedCacheSize(conn, 0));
+        ASSERT_EQ(0U, OCI_GetPreparedCacheValue(conn, OCI_PCV_SIZE));
+
+        ASSERT_TRUE(OCI_ConnectionFree(conn));
+        ASSERT_TRUE(OCI_Cleanup());
+    }
+
     TEST(TestConnection, InvalidUser)
     {
         Guard guard(context.Lock);
@@ -96,4 +227,183 @@ namespace TestCApi
         ASSERT_TRUE(OCI_ConnectionFree(conn));
         ASSERT_TRUE(OCI_Cleanup());
     }
-}
\ No newline at end of file
+
+    TEST(TestConnection, ExecuteBatch)
+    {
+        ExecDML(OTEXT("create table TestConnectionExecuteBatch(code int primary key, name varchar2(30))"));
+        ExecDML(OTEXT("truncate table TestConnectionExecuteBatch"));
+
+        ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+        const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+        ASSERT_NE(nullptr, conn);
+
+        std::array<OCI_Statement*, 4> stmts{};
+        std::array<unsigned int, 4> rows{};
+
+        int codes[3] = { 1, 2, 1 };
+        otext name[31] = OTEXT("name: 'x'");
+
+        for (auto& stmt : stmts)
+        {
+            stmt = OCI_StatementCreate(conn);
+            ASSERT_NE(nullptr, stmt);
+        }
+
+        /* same bind names in several statements, placeholder like tokens in literals */
+
+        ASSERT_TRUE(OCI_Prepare(stmts[0], OTEXT("insert into TestConnectionExecuteBatch values(:code, :name);")));
+        ASSERT_TRUE(OCI_BindInt(stmts[0], OTEXT(":code"), &codes[0]));
+        ASSERT_TRUE(OCI_BindString(stmts[0], OTEXT(":name"), name, 30));
+
+        ASSERT_TRUE(OCI_Prepare(stmts[1], OTEXT("insert into TestConnectionExecuteBatch values(:code, ':name')")));
+        ASSERT_TRUE(OCI_BindInt(stmts[1], OTEXT(":code"), &codes[1]));
+
+        /* duplicated key */
+
+        ASSERT_TRUE(OCI_Prepare(stmts[2], OTEXT("insert into TestConnectionExecuteBatch values(:code, 'dup')")));
+        ASSERT_TRUE(OCI_BindInt(stmts[2], OTEXT(":code"), &codes[2]));
+
+        ASSERT_TRUE(OCI_Prepare(stmts[3], OTEXT("update TestConnectionExecuteBatch set name = upper(name) -- :none")));
+
+        ASSERT_FALSE(OCI_ExecuteBatch(conn, stmts.data(), static_cast<unsigned int>(stmts.size()), rows.data()));
+
+        ASSERT_EQ(1U, rows[0]);
+        ASSERT_EQ(1U, rows[1]);
+        ASSERT_EQ(0U, rows[2]);
+        ASSERT_EQ(2U, rows[3]);
+
+        ASSERT_EQ(0U, OCI_GetBatchErrorCount(stmts[1]));
+        ASSERT_EQ(1U, OCI_GetBatchErrorCount(stmts[2]));
+
+        const auto err = OCI_GetBatchError(stmts[2]);
+        ASSERT_NE(nullptr, err);
+        ASSERT_EQ(1, OCI_ErrorGetOCICode(err));
+        ASSERT_EQ(3U, OCI_ErrorGetRow(err));
+
+        /* the line comment ending the statement must not hide the end of its sub block */
+
+        ASSERT_TRUE(OCI_ExecuteBatch(conn, &stmts[3], 1, rows.data()));
+        ASSERT_EQ(2U, rows[0]);
+        ASSERT_EQ(0U, OCI_GetBatchErrorCount(stmts[3]));
+
+        ASSERT_TRUE(OCI_ExecuteStmt(stmts[0], OTEXT("select name from TestConnectionExecuteBatch order by code")));
+
+        const auto rslt = OCI_GetResultset(stmts[0]);
+        ASSERT_TRUE(OCI_FetchNext(rslt));
+        ASSERT_EQ(ostring(OTEXT("NAME: 'X'")), ostring(OCI_GetString(rslt, 1)));
+        ASSERT_TRUE(OCI_FetchNext(rslt));
+        ASSERT_EQ(ostring(OTEXT(":NAME")), ostring(OCI_GetString(rslt, 1)));
+
+        for (auto& stmt : stmts)
+        {
+            ASSERT_TRUE(OCI_StatementFree(stmt));
+        }
+
+        ASSERT_TRUE(OCI_ConnectionFree(conn));
+        ASSERT_TRUE(OCI_Cleanup());
+
+        ExecDML(OTEXT("drop table TestConnectionExecuteBatch"));
+    }
+
+    TEST(TestConnection, FormatParameterBindMode)
+    {
+        ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+        const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+        ASSERT_NE(nullptr, conn);
+
+        const auto stmt = OCI_StatementCreate(conn);
+        ASSERT_NE(nullptr, stmt);
+
+        ASSERT_EQ(OCI_FPM_LITERAL, OCI_GetFormatParameterMode(stmt));
+        ASSERT_TRUE(OCI_SetFormatParameterMode(stmt, OCI_FPM_BIND));
+        ASSERT_EQ(OCI_FPM_BIND, OCI_GetFormatParameterMode(stmt));
+
+        const auto date = OCI_DateCreate(conn);
+        ASSERT_NE(nullptr, date);
+        ASSERT_TRUE(OCI_DateSetDateTime(date, 2020, 2, 29, 13, 14, 15));
+
+        ostring sql;
+
+        for (int i = 1; i <= 2; i++)
+        {
+            ASSERT_TRUE(OCI_ExecuteStmtFmt(stmt, OTEXT("select %i + %li, %s, %s, %t, '%m' from %m"),
+                                           i, static_cast<big_int>(i), OTEXT("it's"), nullptr, date,
+                                           OTEXT("literal"), OTEXT("dual")));
+
+            /* SQL text does not depend on values */
+
+            if (sql.empty())
+            {
+                sql = OCI_GetSql(stmt);
+            }
+
+            ASSERT_EQ(sql, ostring(OCI_GetSql(stmt)));
+
+            const auto rslt = OCI_GetResultset(stmt);
+            ASSERT_NE(nullptr, rslt);
+            ASSERT_TRUE(OCI_FetchNext(rslt));
+
+            ASSERT_EQ(i * 2, OCI_GetInt(rslt, 1));
+            ASSERT_EQ(ostring(OTEXT("it's")), ostring(OCI_GetString(rslt, 2)));
+            ASSERT_TRUE(OCI_IsNull(rslt, 3));
+            ASSERT_EQ(0, OCI_DateCompare(date, OCI_GetDate(rslt, 4)));
+            ASSERT_EQ(ostring(OTEXT("literal")), ostring(OCI_GetString(rslt, 5)));
+        }
+
+        ASSERT_EQ(ostring(OTEXT("select :p1 + :p2, :p3, :p4, to_date(:p5, 'DDMMYYYYHH24MISS'), 'literal' from dual")), sql);
+
+        ASSERT_TRUE(OCI_DateFree(date));
+        ASSERT_TRUE(OCI_StatementFree(stmt));
+        ASSERT_TRUE(OCI_ConnectionFree(conn));
+        ASSERT_TRUE(OCI_Cleanup());
+    }
+}
+
+namespace TestCppApi
+{
+    TEST(TestConnection, ExecuteBatch)
+    {
+        ExecDML(OTEXT("create table TestConnectionExecuteBatchCpp(code int primary key, name varchar2(30))"));
+        ExecDML(OTEXT("truncate table TestConnectionExecuteBatchCpp"));
+
+        ocilib::Environment::Initialize();
+
+        {
+            ocilib::Connection con(DBS, USR, PWD);
+
+            std::vector<ocilib::Statement> statements;
+            std::vector<unsigned int> rows;
+
+            std::vector<int> codes = { 1, 2, 3 };
+            ocilib::ostring name = OTEXT("name");
+
+            for (auto& code : codes)
+            {
+                ocilib::Statement st(con);
+
+                st.Prepare(OTEXT("insert into TestConnectionExecuteBatchCpp values(:code, :name)"));
+                st.Bind(OTEXT(":code"), code, ocilib::BindInfo::In);
+                st.Bind(OTEXT(":name"), name, 30, ocilib::BindInfo::In);
+
+                statements.push_back(st);
+            }
+
+            ASSERT_TRUE(con.ExecuteBatch(statements, rows));
+            ASSERT_EQ(std::vector<unsigned int>({ 1, 1, 1 }), rows);
+
+            ASSERT_FALSE(con.ExecuteBatch(statements, rows));
+            ASSERT_EQ(std::vector<unsigned int>({ 0, 0, 0 }), rows);
+
+            std::vector<ocilib::Exception> errors;
+            statements[1].GetBatchErrors(errors);
+            ASSERT_EQ(1U, errors.size());
+            ASSERT_EQ(1, errors[0].GetOracleErrorCode());
+        }
+
+        ocilib::Environment::Cleanup();
+
+        ExecDML(OTEXT("drop table TestConnectionExecuteBatchCpp"));
+    }
+}
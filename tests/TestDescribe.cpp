@@ -135,4 +135,143 @@ namespace TestCApi
         ExecDML(OTEXT("drop type TestDescribeTableSubType"));
         ExecDML(OTEXT("drop type TestDescribeTable"));
     }     
+
+    TEST(TestDescribe, TypeInfoCache)
+    {
+        ExecDML
+        (
+            OTEXT("create type TestDescribeCacheSubType as OBJECT (id int, name varchar2(50))")
+        );
+
+        ExecDML
+        (
+            OTEXT("create type TestDescribeCacheType as object ")
+            OTEXT("( ")
+            OTEXT("    val_int  number, ")
+            OTEXT("    val_str  varchar2(30), ")
+            OTEXT("    val_obj  TestDescribeCacheSubType")
+            OTEXT(")")
+        );
+
+        ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_TYPEINFO_CACHE));
+
+        const auto conn1 = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+        ASSERT_NE(nullptr, conn1);
+
+        const auto conn2 = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+        ASSERT_NE(nullptr, conn2);
+
+        const auto typinf1 = OCI_TypeInfoGet(conn1, OTEXT("TestDescribeCacheType"), OCI_TIF_TYPE);
+        ASSERT_NE(nullptr, typinf1);
+
+        /* built from the description retrieved by the first connection */
+
+        const auto typinf2 = OCI_TypeInfoGet(conn2, OTEXT("TestDescribeCacheType"), OCI_TIF_TYPE);
+        ASSERT_NE(nullptr, typinf2);
+        ASSERT_NE(typinf1, typinf2);
+        ASSERT_EQ(conn2, OCI_TypeInfoGetConnection(typinf2));
+
+        ASSERT_EQ(3, OCI_TypeInfoGetColumnCount(typinf2));
+
+        CheckColumnType(1, typinf2, OTEXT("VAL_INT"), OTEXT("NUMBER"), OCI_CDT_NUMERIC);
+        CheckColumnType(2, typinf2, OTEXT("VAL_STR"), OTEXT("VARCHAR2"), OCI_CDT_TEXT);
+        CheckColumnType(3, typinf2, OTEXT("VAL_OBJ"), OTEXT("TESTDESCRIBECACHESUBTYPE"), OCI_CDT_OBJECT);
+
+        const auto obj = OCI_ObjectCreate(conn2, typinf2);
+        ASSERT_NE(nullptr, obj);
+        ASSERT_TRUE(OCI_ObjectSetInt(obj, OTEXT("VAL_INT"), 42));
+        ASSERT_EQ(42, OCI_ObjectGetInt(obj, OTEXT("VAL_INT")));
+        ASSERT_TRUE(OCI_ObjectFree(obj));
+
+        ASSERT_TRUE(OCI_TypeInfoInvalidate(OTEXT("TestDescribeCacheType")));
+        ASSERT_TRUE(OCI_TypeInfoInvalidate(nullptr));
+
+        const auto conn3 = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+        ASSERT_NE(nullptr, conn3);
+
+        const auto typinf3 = OCI_TypeInfoGet(conn3, OTEXT("TestDescribeCacheType"), OCI_TIF_TYPE);
+        ASSERT_NE(nullptr, typinf3);
+        ASSERT_EQ(3, OCI_TypeInfoGetColumnCount(typinf3));
+
+        ASSERT_TRUE(OCI_ConnectionFree(conn3));
+        ASSERT_TRUE(OCI_ConnectionFree(conn2));
+        ASSERT_TRUE(OCI_ConnectionFree(conn1));
+        ASSERT_TRUE(OCI_Cleanup());
+
+        ExecDML(OTEXT("drop type TestDescribeCacheType"));
+        ExecDML(OTEXT("drop type TestDescribeCacheSubType"));
+    }
+
+    TEST(TestDescribe, ResultsetKeptOnPrepare)
+    {
+        ExecDML(OTEXT("create table TestDescribeKept(code int, name varchar2(10))"));
+        ExecDML(OTEXT("insert into TestDescribeKept values(1, 'one')"));
+
+        ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+        const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+        ASSERT_NE(nullptr, conn);
+
+        const auto stmt = OCI_StatementCreate(conn);
+        ASSERT_NE(nullptr, stmt);
+
+        const auto sql = OTEXT("select * from TestDescribeKept");
+
+        ASSERT_TRUE(OCI_ExecuteStmt(stmt, sql));
+
+        const auto rslt1 = OCI_GetResultset(stmt);
+        ASSERT_NE(nullptr, rslt1);
+        ASSERT_TRUE(OCI_FetchNext(rslt1));
+        ASSERT_EQ(1, OCI_GetInt(rslt1, 1));
+
+        /* same SQL prepared again : described columns are kept */
+
+        ASSERT_TRUE(OCI_ExecuteStmt(stmt, sql));
+
+        const auto rslt2 = OCI_GetResultset(stmt);
+        ASSERT_EQ(rslt1, rslt2);
+        ASSERT_EQ(2U, OCI_GetColumnCount(rslt2));
+        ASSERT_TRUE(OCI_FetchNext(rslt2));
+        ASSERT_EQ(1, OCI_GetInt(rslt2, 1));
+        ASSERT_EQ(ostring(OTEXT("one")), ostring(OCI_GetString2(rslt2, OTEXT("NAME"))));
+        ASSERT_FALSE(OCI_FetchNext(rslt2));
+
+        /* select list altered in between : columns are described again */
+
+        ExecDML(OTEXT("alter table TestDescribeKept modify name varchar2(100)"));
+        ExecDML(OTEXT("alter table TestDescribeKept add extra int"));
+
+        ASSERT_TRUE(OCI_ExecuteStmt(stmt, sql));
+
+        const auto rslt3 = OCI_GetResultset(stmt);
+        ASSERT_NE(nullptr, rslt3);
+        ASSERT_EQ(3U, OCI_GetColumnCount(rslt3));
+        ASSERT_EQ(100U, OCI_ColumnGetSize(OCI_GetColumn(rslt3, 2)));
+        ASSERT_TRUE(OCI_FetchNext(rslt3));
+        ASSERT_EQ(ostring(OTEXT("one")), ostring(OCI_GetString(rslt3, 2)));
+
+        /* column renamed and its precision and scale altered : same count, type and size */
+
+        ExecDML(OTEXT("alter table TestDescribeKept rename column extra to other"));
+        ExecDML(OTEXT("alter table TestDescribeKept modify other number(10, 2)"));
+
+        ASSERT_TRUE(OCI_ExecuteStmt(stmt, sql));
+
+        const auto rslt4 = OCI_GetResultset(stmt);
+        ASSERT_NE(nullptr, rslt4);
+        ASSERT_EQ(3U, OCI_GetColumnCount(rslt4));
+
+        const auto col = OCI_GetColumn(rslt4, 3);
+        ASSERT_EQ(ostring(OTEXT("OTHER")), ostring(OCI_ColumnGetName(col)));
+        ASSERT_EQ(10, OCI_ColumnGetPrecision(col));
+        ASSERT_EQ(2, OCI_ColumnGetScale(col));
+        ASSERT_TRUE(OCI_FetchNext(rslt4));
+        ASSERT_TRUE(OCI_IsNull2(rslt4, OTEXT("OTHER")));
+
+        ASSERT_TRUE(OCI_StatementFree(stmt));
+        ASSERT_TRUE(OCI_ConnectionFree(conn));
+        ASSERT_TRUE(OCI_Cleanup());
+
+        ExecDML(OTEXT("drop table TestDescribeKept"));
+    }
 }
\ No newline at end of file
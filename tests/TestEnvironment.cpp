@@ -44,6 +44,185 @@ namespace TestCApi
 
 		ASSERT_TRUE(OCI_Cleanup());
 	}
+
+	TEST(TestEnvironment, AllocatedBytes)
+	{
+		ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_THREADED));
+
+		ASSERT_NE(0, OCI_GetAllocatedBytes(OCI_MEM_OCILIB));
+		ASSERT_NE(0, OCI_GetAllocatedBytes(OCI_MEM_ORACLE));
+
+		ASSERT_TRUE(OCI_Cleanup());
+	}
+
+	TEST(TestEnvironment, MemoryProfile)
+	{
+		ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_THREADED | OCI_ENV_MEMORY_PROFILING));
+
+		const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+		ASSERT_NE(nullptr, conn);
+
+		const auto size = OCI_GetMemoryProfileSize();
+		ASSERT_NE(0, size);
+
+		big_uint totalBytes = 0;
+		big_uint totalCount = 0;
+
+		for (unsigned int i = 1; i <= size; i++)
+		{
+			ASSERT_NE(nullptr, OCI_GetMemoryProfileName(i));
+
+			const auto bytes = OCI_GetMemoryProfileValue(i, OCI_MPV_BYTES);
+
+			ASSERT_GE(OCI_GetMemoryProfileValue(i, OCI_MPV_PEAK), bytes);
+
+			totalBytes += bytes;
+			totalCount += OCI_GetMemoryProfileValue(i, OCI_MPV_COUNT);
+		}
+
+		ASSERT_EQ(OCI_GetAllocatedBytes(OCI_MEM_ALL), totalBytes);
+		ASSERT_NE(0, totalCount);
+
+		ASSERT_EQ(nullptr, OCI_GetMemoryProfileName(size + 1));
+
+		ASSERT_TRUE(OCI_ConnectionFree(conn));
+		ASSERT_TRUE(OCI_Cleanup());
+	}
+
+	TEST(TestEnvironment, DescriptorPool)
+	{
+		ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_THREADED | OCI_ENV_DESCRIPTOR_POOL));
+
+		const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+		ASSERT_NE(nullptr, conn);
+
+		/* a statement preparing the same SELECT again keeps its described resultset,
+		   so each iteration uses its own statement to release its descriptors to the pool */
+
+		for (int i = 0; i < 3; i++)
+		{
+			const auto stmt = OCI_StatementCreate(conn);
+			ASSERT_NE(nullptr, stmt);
+
+			ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select systimestamp from dual")));
+
+			const auto rslt = OCI_GetResultset(stmt);
+			ASSERT_NE(nullptr, rslt);
+			ASSERT_TRUE(OCI_FetchNext(rslt));
+			ASSERT_NE(nullptr, OCI_GetTimestamp(rslt, 1));
+
+			ASSERT_TRUE(OCI_StatementFree(stmt));
+		}
+
+		ASSERT_EQ(1, OCI_GetDescriptorPoolValue(OCI_DPV_MISSES));
+		ASSERT_EQ(2, OCI_GetDescriptorPoolValue(OCI_DPV_HITS));
+		ASSERT_EQ(1, OCI_GetDescriptorPoolValue(OCI_DPV_SIZE));
+
+		ASSERT_TRUE(OCI_ConnectionFree(conn));
+		ASSERT_TRUE(OCI_Cleanup());
+	}
+
+	TEST(TestEnvironment, StatementStats)
+	{
+		ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_THREADED | OCI_ENV_STATEMENT_STATS));
+
+		const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+		ASSERT_NE(nullptr, conn);
+
+		const auto stmt = OCI_StatementCreate(conn);
+		ASSERT_NE(nullptr, stmt);
+
+		ASSERT_TRUE(OCI_SetFetchSize(stmt, 3));
+		ASSERT_TRUE(OCI_Prepare(stmt, OTEXT("select level from dual connect by level <= 10")));
+
+		for (int i = 0; i < 2; i++)
+		{
+			ASSERT_TRUE(OCI_Execute(stmt));
+
+			const auto rslt = OCI_GetResultset(stmt);
+			ASSERT_NE(nullptr, rslt);
+
+			while (OCI_FetchNext(rslt))
+			{
+			}
+		}
+
+		ASSERT_EQ(1, OCI_GetStatementStats(stmt, OCI_SSV_PREPARE_COUNT));
+		ASSERT_EQ(2, OCI_GetStatementStats(stmt, OCI_SSV_EXECUTE_COUNT));
+		ASSERT_EQ(8, OCI_GetStatementStats(stmt, OCI_SSV_FETCH_COUNT));
+		ASSERT_EQ(20, OCI_GetStatementStats(stmt, OCI_SSV_ROWS_FETCHED));
+		ASSERT_EQ(10, OCI_GetStatementStats(stmt, OCI_SSV_ROUND_TRIPS));
+		ASSERT_NE(0, OCI_GetStatementStats(stmt, OCI_SSV_DEFINE_BYTES));
+
+		ASSERT_EQ(1, OCI_GetSqlStatsSize());
+		ASSERT_EQ(ostring(OTEXT("select level from dual connect by level <= 10")), ostring(OCI_GetSqlStatsName(1)));
+		ASSERT_EQ(2, OCI_GetSqlStatsValue(1, OCI_SSV_EXECUTE_COUNT));
+		ASSERT_EQ(20, OCI_GetSqlStatsValue(1, OCI_SSV_ROWS_FETCHED));
+
+		const auto sqlId = OCI_GetSqlIdentifier(stmt);
+		ASSERT_NE(nullptr, sqlId);
+		ASSERT_NE(ostring(), ostring(sqlId));
+
+		ASSERT_TRUE(OCI_Prepare(stmt, OTEXT("select sysdate from dual")));
+		ASSERT_EQ(0, OCI_GetStatementStats(stmt, OCI_SSV_EXECUTE_COUNT));
+		ASSERT_EQ(2, OCI_GetSqlStatsSize());
+
+		ASSERT_TRUE(OCI_StatementFree(stmt));
+		ASSERT_TRUE(OCI_ConnectionFree(conn));
+		ASSERT_TRUE(OCI_Cleanup());
+	}
+
+	static std::atomic<size_t> AllocCount{ 0 };
+	static std::atomic<size_t> FreeCount{ 0 };
+
+	static void* CountingAlloc(size_t size)
+	{
+		++AllocCount;
+		return malloc(size);
+	}
+
+	static void* CountingRealloc(void* ptr, size_t size)
+	{
+		return realloc(ptr, size);
+	}
+
+	static void CountingFree(void* ptr)
+	{
+		++FreeCount;
+		free(ptr);
+	}
+
+	TEST(TestEnvironment, SetMemoryHandlers)
+	{
+		AllocCount = 0;
+		FreeCount = 0;
+
+		ASSERT_TRUE(OCI_SetMemoryHandlers(CountingAlloc, CountingRealloc, CountingFree));
+
+		ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+		const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+		ASSERT_NE(nullptr, conn);
+
+		ASSERT_FALSE(OCI_SetMemoryHandlers(nullptr, nullptr, nullptr));
+
+		ASSERT_TRUE(OCI_ConnectionFree(conn));
+		ASSERT_TRUE(OCI_Cleanup());
+
+		ASSERT_TRUE(OCI_SetMemoryHandlers(nullptr, nullptr, nullptr));
+
+		ASSERT_NE(0, AllocCount);
+		ASSERT_NE(0, FreeCount);
+	}
+
+	TEST(TestEnvironment, AllocatedBytesNoMemoryStats)
+	{
+		ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_THREADED | OCI_ENV_NO_MEMORY_STATS));
+
+		ASSERT_EQ(0, OCI_GetAllocatedBytes(OCI_MEM_ALL));
+
+		ASSERT_TRUE(OCI_Cleanup());
+	}
 }
 
 namespace TestCppApi
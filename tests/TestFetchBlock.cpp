@@ -0,0 +1,429 @@
+#include "ocilib_tests.h"
+
+namespace TestCApi
+{
+    TEST(TestFetchBlock, FetchBlock)
+    {
+        ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+        const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+        ASSERT_NE(nullptr, conn);
+
+        const auto stmt = OCI_StatementCreate(conn);
+        ASSERT_NE(nullptr, stmt);
+
+        ASSERT_TRUE(OCI_SetFetchSize(stmt, 30));
+        ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select level, decode(mod(level, 10), 0, null, 'row ' || level) from dual connect by level <= 100")));
+
+        const auto rslt = OCI_GetResultset(stmt);
+        ASSERT_NE(nullptr, rslt);
+
+        unsigned int total = 0;
+        unsigned int nulls = 0;
+        unsigned int rows = 0;
+
+        /* consume the first row with the regular API, the remaining rows of the array form the first block */
+
+        ASSERT_TRUE(OCI_FetchNext(rslt));
+        ASSERT_EQ(1, OCI_GetInt(rslt, 1));
+        total++;
+
+        while (OCI_FetchBlock(rslt, &rows))
+        {
+            ASSERT_EQ(rows, OCI_GetBlockRowCount(rslt));
+            ASSERT_EQ(total == 1 ? 29u : std::min(30u, 100u - total), rows);
+
+            const void* data = nullptr;
+            unsigned int size = 0;
+            const short* inds = nullptr;
+            const unsigned short* lens = nullptr;
+
+            ASSERT_TRUE(OCI_GetColumnBlock(rslt, 2, &data, &size, &inds, &lens));
+            ASSERT_NE(nullptr, data);
+            ASSERT_NE(0u, size);
+
+            for (unsigned int i = 0; i < rows; i++)
+            {
+                if (inds[i] == -1)
+                {
+                    nulls++;
+                }
+            }
+
+            total += rows;
+
+            ASSERT_EQ(static_cast<int>(total), OCI_GetInt(rslt, 1));
+        }
+
+        ASSERT_EQ(100u, total);
+        ASSERT_EQ(10u, nulls);
+        ASSERT_EQ(0u, OCI_GetBlockRowCount(rslt));
+
+        ASSERT_TRUE(OCI_StatementFree(stmt));
+        ASSERT_TRUE(OCI_ConnectionFree(conn));
+        ASSERT_TRUE(OCI_Cleanup());
+    }
+
+    TEST(TestFetchBlock, ArrowExport)
+    {
+        ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT | OCI_ENV_CONTEXT));
+
+        const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+        ASSERT_NE(nullptr, conn);
+
+        const auto stmt = OCI_StatementCreate(conn);
+        ASSERT_NE(nullptr, stmt);
+
+        ASSERT_TRUE(OCI_SetFetchSize(stmt, 40));
+        ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select cast(level as number(10)) id, cast(-level / 4 as number(10, 2)) amount, ")
+                                          OTEXT("decode(mod(level, 10), 0, null, 'row ' || level) label, ")
+                                          OTEXT("to_date('2020-01-01', 'YYYY-MM-DD') + level day, hextoraw('ABCD') code ")
+                                          OTEXT("from dual connect by level <= 100")));
+
+        const auto rslt = OCI_GetResultset(stmt);
+        ASSERT_NE(nullptr, rslt);
+
+        ArrowSchema schema;
+        ArrowArray array;
+
+        /* arrays are exported from blocks only */
+
+        ASSERT_FALSE(OCI_ResultsetToArrow(rslt, nullptr, &array));
+        ASSERT_EQ(nullptr, array.release);
+        ASSERT_NE(nullptr, OCI_GetLastError());
+        ASSERT_EQ(OCI_ERR_ARG_INVALID_VALUE, OCI_ErrorGetInternalCode(OCI_GetLastError()));
+
+        ASSERT_TRUE(OCI_ResultsetToArrow(rslt, &schema, nullptr));
+        ASSERT_NE(nullptr, schema.release);
+        ASSERT_STREQ("+s", schema.format);
+        ASSERT_EQ(5, schema.n_children);
+        ASSERT_STREQ("ID", schema.children[0]->name);
+        ASSERT_STREQ("l", schema.children[0]->format);
+        ASSERT_STREQ("d:10,2", schema.children[1]->format);
+        ASSERT_STREQ("u", schema.children[2]->format);
+        ASSERT_STREQ("tss:", schema.children[3]->format);
+        ASSERT_STREQ("z", schema.children[4]->format);
+
+        schema.release(&schema);
+        ASSERT_EQ(nullptr, schema.release);
+
+        unsigned int total = 0;
+        unsigned int nulls = 0;
+        unsigned int rows = 0;
+
+        while (OCI_FetchBlock(rslt, &rows))
+        {
+            ASSERT_TRUE(OCI_ResultsetToArrow(rslt, nullptr, &array));
+            ASSERT_EQ(static_cast<int64_t>(rows), array.length);
+            ASSERT_EQ(5, array.n_children);
+
+            const auto ids = static_cast<const int64_t*>(array.children[0]->buffers[1]);
+            const auto amounts = static_cast<const int64_t*>(array.children[1]->buffers[1]);
+            const auto offsets = static_cast<const int32_t*>(array.children[2]->buffers[1]);
+            const auto labels = static_cast<const char*>(array.children[2]->buffers[2]);
+            const auto days = static_cast<const int64_t*>(array.children[3]->buffers[1]);
+            const auto codes = static_cast<const unsigned char*>(array.children[4]->buffers[2]);
+
+            for (unsigned int i = 0; i < rows; i++)
+            {
+                const int64_t level = total + i + 1;
+
+                ASSERT_EQ(level, ids[i]);
+                ASSERT_EQ(-level * 25, amounts[i * 2]);
+                ASSERT_EQ(-1, amounts[i * 2 + 1]);
+                ASSERT_EQ(1577836800 + level * 86400, days[i]);
+                ASSERT_EQ(0xAB, codes[i * 2]);
+                ASSERT_EQ(0xCD, codes[i * 2 + 1]);
+
+                if (level % 10 == 0)
+                {
+                    ASSERT_EQ(offsets[i], offsets[i + 1]);
+                }
+                else
+                {
+                    const std::string label = "row " + std::to_string(level);
+
+                    ASSERT_EQ(label, std::string(labels + offsets[i], offsets[i + 1] - offsets[i]));
+                }
+            }
+
+            nulls += static_cast<unsigned int>(array.children[2]->null_count);
+            total += rows;
+
+            array.release(&array);
+            ASSERT_EQ(nullptr, array.release);
+        }
+
+        ASSERT_EQ(100u, total);
+        ASSERT_EQ(10u, nulls);
+
+        ASSERT_TRUE(OCI_StatementFree(stmt));
+        ASSERT_TRUE(OCI_ConnectionFree(conn));
+        ASSERT_TRUE(OCI_Cleanup());
+    }
+
+    TEST(TestFetchBlock, FetchMemory)
+    {
+        ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_THREADED | OCI_ENV_STATEMENT_STATS));
+
+        const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+        ASSERT_NE(nullptr, conn);
+
+        const auto stmt = OCI_StatementCreate(conn);
+        ASSERT_NE(nullptr, stmt);
+
+        ASSERT_EQ(0, OCI_GetFetchMemory(stmt));
+        ASSERT_TRUE(OCI_SetFetchMemory(stmt, 1024 * 1024));
+        ASSERT_EQ(1024 * 1024, OCI_GetFetchMemory(stmt));
+
+        ASSERT_TRUE(OCI_Prepare(stmt, OTEXT("select level, rpad('x', 100, 'x') from dual connect by level <= 10000")));
+
+        for (int i = 0; i < 2; i++)
+        {
+            ASSERT_TRUE(OCI_Execute(stmt));
+
+            const auto rslt = OCI_GetResultset(stmt);
+            ASSERT_NE(nullptr, rslt);
+
+            int count = 0;
+
+            while (OCI_FetchNext(rslt))
+            {
+                ASSERT_EQ(++count, OCI_GetInt(rslt, 1));
+            }
+
+            ASSERT_EQ(10000, count);
+        }
+
+        ASSERT_EQ(20000, OCI_GetStatementStats(stmt, OCI_SSV_ROWS_FETCHED));
+        ASSERT_GE(2 * (10000 / OCI_FETCH_SIZE + 1), OCI_GetStatementStats(stmt, OCI_SSV_FETCH_COUNT));
+
+        /* a budget smaller than a row limits the fetch array to one row: one call per row
+           plus the one reaching the end of the resultset */
+
+        ASSERT_TRUE(OCI_SetFetchMemory(stmt, 1));
+        ASSERT_TRUE(OCI_Prepare(stmt, OTEXT("select level from dual connect by level <= 10")));
+        ASSERT_TRUE(OCI_Execute(stmt));
+
+        const auto rslt = OCI_GetResultset(stmt);
+        ASSERT_NE(nullptr, rslt);
+
+        int count = 0;
+
+        while (OCI_FetchNext(rslt))
+        {
+            ASSERT_EQ(++count, OCI_GetInt(rslt, 1));
+        }
+
+        ASSERT_EQ(10, count);
+        ASSERT_EQ(11, OCI_GetStatementStats(stmt, OCI_SSV_FETCH_COUNT));
+
+        ASSERT_TRUE(OCI_StatementFree(stmt));
+        ASSERT_TRUE(OCI_ConnectionFree(conn));
+        ASSERT_TRUE(OCI_Cleanup());
+    }
+
+    TEST(TestFetchBlock, ReadAhead)
+    {
+        ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_THREADED));
+
+        const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+        ASSERT_NE(nullptr, conn);
+
+        const auto stmt = OCI_StatementCreate(conn);
+        ASSERT_NE(nullptr, stmt);
+
+        ASSERT_FALSE(OCI_GetReadAhead(stmt));
+        ASSERT_TRUE(OCI_SetReadAhead(stmt, TRUE));
+        ASSERT_TRUE(OCI_GetReadAhead(stmt));
+
+        ASSERT_TRUE(OCI_SetFetchSize(stmt, 7));
+        ASSERT_TRUE(OCI_Prepare(stmt, OTEXT("select level, 'row ' || level, sysdate + level from dual connect by level <= 1000")));
+
+        for (int i = 0; i < 2; i++)
+        {
+            ASSERT_TRUE(OCI_Execute(stmt));
+
+            const auto rslt = OCI_GetResultset(stmt);
+            ASSERT_NE(nullptr, rslt);
+
+            int count = 0;
+            otext buffer[32];
+
+            while (OCI_FetchNext(rslt))
+            {
+                count++;
+                osprintf(buffer, OTEXT("row %d"), count);
+
+                ASSERT_EQ(count, OCI_GetInt(rslt, 1));
+                ASSERT_EQ(ostring(buffer), ostring(OCI_GetString(rslt, 2)));
+                ASSERT_NE(nullptr, OCI_GetDate(rslt, 3));
+            }
+
+            ASSERT_EQ(1000, count);
+        }
+
+        /* stop consuming rows while the next ones are being fetched */
+
+        ASSERT_TRUE(OCI_Execute(stmt));
+        ASSERT_TRUE(OCI_FetchNext(OCI_GetResultset(stmt)));
+
+        ASSERT_TRUE(OCI_StatementFree(stmt));
+        ASSERT_TRUE(OCI_ConnectionFree(conn));
+        ASSERT_TRUE(OCI_Cleanup());
+    }
+}
+
+namespace TestCppApi
+{
+    struct MappedRow
+    {
+        int Id;
+        ocilib::ostring Name;
+        ocilib::Date Day;
+    };
+}
+
+namespace ocilib
+{
+    template<>
+    struct RowTraits<TestCppApi::MappedRow>
+    {
+        static std::tuple<int TestCppApi::MappedRow::*, ostring TestCppApi::MappedRow::*, Date TestCppApi::MappedRow::*> Fields()
+        {
+            return std::make_tuple(&TestCppApi::MappedRow::Id, &TestCppApi::MappedRow::Name, &TestCppApi::MappedRow::Day);
+        }
+    };
+}
+
+namespace TestCppApi
+{
+    using namespace ocilib;
+
+    TEST(TestFetchBlock, ColumnBlock)
+    {
+        Environment::Initialize();
+
+        Connection conn(DBS, USR, PWD);
+        Statement stmt(conn);
+
+        stmt.SetFetchSize(25);
+        stmt.Execute(OTEXT("select level, level / 2, cast(level as binary_double), 'row ' || level, hextoraw('AB'), -level * 12345.5, -level * 1000000000000 from dual connect by level <= 100"));
+
+        auto rs = stmt.GetResultset();
+
+        int total = 0;
+
+        while (unsigned int rows = rs.FetchBlock())
+        {
+            ASSERT_EQ(25u, rows);
+
+            auto ints = rs.GetColumnBlock<int>(1);
+            auto halves = rs.GetColumnBlock<double>(2);
+            auto doubles = rs.GetColumnBlock<double>(3);
+            auto strings = rs.GetColumnBlock<ostring>(4);
+            auto raws = rs.GetColumnBlock<Raw>(5);
+            auto negatives = rs.GetColumnBlock<double>(6);
+            auto bigs = rs.GetColumnBlock<big_int>(7);
+            auto truncated = rs.GetColumnBlock<int>(6);
+
+            ASSERT_EQ(rows, ints.GetCount());
+
+            try
+            {
+                rs.GetColumnBlock<int>(4);
+                FAIL();
+            }
+            catch (const Exception& ex)
+            {
+                ASSERT_EQ(OCI_ERR_NOT_COMPATIBLE, ex.GetInternalErrorCode());
+            }
+
+            for (unsigned int i = 0; i < rows; i++)
+            {
+                const int value = ++total;
+
+                ASSERT_FALSE(ints.IsNull(i));
+                ASSERT_EQ(value, ints[i]);
+                ASSERT_EQ(value / 2.0, halves[i]);
+                ASSERT_EQ(static_cast<double>(value), doubles[i]);
+                ASSERT_EQ(OTEXT("row ") + TO_STRING(value), strings[i]);
+                ASSERT_EQ(Raw({ 0xAB }), raws[i]);
+                ASSERT_EQ(-value * 12345.5, negatives[i]);
+                ASSERT_EQ(-value * 1000000000000LL, bigs[i]);
+                ASSERT_EQ(static_cast<int>(-value * 12345.5), truncated[i]);
+            }
+        }
+
+        ASSERT_EQ(100, total);
+
+        Environment::Cleanup();
+    }
+
+    TEST(TestFetchBlock, RowMapping)
+    {
+        Environment::Initialize();
+
+        Connection conn(DBS, USR, PWD);
+        Statement stmt(conn);
+
+        const ostring sql = OTEXT("select level, decode(mod(level, 10), 0, null, 'row ' || level), date '2024-03-15' + level - 1 from dual connect by level <= 100");
+
+        stmt.SetFetchSize(30);
+        stmt.Execute(sql);
+
+        auto tuples = stmt.GetResultset().Map<std::tuple<int, ostring, Date>>();
+
+        int total = 0;
+
+        while (tuples.Next())
+        {
+            const auto& row = tuples.Get();
+            const int value = ++total;
+
+            Date day(OTEXT("2024-03-15"), OTEXT("YYYY-MM-DD"));
+            day.AddDays(value - 1);
+
+            ASSERT_EQ(value, std::get<0>(row));
+            ASSERT_EQ(value % 10 == 0, tuples.IsNull(2));
+            ASSERT_EQ(value % 10 == 0 ? ostring() : OTEXT("row ") + TO_STRING(value), std::get<1>(row));
+            ASSERT_EQ(day, std::get<2>(row));
+        }
+
+        ASSERT_EQ(100, total);
+
+        stmt.Execute(sql);
+
+        auto rows = stmt.GetResultset().Map<MappedRow>();
+
+        total = 0;
+
+        ASSERT_EQ(100u, rows.ForEach([&total](const MappedRow& row) { return row.Id == ++total; }));
+
+        stmt.Execute(sql);
+
+        auto rs = stmt.GetResultset();
+
+        try
+        {
+            rs.Map<std::tuple<int, ostring>>();
+            FAIL();
+        }
+        catch (const Exception& ex)
+        {
+            ASSERT_EQ(OCI_ERR_NOT_COMPATIBLE, ex.GetInternalErrorCode());
+        }
+
+        try
+        {
+            rs.Map<std::tuple<int, int, Date>>();
+            FAIL();
+        }
+        catch (const Exception& ex)
+        {
+            ASSERT_EQ(OCI_ERR_NOT_COMPATIBLE, ex.GetInternalErrorCode());
+        }
+
+        Environment::Cleanup();
+    }
+}
@@ -0,0 +1,69 @@
+#include "ocilib_tests.h"
+
+namespace TestCApi
+{
+    TEST(TestHashTable, GrowAndLookup)
+    {
+        ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+        const auto table = OCI_HashCreate(4, OCI_HASH_INTEGER);
+        ASSERT_NE(nullptr, table);
+
+        otext name[32];
+
+        for (int i = 0; i < 500; i++)
+        {
+            osprintf(name, OTEXT("Column_%d"), i);
+            ASSERT_TRUE(OCI_HashAddInt(table, name, i));
+        }
+
+        ASSERT_LE(500, OCI_HashGetSize(table));
+
+        for (int i = 0; i < 500; i++)
+        {
+            osprintf(name, OTEXT("COLUMN_%d"), i);
+            ASSERT_EQ(i, OCI_HashGetInt(table, name));
+        }
+
+        ASSERT_EQ(nullptr, OCI_HashLookup(table, OTEXT("Column_500"), FALSE));
+
+        unsigned int count = 0;
+
+        for (unsigned int i = 0, n = OCI_HashGetSize(table); i < n; i++)
+        {
+            const auto entry = OCI_HashGetEntry(table, i);
+
+            if (entry)
+            {
+                ASSERT_EQ(nullptr, entry->next);
+                count++;
+            }
+        }
+
+        ASSERT_EQ(500, count);
+
+        ASSERT_TRUE(OCI_HashFree(table));
+        ASSERT_TRUE(OCI_Cleanup());
+    }
+
+    TEST(TestHashTable, MultipleValues)
+    {
+        ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+        const auto table = OCI_HashCreate(OCI_HASH_DEFAULT_SIZE, OCI_HASH_STRING);
+        ASSERT_NE(nullptr, table);
+
+        ASSERT_TRUE(OCI_HashAddString(table, OTEXT("key"), OTEXT("value1")));
+        ASSERT_TRUE(OCI_HashAddString(table, OTEXT("KEY"), OTEXT("value2")));
+
+        const auto value = OCI_HashGetValue(table, OTEXT("Key"));
+        ASSERT_NE(nullptr, value);
+        ASSERT_EQ(ostring(OTEXT("value1")), ostring(value->value.p_text));
+        ASSERT_NE(nullptr, value->next);
+        ASSERT_EQ(ostring(OTEXT("value2")), ostring(value->next->value.p_text));
+        ASSERT_EQ(nullptr, value->next->next);
+
+        ASSERT_TRUE(OCI_HashFree(table));
+        ASSERT_TRUE(OCI_Cleanup());
+    }
+}
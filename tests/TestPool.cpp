@@ -50,4 +50,107 @@ namespace TestCApi
 
         ASSERT_EQ(MaxThread, ConnCreatedCount);
     }
+
+    struct ParallelQuerySum
+    {
+        int count;
+        int sum;
+    };
+
+    static boolean ParallelQueryConsumer(OCI_Resultset* rslt, unsigned int partition, void* ctx)
+    {
+        const auto total = static_cast<ParallelQuerySum*>(ctx);
+
+        EXPECT_GE(partition, 1u);
+        EXPECT_LE(partition, 4u);
+
+        total->count++;
+        total->sum += OCI_GetInt(rslt, 1);
+
+        return TRUE;
+    }
+
+    TEST(TestPool, ParallelQueryHash)
+    {
+        ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT | OCI_ENV_THREADED));
+
+        const auto pool = OCI_PoolCreate(DBS, USR, PWD, OCI_POOL_SESSION, OCI_SESSION_DEFAULT, 0, 4, 1);
+        ASSERT_NE(nullptr, pool);
+
+        ParallelQuerySum total{ 0, 0 };
+
+        ASSERT_TRUE(OCI_ParallelQuery(pool,
+                                      OTEXT("select n from (select level n from dual connect by level <= 100) ")
+                                      OTEXT("where ora_hash(n, :pq_max_bucket) = :pq_bucket"),
+                                      OCI_PQM_HASH, 4, nullptr, 10, ParallelQueryConsumer, &total));
+
+        ASSERT_EQ(100, total.count);
+        ASSERT_EQ(5050, total.sum);
+
+        ASSERT_TRUE(OCI_PoolFree(pool));
+        ASSERT_TRUE(OCI_Cleanup());
+    }
+
+    TEST(TestPool, ParallelQueryRowid)
+    {
+        ExecDML(OTEXT("create table TestPoolParallelRowid(n int)"));
+        ExecDML(OTEXT("insert into TestPoolParallelRowid select level from dual connect by level <= 1000"));
+
+        ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT | OCI_ENV_THREADED));
+
+        const auto pool = OCI_PoolCreate(DBS, USR, PWD, OCI_POOL_SESSION, OCI_SESSION_DEFAULT, 0, 4, 1);
+        ASSERT_NE(nullptr, pool);
+
+        const otext* args[] = { OTEXT("TestPoolParallelRowid") };
+
+        ParallelQuerySum total{ 0, 0 };
+
+        ASSERT_TRUE(OCI_ParallelQuery(pool,
+                                      OTEXT("select n from TestPoolParallelRowid ")
+                                      OTEXT("where rowid between chartorowid(:pq_low) and chartorowid(:pq_high)"),
+                                      OCI_PQM_ROWID, 4, args, 10, ParallelQueryConsumer, &total));
+
+        ASSERT_EQ(1000, total.count);
+        ASSERT_EQ(500500, total.sum);
+
+        ASSERT_TRUE(OCI_PoolFree(pool));
+        ASSERT_TRUE(OCI_Cleanup());
+
+        ExecDML(OTEXT("drop table TestPoolParallelRowid"));
+    }
+}
+
+namespace TestCppApi
+{
+    using namespace ocilib;
+
+    TEST(TestPool, ParallelQueryRange)
+    {
+        Environment::Initialize(Environment::Threaded);
+
+        Pool pool(DBS, USR, PWD, Pool::SessionPool, 0, 3, 1);
+
+        std::vector<ostring> ranges{ OTEXT("1"), OTEXT("30"), OTEXT("31"), OTEXT("60"), OTEXT("61"), OTEXT("100") };
+
+        int count = 0;
+        int sum = 0;
+
+        pool.ParallelQuery(OTEXT("select n from (select level n from dual connect by level <= 100) ")
+                           OTEXT("where n between to_number(:pq_low) and to_number(:pq_high)"),
+                           Pool::ParallelRange, 3, ranges,
+                           [&](const Resultset& rs, unsigned int partition)
+                           {
+                               EXPECT_LE(partition, 3u);
+                               count++;
+                               sum += rs.Get<int>(1);
+                               return true;
+                           });
+
+        ASSERT_EQ(100, count);
+        ASSERT_EQ(5050, sum);
+
+        pool.Close();
+
+        Environment::Cleanup();
+    }
 }
\ No newline at end of file
@@ -15,6 +15,37 @@ static void WorkerProc(OCI_Thread* thread, void* data)
     ++ThreadProcCallCount;
 }
 
+struct AsyncFetchState
+{
+    std::atomic<int> Rows{ 0 };
+    std::atomic<int> Sum{ 0 };
+    std::atomic<bool> Failed{ false };
+};
+
+static void AsyncHandler(OCI_Statement* stmt, unsigned int type, boolean result, void* ctx)
+{
+    auto state = static_cast<AsyncFetchState*>(ctx);
+
+    if (!result && OCI_GetLastError())
+    {
+        state->Failed = true;
+    }
+    else if (type == OCI_ACT_EXECUTE)
+    {
+        /* chain the first fetch from the completion handler */
+        state->Failed = !OCI_FetchNextAsync(OCI_GetResultset(stmt), AsyncHandler, ctx);
+    }
+    else if (type == OCI_ACT_FETCH && result)
+    {
+        auto rslt = OCI_GetResultset(stmt);
+
+        ++state->Rows;
+        state->Sum += OCI_GetInt(rslt, 1);
+
+        state->Failed = !OCI_FetchNextAsync(rslt, AsyncHandler, ctx);
+    }
+}
+
 namespace TestCApi
 {
     TEST(TestThread, RunAndJoin)
@@ -40,4 +71,113 @@ namespace TestCApi
 
         ASSERT_EQ(MaxThread, ThreadProcCallCount);
     }
-}
\ No newline at end of file
+
+    TEST(TestThread, ExecuteAndFetchAsync)
+    {
+        ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT | OCI_ENV_THREADED | OCI_ENV_CONTEXT));
+
+        const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+        ASSERT_NE(nullptr, conn);
+
+        const auto stmt = OCI_StatementCreate(conn);
+        ASSERT_NE(nullptr, stmt);
+
+        AsyncFetchState state;
+
+        ASSERT_TRUE(OCI_Prepare(stmt, OTEXT("select level from dual connect by level <= 10")));
+        ASSERT_TRUE(OCI_ExecuteAsync(stmt, AsyncHandler, &state));
+        ASSERT_TRUE(OCI_WaitAsync(stmt));
+
+        ASSERT_EQ(OCI_ACS_COMPLETED, OCI_GetAsyncStatus(stmt));
+        ASSERT_FALSE(state.Failed);
+        ASSERT_EQ(10, state.Rows);
+        ASSERT_EQ(55, state.Sum);
+
+        ASSERT_TRUE(OCI_StatementFree(stmt));
+        ASSERT_TRUE(OCI_ConnectionFree(conn));
+        ASSERT_TRUE(OCI_Cleanup());
+    }
+}
+
+namespace TestCppApi
+{
+    TEST(TestThread, ExecuteAndFetchAsync)
+    {
+        ocilib::Environment::Initialize(ocilib::Environment::Threaded);
+
+        {
+            ocilib::Connection con(DBS, USR, PWD);
+            ocilib::Statement st(con);
+
+            st.ExecuteAsync(OTEXT("select level from dual connect by level <= 10")).get();
+
+            auto rs = st.GetResultset();
+
+            int sum = 0;
+
+            while (rs.NextAsync().get())
+            {
+                sum += rs.Get<int>(1);
+            }
+
+            ASSERT_EQ(10, rs.GetCount());
+            ASSERT_EQ(55, sum);
+
+            st.Prepare(OTEXT("select * from dual where 1 = :x"));
+
+            auto future = st.ExecutePreparedAsync();
+
+            ASSERT_THROW(future.get(), ocilib::Exception);
+        }
+
+        ocilib::Environment::Cleanup();
+    }
+
+#ifdef OCILIBPP_HAS_COROUTINE
+
+    static ocilib::Task<int> FetchLevelsAsync(ocilib::Executor& executor, ocilib::Connection con, int count)
+    {
+        ocilib::Statement st(con);
+
+        st.Prepare(OTEXT("select level from dual connect by level <= :n"));
+        st.Bind(OTEXT(":n"), count, ocilib::BindInfo::In);
+
+        co_await st.ExecutePreparedAsync(executor);
+
+        auto rs = st.GetResultset();
+
+        int sum = 0;
+
+        while (co_await rs.NextAsync(executor))
+        {
+            sum += rs.Get<int>(1);
+        }
+
+        co_return sum;
+    }
+
+    static ocilib::Task<int> FetchAllLevelsAsync(ocilib::Executor& executor, ocilib::Connection con)
+    {
+        int sum = co_await FetchLevelsAsync(executor, con, 10);
+
+        sum += co_await FetchLevelsAsync(executor, con, 20);
+
+        co_return sum;
+    }
+
+    TEST(TestThread, ExecuteAndFetchCoroutine)
+    {
+        ocilib::Environment::Initialize(ocilib::Environment::Threaded);
+
+        {
+            ocilib::Connection con(DBS, USR, PWD);
+            ocilib::Executor executor(2);
+
+            ASSERT_EQ(55 + 210, FetchAllLevelsAsync(executor, con).Get());
+        }
+
+        ocilib::Environment::Cleanup();
+    }
+
+#endif
+}